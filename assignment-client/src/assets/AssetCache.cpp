@@ -0,0 +1,90 @@
+//
+//  AssetCache.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AssetCache.h"
+
+#include <algorithm>
+
+void AssetCache::setBudget(qint64 bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _budget = std::max<qint64>(bytes, 0);
+    evict(_budget);
+}
+
+QByteArray AssetCache::get(const QString& hash, quint64& generation) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _index.find(hash);
+    if (it == _index.end()) {
+        ++_numMisses;
+        generation = _generation;
+        return QByteArray();
+    }
+
+    // move it to the front, iterators into a std::list stay valid
+    _entries.splice(_entries.begin(), _entries, it.value());
+    ++_numHits;
+    return it.value()->data;
+}
+
+void AssetCache::insert(const QString& hash, const QByteArray& data, quint64 generation) {
+    if (_budget <= 0 || data.size() > getMaxEntrySize()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // the file may have been deleted, and its entry removed, while it was read after the miss
+    if (generation != _generation) {
+        return;
+    }
+
+    // two transfer threads may have missed on the same asset at the same time
+    if (_index.contains(hash)) {
+        return;
+    }
+
+    evict(_budget - data.size());
+    _entries.push_front({ hash, data });
+    _index.insert(hash, _entries.begin());
+    _size += data.size();
+}
+
+void AssetCache::remove(const QString& hash) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    ++_generation;
+    auto it = _index.find(hash);
+    if (it != _index.end()) {
+        _size -= it.value()->data.size();
+        _entries.erase(it.value());
+        _index.erase(it);
+    }
+}
+
+qint64 AssetCache::getSize() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _size;
+}
+
+int AssetCache::getNumEntries() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _index.size();
+}
+
+void AssetCache::evict(qint64 budget) {
+    while (_size > budget && !_entries.empty()) {
+        auto& entry = _entries.back();
+        _size -= entry.data.size();
+        _index.remove(entry.hash);
+        _entries.pop_back();
+        ++_numEvictions;
+    }
+}
@@ -0,0 +1,68 @@
+//
+//  AssetCache.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AssetCache_h
+#define hifi_AssetCache_h
+
+#include <atomic>
+#include <list>
+#include <mutex>
+
+#include <QtCore/QByteArray>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+
+// Byte-budgeted LRU cache of recently served asset files, shared by the transfer threads
+//   Asset files are named by the hash of their content, so an entry never goes stale, it only needs
+//   to be removed when its file is deleted. Files bigger than a fraction of the budget are not cached.
+//   A file read after a miss is only inserted if no entry was removed since the miss, as its file
+//   may have been deleted while it was read.
+class AssetCache {
+public:
+    void setBudget(qint64 bytes);
+    qint64 getBudget() const { return _budget; }
+    qint64 getMaxEntrySize() const { return _budget / MAX_ENTRY_FRACTION; }
+
+    // returns a null QByteArray on a miss, and the generation to insert the file read from disk with
+    QByteArray get(const QString& hash, quint64& generation);
+    void insert(const QString& hash, const QByteArray& data, quint64 generation);
+    // to call once the file of the hash is deleted
+    void remove(const QString& hash);
+
+    quint64 getNumHits() const { return _numHits; }
+    quint64 getNumMisses() const { return _numMisses; }
+    quint64 getNumEvictions() const { return _numEvictions; }
+    qint64 getSize();
+    int getNumEntries();
+
+private:
+    static const int MAX_ENTRY_FRACTION = 8;
+
+    struct Entry {
+        QString hash;
+        QByteArray data;
+    };
+    using Entries = std::list<Entry>;
+
+    void evict(qint64 budget);
+
+    std::mutex _mutex;
+    Entries _entries; // most recently used first
+    QHash<QString, Entries::iterator> _index;
+    qint64 _size { 0 };
+    quint64 _generation { 0 }; // incremented on each removal
+
+    std::atomic<qint64> _budget { 0 };
+    std::atomic<quint64> _numHits { 0 };
+    std::atomic<quint64> _numMisses { 0 };
+    std::atomic<quint64> _numEvictions { 0 };
+};
+
+#endif // hifi_AssetCache_h
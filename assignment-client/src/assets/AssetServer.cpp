@@ -125,12 +125,25 @@ void AssetServer::bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetU
         connect(task.get(), &BakeAssetTask::bakeFailed, this, &AssetServer::handleFailedBake);
         connect(task.get(), &BakeAssetTask::bakeAborted, this, &AssetServer::handleAbortedBake);
 
-        _bakingTaskPool.start(task.get());
+        _bakeScheduler.enqueue(task, assetHash, assetTypeForFilename(assetPath), QFileInfo(filePath).size());
+        startScheduledBakes();
     } else {
         qDebug() << "Already in queue";
     }
 }
 
+void AssetServer::startScheduledBakes() {
+    for (auto& task : _bakeScheduler.takeRunnable()) {
+        _bakingTaskPool.start(task.get());
+    }
+}
+
+void AssetServer::finishBake(const AssetUtils::AssetHash& assetHash) {
+    _pendingBakes.remove(assetHash);
+    _bakeScheduler.finished(assetHash);
+    startScheduledBakes();
+}
+
 QString AssetServer::getPathToAssetHash(const AssetUtils::AssetHash& assetHash) {
     return _filesDirectory.absoluteFilePath(assetHash);
 }
@@ -304,7 +317,8 @@ AssetServer::AssetServer(ReceivedMessage& message) :
     // so the ideal is greater than the number of cores on the system.
     static const int TASK_POOL_THREAD_COUNT = 50;
     _transferTaskPool.setMaxThreadCount(TASK_POOL_THREAD_COUNT);
-    _bakingTaskPool.setMaxThreadCount(1);
+    _bakeScheduler.setBudget(0, 0);
+    _bakingTaskPool.setMaxThreadCount(_bakeScheduler.getCPUBudget());
 
     // Queue all requests until the Asset Server is fully setup
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
@@ -328,10 +342,15 @@ AssetServer::AssetServer(ReceivedMessage& message) :
 
 void AssetServer::aboutToFinish() {
 
-    // remove pending transfer tasks
+    // remove pending transfer tasks, and let the running ones finish with the cache and files they use
     _transferTaskPool.clear();
+    _transferTaskPool.waitForDone();
 
     // abort each of our still running bake tasks, remove pending bakes that were never put on the thread pool
+    for (auto& hash : _bakeScheduler.clearQueued()) {
+        _pendingBakes.remove(hash);
+    }
+
     auto it = _pendingBakes.begin();
     while (it != _pendingBakes.end()) {
         auto pendingRunnable =  _bakingTaskPool.tryTake(it->get());
@@ -427,6 +446,18 @@ void AssetServer::completeSetup() {
         return;
     }
 
+    // get how much of the machine concurrent bakes may use
+    static const QString BAKING_CPU_BUDGET_OPTION = "baking_cpu_budget";
+    static const QString BAKING_MEMORY_BUDGET_OPTION = "baking_memory_budget";
+    static const int DEFAULT_BAKING_MEMORY_BUDGET = 4096;
+    static const qint64 BYTES_PER_MEGABYTE = 1024 * 1024;
+    auto bakingCPUBudget = assetServerObject[BAKING_CPU_BUDGET_OPTION].toInt(0);
+    auto bakingMemoryBudget = assetServerObject[BAKING_MEMORY_BUDGET_OPTION].toInt(DEFAULT_BAKING_MEMORY_BUDGET);
+    _bakeScheduler.setBudget(bakingCPUBudget, bakingMemoryBudget * BYTES_PER_MEGABYTE);
+    _bakingTaskPool.setMaxThreadCount(_bakeScheduler.getCPUBudget());
+    qCInfo(asset_server) << "Baking with up to" << _bakeScheduler.getCPUBudget() << "CPU slots and"
+                         << bakingMemoryBudget << "MB of memory.";
+
     // load whatever mappings we currently have from the local file
     if (loadMappingsFromFile()) {
         qCInfo(asset_server) << "Serving files from: " << _filesDirectory.path();
@@ -461,6 +492,13 @@ void AssetServer::completeSetup() {
         _filesizeLimit = assetsFilesizeLimit * BITS_PER_MEGABITS;
     }
 
+    // get the memory budget for recently served assets
+    static const QString ASSETS_CACHE_SIZE_OPTION = "assets_cache_size";
+    static const int DEFAULT_ASSETS_CACHE_SIZE = 256;
+    auto assetsCacheSize = assetServerObject[ASSETS_CACHE_SIZE_OPTION].toInt(DEFAULT_ASSETS_CACHE_SIZE);
+    _assetCache.setBudget(assetsCacheSize * BYTES_PER_MEGABYTE);
+    qCInfo(asset_server) << "Caching up to" << assetsCacheSize << "MB of recently served assets.";
+
     PathUtils::removeTemporaryApplicationDirs();
     PathUtils::removeTemporaryApplicationDirs("Oven");
 
@@ -547,6 +585,7 @@ void AssetServer::cleanupUnmappedFiles() {
 
                 if (removeableFile.remove()) {
                     qCDebug(asset_server) << "\tDeleted" << filename << "from asset files directory since it is unmapped.";
+                    _assetCache.remove(filename);
 
                     removeBakedPathsForDeletedAsset(filename);
                 } else {
@@ -874,7 +913,7 @@ void AssetServer::handleAssetGet(QSharedPointer<ReceivedMessage> message, Shared
     }
 
     // Queue task
-    auto task = new SendAssetTask(message, senderNode, _filesDirectory);
+    auto task = new SendAssetTask(message, senderNode, _filesDirectory, _assetCache);
     _transferTaskPool.start(task);
 }
 
@@ -967,6 +1006,24 @@ void AssetServer::sendStatsPacket() {
         serverStats[uuid] = nodeStats;
     });
 
+    QJsonObject sendStats;
+    sendStats["1. Sends In Flight"] = SendAssetTask::getSendsInFlight();
+    sendStats["2. Bytes In Flight"] = (double)SendAssetTask::getBytesInFlight();
+    sendStats["3. Bytes Sent Mapped"] = (double)SendAssetTask::getTotalBytesMapped();
+    sendStats["4. Bytes Sent Read"] = (double)SendAssetTask::getTotalBytesRead();
+    serverStats["Asset Sends"] = sendStats;
+
+    serverStats["Bakes"] = _bakeScheduler.getStats();
+
+    QJsonObject cacheStats;
+    cacheStats["1. Hits"] = (double)_assetCache.getNumHits();
+    cacheStats["2. Misses"] = (double)_assetCache.getNumMisses();
+    cacheStats["3. Evictions"] = (double)_assetCache.getNumEvictions();
+    cacheStats["4. Entries"] = _assetCache.getNumEntries();
+    cacheStats["5. Size (B)"] = (double)_assetCache.getSize();
+    cacheStats["6. Budget (B)"] = (double)_assetCache.getBudget();
+    serverStats["Asset Cache"] = cacheStats;
+
     // send off the stats packets
     ThreadedAssignment::addPacketStatsAndSendStatsPacket(serverStats);
 }
@@ -1184,6 +1241,7 @@ bool AssetServer::deleteMappings(const AssetUtils::AssetPathList& paths) {
 
             if (removeableFile.remove()) {
                 qCDebug(asset_server) << "\tDeleted" << hash << "from asset files directory since it is now unmapped.";
+                _assetCache.remove(hash);
 
                 removeBakedPathsForDeletedAsset(hash);
             } else {
@@ -1319,7 +1377,7 @@ void AssetServer::handleFailedBake(QString originalAssetHash, QString assetPath,
 
     writeMetaFile(originalAssetHash, meta);
 
-    _pendingBakes.remove(originalAssetHash);
+    finishBake(originalAssetHash);
 }
 
 void AssetServer::handleCompletedBake(QString originalAssetHash, QString originalAssetPath,
@@ -1342,7 +1400,7 @@ void AssetServer::handleCompletedBake(QString originalAssetHash, QString origina
 
         writeMetaFile(originalAssetHash, meta);
 
-        _pendingBakes.remove(originalAssetHash);
+        finishBake(originalAssetHash);
     };
 
     bool errorCompletingBake { false };
@@ -1475,7 +1533,7 @@ void AssetServer::handleAbortedBake(QString originalAssetHash, QString assetPath
     qDebug() << "Aborted bake:" << originalAssetHash;
 
     // for an aborted bake we don't do anything but remove the BakeAssetTask from our pending bakes
-    _pendingBakes.remove(originalAssetHash);
+    finishBake(originalAssetHash);
 }
 
 static const QString BAKE_VERSION_KEY = "bake_version";
@@ -19,7 +19,9 @@
 
 #include <ThreadedAssignment.h>
 
+#include "AssetCache.h"
 #include "AssetUtils.h"
+#include "BakeScheduler.h"
 #include "ReceivedMessage.h"
 
 #include "RegisteredMetaTypes.h"
@@ -136,6 +138,8 @@ private:
     bool hasMetaFile(const AssetUtils::AssetHash& hash);
     bool needsToBeBaked(const AssetUtils::AssetPath& path, const AssetUtils::AssetHash& assetHash);
     void bakeAsset(const AssetUtils::AssetHash& assetHash, const AssetUtils::AssetPath& assetPath, const QString& filePath);
+    void startScheduledBakes();
+    void finishBake(const AssetUtils::AssetHash& assetHash);
 
     /// Move baked content for asset to baked directory and update baked status
     void handleCompletedBake(QString originalAssetHash, QString assetPath, QString bakedTempOutputDir);
@@ -154,12 +158,18 @@ private:
     QDir _resourcesDirectory;
     QDir _filesDirectory;
 
+    /// Recently served asset files, shared by the download tasks, so it must outlive the task pool
+    AssetCache _assetCache;
+
     /// Task pool for handling uploads and downloads of assets
     QThreadPool _transferTaskPool;
 
     QHash<AssetUtils::AssetHash, std::shared_ptr<BakeAssetTask>> _pendingBakes;
     QThreadPool _bakingTaskPool;
 
+    /// Decides which of the pending bakes run concurrently on the baking task pool
+    BakeScheduler _bakeScheduler;
+
     QMutex _queuedRequestsMutex;
     bool _isQueueingRequests { true };
     using RequestQueue = QVector<QPair<QSharedPointer<ReceivedMessage>, SharedNodePointer>>;
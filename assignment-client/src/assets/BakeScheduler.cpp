@@ -0,0 +1,201 @@
+//
+//  BakeScheduler.cpp
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "BakeScheduler.h"
+
+#include <algorithm>
+
+#include <QtCore/QThread>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+#include "AssetServer.h"
+
+// the oven bakes the textures of a model on its worker threads, in parallel with the model itself
+static const int MODEL_CPU_SLOTS = 4;
+static const int DEFAULT_CPU_SLOTS = 1;
+
+// rough estimates, an oven process decodes its textures to full size images before compressing them
+static const qint64 BYTES_PER_MEGABYTE = 1024 * 1024;
+static const qint64 OVEN_PROCESS_MEMORY = 64 * BYTES_PER_MEGABYTE;
+static const qint64 MODEL_TEXTURES_MEMORY = 512 * BYTES_PER_MEGABYTE;
+static const qint64 MODEL_MEMORY_PER_FILE_BYTE = 4;
+static const qint64 TEXTURE_MEMORY_PER_FILE_BYTE = 16;
+
+// how long smaller bakes may start ahead of the oldest bake that is waiting for room
+static const quint64 MAX_BACKFILL_WAIT = 30 * USECS_PER_SECOND;
+
+void BakeScheduler::setBudget(int cpuSlots, qint64 memoryBytes) {
+    _cpuBudget = cpuSlots > 0 ? cpuSlots : std::max(QThread::idealThreadCount(), 1);
+    _memoryBudget = std::max<qint64>(memoryBytes, 0);
+}
+
+void BakeScheduler::enqueue(TaskPointer task, const AssetUtils::AssetHash& hash, BakedAssetType type, qint64 fileSize) {
+    Bake bake;
+    bake.task = std::move(task);
+    bake.hash = hash;
+    bake.type = type;
+    bake.queuedTime = usecTimestampNow();
+
+    switch (type) {
+        case BakedAssetType::Model:
+            bake.cpuSlots = MODEL_CPU_SLOTS;
+            bake.memory = OVEN_PROCESS_MEMORY + MODEL_TEXTURES_MEMORY + fileSize * MODEL_MEMORY_PER_FILE_BYTE;
+            break;
+        case BakedAssetType::Texture:
+            bake.cpuSlots = DEFAULT_CPU_SLOTS;
+            bake.memory = OVEN_PROCESS_MEMORY + fileSize * TEXTURE_MEMORY_PER_FILE_BYTE;
+            break;
+        default:
+            bake.cpuSlots = DEFAULT_CPU_SLOTS;
+            bake.memory = OVEN_PROCESS_MEMORY + fileSize;
+            break;
+    }
+
+    _queued.push_back(std::move(bake));
+}
+
+std::vector<BakeScheduler::TaskPointer> BakeScheduler::takeRunnable() {
+    std::vector<TaskPointer> runnable;
+    auto now = usecTimestampNow();
+
+    bool isBlocked = false;
+    auto it = _queued.begin();
+    while (it != _queued.end()) {
+        if (fits(*it)) {
+            start(*it, now);
+            runnable.push_back(it->task);
+            _running.insert(it->hash, *it);
+            it = _queued.erase(it);
+            continue;
+        }
+
+        if (!isBlocked) {
+            // the oldest bake waiting for room, remember since when so it can't be held back forever
+            isBlocked = true;
+            if (it->hash != _blockedHash) {
+                _blockedHash = it->hash;
+                _blockedSince = now;
+            }
+            if (now - _blockedSince > MAX_BACKFILL_WAIT) {
+                break;
+            }
+        }
+        ++it;
+    }
+
+    return runnable;
+}
+
+void BakeScheduler::finished(const AssetUtils::AssetHash& hash) {
+    auto it = _running.find(hash);
+    if (it == _running.end()) {
+        _queued.erase(std::remove_if(_queued.begin(), _queued.end(), [&](const Bake& bake) {
+            return bake.hash == hash;
+        }), _queued.end());
+        return;
+    }
+
+    auto& bake = it.value();
+    _cpuSlotsInUse -= bake.cpuSlots;
+    _memoryInUse -= bake.memory;
+
+    auto duration = usecTimestampNow() - bake.startTime;
+    auto& timing = _timings[bake.type];
+    ++timing.count;
+    timing.totalUsecs += duration;
+    timing.maxUsecs = std::max(timing.maxUsecs, duration);
+    timing.lastUsecs = duration;
+    timing.totalWaitUsecs += bake.startTime - bake.queuedTime;
+
+    _running.erase(it);
+}
+
+std::vector<AssetUtils::AssetHash> BakeScheduler::clearQueued() {
+    std::vector<AssetUtils::AssetHash> hashes;
+    hashes.reserve(_queued.size());
+    for (auto& bake : _queued) {
+        hashes.push_back(bake.hash);
+    }
+    _queued.clear();
+    return hashes;
+}
+
+QJsonObject BakeScheduler::getStats() const {
+    static const double USECS_PER_MSEC_DOUBLE = (double)USECS_PER_MSEC;
+
+    QJsonObject stats;
+    stats["1. Queued"] = getNumQueued();
+    stats["2. Running"] = getNumRunning();
+    stats["3. CPU Slots In Use"] = _cpuSlotsInUse;
+    stats["4. CPU Budget"] = _cpuBudget;
+    stats["5. Memory In Use (MB)"] = (double)(_memoryInUse / BYTES_PER_MEGABYTE);
+    stats["6. Memory Budget (MB)"] = (double)(_memoryBudget / BYTES_PER_MEGABYTE);
+
+    for (const auto& pair : _timings) {
+        const auto& timing = pair.second;
+
+        QString name;
+        switch (pair.first) {
+            case BakedAssetType::Model:
+                name = "Models";
+                break;
+            case BakedAssetType::Texture:
+                name = "Textures";
+                break;
+            case BakedAssetType::Script:
+                name = "Scripts";
+                break;
+            default:
+                name = "Other";
+                break;
+        }
+
+        QJsonObject typeStats;
+        typeStats["1. Completed"] = timing.count;
+        typeStats["2. Avg Bake (ms)"] = timing.totalUsecs / USECS_PER_MSEC_DOUBLE / timing.count;
+        typeStats["3. Max Bake (ms)"] = timing.maxUsecs / USECS_PER_MSEC_DOUBLE;
+        typeStats["4. Last Bake (ms)"] = timing.lastUsecs / USECS_PER_MSEC_DOUBLE;
+        typeStats["5. Avg Wait (ms)"] = timing.totalWaitUsecs / USECS_PER_MSEC_DOUBLE / timing.count;
+        stats[name] = typeStats;
+    }
+
+    return stats;
+}
+
+bool BakeScheduler::fits(const Bake& bake) const {
+    // a bake bigger than the whole budget still runs, on its own
+    if (_running.empty()) {
+        return true;
+    }
+
+    if (_cpuSlotsInUse + std::min(bake.cpuSlots, _cpuBudget) > _cpuBudget) {
+        return false;
+    }
+
+    return _memoryBudget == 0 || _memoryInUse + std::min(bake.memory, _memoryBudget) <= _memoryBudget;
+}
+
+void BakeScheduler::start(Bake& bake, quint64 now) {
+    // hold on to what is reserved, the budget may change while this runs
+    bake.cpuSlots = std::min(bake.cpuSlots, _cpuBudget);
+    if (_memoryBudget > 0) {
+        bake.memory = std::min(bake.memory, _memoryBudget);
+    }
+    bake.startTime = now;
+
+    _cpuSlotsInUse += bake.cpuSlots;
+    _memoryInUse += bake.memory;
+
+    if (bake.hash == _blockedHash) {
+        _blockedHash.clear();
+    }
+}
@@ -0,0 +1,93 @@
+//
+//  BakeScheduler.h
+//  assignment-client/src/assets
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_BakeScheduler_h
+#define hifi_BakeScheduler_h
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+
+#include <AssetUtils.h>
+
+enum class BakedAssetType : int;
+class BakeAssetTask;
+
+// Decides which pending bakes may run at the same time, must only be used from the asset server thread
+//   Every bake runs its own oven process, so the scheduler keeps the sum of their estimated CPU and memory
+//   costs within a budget. A model bake fans out into the bakes of all its textures inside its oven, so it
+//   reserves several CPU slots where a texture or script bake only takes one. Bakes start in the order they
+//   were queued, smaller ones can fill in behind a bake waiting for room, but only for a limited time so
+//   that a stream of textures can't hold back a model forever.
+class BakeScheduler {
+public:
+    using TaskPointer = std::shared_ptr<BakeAssetTask>;
+
+    // a CPU budget of 0 uses the number of cores, a memory budget of 0 means no memory limit
+    void setBudget(int cpuSlots, qint64 memoryBytes);
+    int getCPUBudget() const { return _cpuBudget; }
+    qint64 getMemoryBudget() const { return _memoryBudget; }
+
+    void enqueue(TaskPointer task, const AssetUtils::AssetHash& hash, BakedAssetType type, qint64 fileSize);
+
+    // returns the queued bakes that fit in the budget now, they are considered running from here on
+    std::vector<TaskPointer> takeRunnable();
+
+    // releases the budget held by a running bake, or drops a queued one
+    void finished(const AssetUtils::AssetHash& hash);
+
+    // drops all the bakes that haven't started yet, returning their hashes
+    std::vector<AssetUtils::AssetHash> clearQueued();
+
+    int getNumQueued() const { return (int)_queued.size(); }
+    int getNumRunning() const { return _running.size(); }
+
+    QJsonObject getStats() const;
+
+private:
+    struct Bake {
+        TaskPointer task;
+        AssetUtils::AssetHash hash;
+        BakedAssetType type;
+        int cpuSlots { 1 };
+        qint64 memory { 0 };
+        quint64 queuedTime { 0 };
+        quint64 startTime { 0 };
+    };
+
+    struct Timing {
+        int count { 0 };
+        quint64 totalUsecs { 0 };
+        quint64 maxUsecs { 0 };
+        quint64 lastUsecs { 0 };
+        quint64 totalWaitUsecs { 0 };
+    };
+
+    bool fits(const Bake& bake) const;
+    void start(Bake& bake, quint64 now);
+
+    int _cpuBudget { 1 };
+    qint64 _memoryBudget { 0 };
+    int _cpuSlotsInUse { 0 };
+    qint64 _memoryInUse { 0 };
+
+    std::deque<Bake> _queued;
+    AssetUtils::AssetHash _blockedHash;
+    quint64 _blockedSince { 0 };
+    QHash<AssetUtils::AssetHash, Bake> _running;
+
+    std::map<BakedAssetType, Timing> _timings;
+};
+
+#endif // hifi_BakeScheduler_h
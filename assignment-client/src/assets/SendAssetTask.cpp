@@ -11,6 +11,7 @@
 
 #include "SendAssetTask.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include <QFile>
@@ -26,11 +27,66 @@
 #include "ByteRange.h"
 #include "ClientServerUtils.h"
 
-SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir) :
+// fallback for files that can't be mapped, bounds the memory used on top of the reply packets
+static const qint64 READ_CHUNK_SIZE = 1024 * 1024;
+
+std::atomic<qint64> SendAssetTask::_bytesInFlight { 0 };
+std::atomic<int> SendAssetTask::_sendsInFlight { 0 };
+std::atomic<quint64> SendAssetTask::_totalBytesMapped { 0 };
+std::atomic<quint64> SendAssetTask::_totalBytesRead { 0 };
+
+SendAssetTask::BytesInFlight::BytesInFlight() {
+    ++_sendsInFlight;
+}
+
+SendAssetTask::BytesInFlight::~BytesInFlight() {
+    _bytesInFlight -= _bytes;
+    --_sendsInFlight;
+}
+
+void SendAssetTask::BytesInFlight::add(qint64 bytes) {
+    _bytes += bytes;
+    _bytesInFlight += bytes;
+}
+
+bool SendAssetTask::writeFileRange(QFile& file, qint64 offset, qint64 size, NLPacketList& packetList) {
+    if (size <= 0) {
+        return true;
+    }
+
+    // packet payloads are filled straight from the page cache, without reading the range into a buffer first
+    if (uchar* mapped = file.map(offset, size)) {
+        qint64 written = packetList.write(reinterpret_cast<const char*>(mapped), size);
+        file.unmap(mapped);
+        _totalBytesMapped += size;
+        return written == size;
+    }
+
+    if (!file.seek(offset)) {
+        return false;
+    }
+
+    QByteArray chunk(std::min(size, READ_CHUNK_SIZE), Qt::Uninitialized);
+    qint64 remaining = size;
+    while (remaining > 0) {
+        qint64 bytesRead = file.read(chunk.data(), std::min<qint64>(remaining, chunk.size()));
+        if (bytesRead <= 0) {
+            return false;
+        }
+        packetList.write(chunk.constData(), bytesRead);
+        remaining -= bytesRead;
+        _totalBytesRead += bytesRead;
+    }
+    return true;
+}
+
+SendAssetTask::SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                             AssetCache& assetCache) :
     QRunnable(),
     _message(message),
     _senderNode(sendToNode),
-    _resourcesDir(resourcesDir)
+    _resourcesDir(resourcesDir),
+    _assetCache(assetCache)
 {
     
 }
@@ -49,6 +105,9 @@ void SendAssetTask::run() {
     _message->readPrimitive(&byteRange.toExclusive);
     
     QString hexHash = assetHash.toHex();
+
+    // counts the reply as in flight until it has been handed to the socket
+    BytesInFlight inFlight;
     
     qDebug() << "Received a request for the file (" << messageID << "): " << hexHash << " from "
         << byteRange.fromInclusive << " to " << byteRange.toExclusive;
@@ -66,15 +125,28 @@ void SendAssetTask::run() {
         QString filePath = _resourcesDir.filePath(QString(hexHash));
         
         QFile file { filePath };
+        quint64 cacheGeneration = 0;
+        QByteArray cachedData = _assetCache.get(hexHash, cacheGeneration);
+
+        if (!cachedData.isNull() || file.open(QIODevice::ReadOnly)) {
+            qint64 fileSize = cachedData.isNull() ? file.size() : cachedData.size();
 
-        if (file.open(QIODevice::ReadOnly)) {
+            // small files are read whole, so the next requests for them don't touch the disk
+            if (cachedData.isNull() && fileSize <= _assetCache.getMaxEntrySize()) {
+                cachedData = file.readAll();
+                if (cachedData.size() == fileSize) {
+                    _assetCache.insert(hexHash, cachedData, cacheGeneration);
+                } else {
+                    cachedData = QByteArray();
+                }
+            }
 
             // first fixup the range based on the now known file size
-            byteRange.fixupRange(file.size());
+            byteRange.fixupRange(fileSize);
 
             // check if we're being asked to read data that we just don't have
             // because of the file size
-            if (file.size() < byteRange.fromInclusive || file.size() < byteRange.toExclusive) {
+            if (fileSize < byteRange.fromInclusive || fileSize < byteRange.toExclusive) {
                 replyPacketList->writePrimitive(AssetUtils::AssetServerError::InvalidByteRange);
                 qCDebug(networking) << "Bad byte range: " << hexHash << " "
                     << byteRange.fromInclusive << ":" << byteRange.toExclusive;
@@ -82,24 +154,22 @@ void SendAssetTask::run() {
                 // we have a valid byte range, handle it and send the asset
                 auto size = byteRange.size();
 
-                if (byteRange.fromInclusive >= 0) {
-
-                    // this range is positive, meaning we just need to seek into the file and then read from there
-                    file.seek(byteRange.fromInclusive);
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
-                    replyPacketList->write(file.read(size));
-                } else {
-                    // this range is negative, at least the first part of the read will be back into the end of the file
-
-                    // seek to the part of the file where the negative range begins
-                    file.seek(file.size() + byteRange.fromInclusive);
-
-                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
-                    replyPacketList->writePrimitive(size);
-
-                    // first write everything from the negative range to the end of the file
-                    replyPacketList->write(file.read(size));
+                // a negative range means the read starts that far back from the end of the file
+                qint64 offset = byteRange.fromInclusive >= 0 ? byteRange.fromInclusive : fileSize + byteRange.fromInclusive;
+
+                replyPacketList->writePrimitive(AssetUtils::AssetServerError::NoError);
+                replyPacketList->writePrimitive(size);
+                inFlight.add(size);
+                if (!cachedData.isNull()) {
+                    replyPacketList->write(cachedData.constData() + offset, size);
+                } else if (!writeFileRange(file, offset, size, *replyPacketList)) {
+                    qCWarning(networking) << "Failed to read" << size << "bytes at" << offset << "of" << hexHash;
+
+                    // drop what was read of the asset, the reply can't promise bytes it doesn't have
+                    replyPacketList = NLPacketList::create(PacketType::AssetGetReply, QByteArray(), true, true);
+                    replyPacketList->write(assetHash);
+                    replyPacketList->writePrimitive(messageID);
+                    replyPacketList->writePrimitive(AssetUtils::AssetServerError::FileOperationFailed);
                 }
 
                 qCDebug(networking) << "Sending asset: " << hexHash;
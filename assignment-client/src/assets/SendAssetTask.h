@@ -12,27 +12,59 @@
 #ifndef hifi_SendAssetTask_h
 #define hifi_SendAssetTask_h
 
+#include <atomic>
+
 #include <QtCore/QByteArray>
+#include <QtCore/QFile>
 #include <QtCore/QSharedPointer>
 #include <QtCore/QString>
 #include <QtCore/QRunnable>
 
+#include "AssetCache.h"
 #include "AssetUtils.h"
 #include "AssetServer.h"
 #include "Node.h"
 
 class NLPacket;
+class NLPacketList;
 
 class SendAssetTask : public QRunnable {
 public:
-    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir);
+    SendAssetTask(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& sendToNode, const QDir& resourcesDir,
+                  AssetCache& assetCache);
 
     void run() override;
 
+    // replies being read into packets, until they are handed to the socket
+    static qint64 getBytesInFlight() { return _bytesInFlight; }
+    static int getSendsInFlight() { return _sendsInFlight; }
+
+    // asset bytes sent from a mapping of their file, and through chunked reads when it couldn't be mapped
+    static quint64 getTotalBytesMapped() { return _totalBytesMapped; }
+    static quint64 getTotalBytesRead() { return _totalBytesRead; }
+
 private:
+    class BytesInFlight {
+    public:
+        BytesInFlight();
+        ~BytesInFlight();
+        void add(qint64 bytes);
+
+    private:
+        qint64 _bytes { 0 };
+    };
+
+    static bool writeFileRange(QFile& file, qint64 offset, qint64 size, NLPacketList& packetList);
+
+    static std::atomic<qint64> _bytesInFlight;
+    static std::atomic<int> _sendsInFlight;
+    static std::atomic<quint64> _totalBytesMapped;
+    static std::atomic<quint64> _totalBytesRead;
+
     QSharedPointer<ReceivedMessage> _message;
     SharedNodePointer _senderNode;
     QDir _resourcesDir;
+    AssetCache& _assetCache;
 };
 
 #endif
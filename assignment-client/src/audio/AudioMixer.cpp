@@ -86,8 +86,9 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
     auto nodeList = DependencyManager::get<NodeList>();
     auto& packetReceiver = nodeList->getPacketReceiver();
 
-    // packets whose consequences are limited to their own node can be parallelized
-    packetReceiver.registerListenerForTypes({
+    // packets whose consequences are limited to their own node can be parallelized,
+    // they skip the event queue of the mixer thread, which queues them for the slaves at the start of each frame
+    packetReceiver.registerInboxListenerForTypes({
             PacketType::MicrophoneAudioNoEcho,
             PacketType::MicrophoneAudioWithEcho,
             PacketType::InjectAudio,
@@ -102,7 +103,8 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
             PacketType::InjectorGainSet,
             PacketType::AudioSoloRequest,
             PacketType::StopInjector },
-            PacketReceiver::makeSourcedListenerReference<AudioMixer>(this, &AudioMixer::queueAudioPacket)
+            PacketReceiver::makeSourcedListenerReference<AudioMixer>(this, &AudioMixer::queueAudioPacket),
+            _packetInbox
     );
 
     // packets whose consequences are global should be processed on the main thread
@@ -113,12 +115,13 @@ AudioMixer::AudioMixer(ReceivedMessage& message) :
     packetReceiver.registerListener(PacketType::KillAvatar,
         PacketReceiver::makeSourcedListenerReference<AudioMixer>(this, &AudioMixer::handleKillAvatarPacket));
 
-    packetReceiver.registerListenerForTypes({
+    packetReceiver.registerInboxListenerForTypes({
         PacketType::ReplicatedMicrophoneAudioNoEcho,
         PacketType::ReplicatedMicrophoneAudioWithEcho,
         PacketType::ReplicatedInjectAudio,
         PacketType::ReplicatedSilentAudioFrame },
-        PacketReceiver::makeUnsourcedListenerReference<AudioMixer>(this, &AudioMixer::queueReplicatedAudioPacket)
+        PacketReceiver::makeUnsourcedListenerReference<AudioMixer>(this, &AudioMixer::queueReplicatedAudioPacket),
+        _packetInbox
     );
 
     connect(nodeList.data(), &NodeList::nodeKilled, this, &AudioMixer::handleNodeKilled);
@@ -286,6 +289,12 @@ void AudioMixer::sendStatsPacket() {
 
     statsObject["threads"] = _slavePool.numThreads();
 
+    statsObject["packet_inbox"] = _packetInbox->sampleStats();
+
+    QJsonObject threadStats;
+    _slavePool.threadStats(threadStats, _numStatFrames);
+    statsObject["thread_stats"] = threadStats;
+
     statsObject["trailing_mix_ratio"] = _trailingMixRatio;
     statsObject["throttling_ratio"] = _throttlingRatio;
 
@@ -295,6 +304,11 @@ void AudioMixer::sendStatsPacket() {
 
     statsObject["silent_packets_per_frame"] = (float)_numSilentPackets / (float)_numStatFrames;
 
+    statsObject["culling_cell_size"] = _workerSharedData.spatialGrid.getCellSize();
+    statsObject["culling_occupied_cells"] = _workerSharedData.spatialGrid.getNumOccupiedCells();
+    statsObject["crowd_beds"] = _workerSharedData.crowdBeds.getNumBeds();
+    statsObject["crowd_bed_sources"] = _workerSharedData.crowdBeds.getNumBedSources();
+
     // timing stats
     QJsonObject timingStats;
 
@@ -330,6 +344,7 @@ void AudioMixer::sendStatsPacket() {
     mixStats["1_hrtf_renders"] = (int)(_stats.hrtfRenders / (float)_numStatFrames);
     mixStats["1_hrtf_resets"] = (int)(_stats.hrtfResets / (float)_numStatFrames);
     mixStats["1_hrtf_updates"] = (int)(_stats.hrtfUpdates / (float)_numStatFrames);
+    mixStats["1_hrtf_batches"] = (int)(_stats.hrtfBatches / (float)_numStatFrames);
 
     mixStats["2_skipped_streams"] = (int)(_stats.skipped / (float)_numStatFrames);
     mixStats["2_inactive_streams"] = (int)(_stats.inactive / (float)_numStatFrames);
@@ -342,6 +357,12 @@ void AudioMixer::sendStatsPacket() {
     mixStats["3_active_to_skippped"] = (int)(_stats.activeToSkipped / (float)_numStatFrames);
     mixStats["3_active_to_inactive"] = (int)(_stats.activeToInactive / (float)_numStatFrames);
 
+    mixStats["4_pairs_evaluated"] = (int)(_stats.pairsEvaluated / (float)_numStatFrames);
+    mixStats["4_pairs_culled"] = (int)(_stats.pairsCulled / (float)_numStatFrames);
+
+    mixStats["5_crowd_bed_renders"] = (int)(_stats.crowdBedRenders / (float)_numStatFrames);
+    mixStats["5_crowd_bed_streams"] = (int)(_stats.crowdBedStreams / (float)_numStatFrames);
+
     mixStats["total_mixes"] = _stats.totalMixes;
     mixStats["avg_mixes_per_block"] = _stats.totalMixes / _numStatFrames;
 
@@ -440,6 +461,9 @@ void AudioMixer::start() {
             // first clear the concurrent vector of added streams that the slaves will add to when they process packets
             _workerSharedData.addedStreams.clear();
 
+            // queue the audio packets received since the last frame with their nodes
+            _packetInbox->drain();
+
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
                 _slavePool.processPackets(cbegin, cend);
             });
@@ -457,11 +481,27 @@ void AudioMixer::start() {
             QCoreApplication::processEvents();
         }
 
+        // rebuild the spatial grid of stream positions, now that this frame's positions and removals are known
+        nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+            _workerSharedData.spatialGrid.rebuild(cbegin, cend);
+        });
+
         int numToRetain = -1;
         assert(_throttlingRatio >= 0.0f && _throttlingRatio <= 1.0f);
         if (_throttlingRatio > EPSILON) {
             numToRetain = nodeList->size() * (1.0f - _throttlingRatio);
         }
+
+        // while throttling, pan the far-field streams of each listener cell into a shared crowd bed
+        auto& crowdBeds = _workerSharedData.crowdBeds;
+        if (numToRetain != -1 && crowdBeds.isEnabled() && _workerSharedData.spatialGrid.isEnabled()) {
+            nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
+                crowdBeds.rebuild(cbegin, cend, _workerSharedData.spatialGrid);
+            });
+        } else if (crowdBeds.getNumBeds() > 0) {
+            crowdBeds.clear();
+        }
+
         nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
             // mix across slave threads
             auto mixTimer = _mixTiming.timer();
@@ -594,6 +634,20 @@ void AudioMixer::parseSettingsObject(const QJsonObject& settingsObject) {
         }
 
         qCDebug(audio) << "Throttle Start:" << _throttleStartTarget << "Throttle Backoff:" << _throttleBackoffTarget;
+
+        const QString CULLING_CELL_SIZE_KEY = "culling_cell_size";
+        float cullingCellSize = audioThreadingGroupObject[CULLING_CELL_SIZE_KEY].toDouble(0.0);
+        if (cullingCellSize < 0.0f) {
+            qCWarning(audio) << "Culling cell size must be greater than or equal to 0.0. Disabling culling.";
+            cullingCellSize = 0.0f;
+        }
+        _workerSharedData.spatialGrid.setCellSize(cullingCellSize);
+
+        const QString ENABLE_CROWD_BED_KEY = "enable_crowd_bed";
+        bool enableCrowdBed = audioThreadingGroupObject[ENABLE_CROWD_BED_KEY].toBool(false);
+        _workerSharedData.crowdBeds.setEnabled(enableCrowdBed);
+
+        qCDebug(audio) << "Culling Cell Size:" << cullingCellSize << "Crowd Bed:" << enableCrowdBed;
     }
 
     if (settingsObject.contains(AUDIO_BUFFER_GROUP_KEY)) {
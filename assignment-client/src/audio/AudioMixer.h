@@ -17,6 +17,7 @@
 #include <AABox.h>
 #include <AudioHRTF.h>
 #include <AudioRingBuffer.h>
+#include <PacketInbox.h>
 #include <ThreadedAssignment.h>
 #include <UUIDHasher.h>
 
@@ -109,6 +110,9 @@ private:
 
     AudioMixerSlavePool _slavePool { _workerSharedData };
 
+    // node-isolated audio packets, queued with their nodes at the start of each frame
+    std::shared_ptr<PacketInbox> _packetInbox { std::make_shared<PacketInbox>() };
+
     class Timer {
     public:
         class Timing{
@@ -295,6 +295,7 @@ void AudioMixerClientData::clearStagedIgnoreChanges() {
     _newUnignoredNodeIDs.clear();
     _newIgnoringNodeIDs.clear();
     _newUnignoringNodeIDs.clear();
+    _hasStagedSoloChanges = false;
 }
 
 void AudioMixerClientData::parseRadiusIgnoreRequest(QSharedPointer<ReceivedMessage> message, const SharedNodePointer& node) {
@@ -332,6 +333,8 @@ void AudioMixerClientData::parseSoloRequest(QSharedPointer<ReceivedMessage> mess
             _soloedNodes.erase(it, std::end(_soloedNodes));
         }
     }
+
+    _hasStagedSoloChanges = true;
 }
 
 AvatarAudioStream* AudioMixerClientData::getAvatarAudioStream() {
@@ -361,6 +364,7 @@ void AudioMixerClientData::removeAgentAvatarAudioStream() {
         _streams.skipped.clear();
         _streams.inactive.clear();
         _streams.active.clear();
+        _streams.parked.clear();
     }
 }
 
@@ -554,6 +558,7 @@ int AudioMixerClientData::checkBuffersBeforeFrameSend() {
 
         if (stream->popFrames(1, true) > 0) {
             stream->updateLastPopOutputLoudnessAndTrailingLoudness();
+            stream->cacheLastPopOutput();
         }
 
         static const int INJECTOR_MAX_INACTIVE_BLOCKS = 500;
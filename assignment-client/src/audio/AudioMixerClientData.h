@@ -13,6 +13,7 @@
 #define hifi_AudioMixerClientData_h
 
 #include <queue>
+#include <unordered_map>
 
 #if !defined(Q_MOC_RUN)
 // Work around https://bugreports.qt.io/browse/QTBUG-80990
@@ -23,6 +24,7 @@
 #include <QtCore/QSharedPointer>
 
 #include <AABox.h>
+#include <AudioFOA.h>
 #include <AudioHRTF.h>
 #include <AudioLimiter.h>
 #include <UUIDHasher.h>
@@ -32,6 +34,7 @@
 
 #include "PositionalAudioStream.h"
 #include "AvatarAudioStream.h"
+#include "AudioMixerSpatialGrid.h"
 
 class AudioMixerClientData : public NodeData {
     Q_OBJECT
@@ -93,6 +96,9 @@ public:
 
     AudioLimiter audioLimiter;
 
+    // renders the shared crowd bed of this listener's cell while the mixer is throttling
+    AudioFOA crowdBedFOA;
+
     void setupCodec(CodecPluginPointer codec, const QString& codecName);
     void cleanupCodec();
     void encode(const QByteArray& decodedBuffer, QByteArray& encodedBuffer) {
@@ -132,10 +138,20 @@ public:
     };
 
     using MixableStreamsVector = std::vector<MixableStream>;
+
+    // far-field streams that were skipped or inactive, set aside until they come near or become audible
+    struct ParkedStream {
+        MixableStream stream;
+        bool isSkipped;
+    };
+    using ParkedStreams = std::unordered_map<AudioMixerSpatialGrid::StreamKey, ParkedStream,
+                                             AudioMixerSpatialGrid::StreamKeyHash>;
+
     struct Streams {
         MixableStreamsVector active;
         MixableStreamsVector inactive;
         MixableStreamsVector skipped;
+        ParkedStreams parked;
     };
 
     Streams& getStreams() { return _streams; }
@@ -153,6 +169,8 @@ public:
     const ConcurrentIgnoreNodeIDs& getNewIgnoringNodeIDs() const { return _newIgnoringNodeIDs; }
     const ConcurrentIgnoreNodeIDs& getNewUnignoringNodeIDs() const { return _newUnignoringNodeIDs; }
 
+    bool hasStagedSoloChanges() const { return _hasStagedSoloChanges; }
+
     void clearStagedIgnoreChanges();
 
     const Node::IgnoredNodeIDs& getIgnoringNodeIDs() const { return _ignoringNodeIDs; }
@@ -221,6 +239,7 @@ private:
     std::atomic_bool _isIgnoreRadiusEnabled { false };
 
     std::vector<QUuid> _soloedNodes;
+    bool _hasStagedSoloChanges { false };
 
     bool _hasReceivedFirstMix { false };
 };
@@ -0,0 +1,191 @@
+//
+//  AudioMixerCrowdBeds.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerCrowdBeds.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <NumericalConstants.h>
+
+#include "AudioMixer.h"
+#include "AudioMixerClientData.h"
+#include "AudioMixerSlave.h"
+#include "InjectedAudioStream.h"
+
+bool AudioMixerCrowdBeds::isInBed(const PositionalAudioStream& stream) {
+    // stereo streams are not positional, and are mixed directly by each listener
+    return !stream.isStereo() && stream.lastPopSucceeded() && stream.getLastPopOutputLoudness() != 0.0f;
+}
+
+AudioMixerCrowdBeds::SourceType AudioMixerCrowdBeds::getSourceType(const PositionalAudioStream& stream) {
+    return stream.getType() == PositionalAudioStream::Injector ? INJECTORS : AVATARS;
+}
+
+float AudioMixerCrowdBeds::getStreamGain(const PositionalAudioStream& stream) {
+    // only the injector attenuation is applied per stream, distance attenuation is applied per cell
+    if (stream.getType() == PositionalAudioStream::Injector) {
+        return reinterpret_cast<const InjectedAudioStream*>(&stream)->getAttenuationRatio();
+    }
+    return 1.0f;
+}
+
+void AudioMixerCrowdBeds::rebuild(ConstIter begin, ConstIter end, const AudioMixerSpatialGrid& grid) {
+    std::unordered_set<Cell, AudioMixerSpatialGrid::CellHash> listenerCells;
+
+    // keep the sources allocated, cells are usually occupied again on the next frame
+    for (auto& cellSource : _cellSources) {
+        cellSource.second.numStreams[AVATARS] = 0;
+        cellSource.second.numStreams[INJECTORS] = 0;
+    }
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (!nodeData) {
+            return;
+        }
+
+        if (node->getType() == NodeType::Agent) {
+            auto listenerStream = nodeData->getAvatarAudioStream();
+            if (listenerStream) {
+                listenerCells.insert(grid.getCell(listenerStream->getPosition()));
+            }
+        }
+
+        for (const auto& stream : nodeData->getAudioStreams()) {
+            if (!isInBed(*stream)) {
+                continue;
+            }
+
+            float gain = getStreamGain(*stream);
+            CellSource& source = _cellSources[grid.getCell(stream->getPosition())];
+            if (source.numStreams[AVATARS] + source.numStreams[INJECTORS] == 0) {
+                source.position = stream->getPosition();
+            } else {
+                source.position += stream->getPosition();
+            }
+
+            SourceType type = getSourceType(*stream);
+            Samples& sourceSamples = source.samples[type];
+            const float* samples = stream->getLastPopMonoFloatSamples();
+            if (source.numStreams[type] == 0) {
+                for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+                    sourceSamples[i] = gain * samples[i];
+                }
+            } else {
+                for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+                    sourceSamples[i] += gain * samples[i];
+                }
+            }
+            ++source.numStreams[type];
+        }
+    });
+
+    // drop the sources of cells that were left silent, and place the others at the mean position of their streams
+    for (auto it = _cellSources.begin(); it != _cellSources.end();) {
+        int numStreams = it->second.numStreams[AVATARS] + it->second.numStreams[INJECTORS];
+        if (numStreams == 0) {
+            it = _cellSources.erase(it);
+        } else {
+            it->second.position /= (float)numStreams;
+            ++it;
+        }
+    }
+
+    // drop the beds of cells that no longer hold a listener, keep the others allocated
+    for (auto it = _beds.begin(); it != _beds.end();) {
+        if (listenerCells.find(it->first) == listenerCells.end()) {
+            it = _beds.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    _numBedSources = 0;
+
+    for (const auto& cell : listenerCells) {
+        CellBeds& cellBeds = _beds[cell];
+        glm::vec3 cellCenter = grid.getCellCenter(cell);
+
+        for (int type = 0; type < NUM_SOURCE_TYPES; type++) {
+            Bed& bed = cellBeds.beds[type];
+            bed.fill(0.0f);
+
+            for (const auto& cellSource : _cellSources) {
+                const CellSource& source = cellSource.second;
+                if (source.numStreams[type] > 0 && AudioMixerSpatialGrid::isFarField(cell, cellSource.first)) {
+                    addSource(source.samples[type].data(), 1.0f, source.position, cellCenter, bed);
+                    _numBedSources += source.numStreams[type];
+                }
+            }
+        }
+    }
+}
+
+void AudioMixerCrowdBeds::clear() {
+    _cellSources.clear();
+    _beds.clear();
+    _numBedSources = 0;
+}
+
+bool AudioMixerCrowdBeds::mixBeds(const Cell& cell, float avatarGain, float injectorGain, Bed& mix) const {
+    auto it = _beds.find(cell);
+    if (it == _beds.end()) {
+        return false;
+    }
+
+    const Bed& avatars = it->second.beds[AVATARS];
+    const Bed& injectors = it->second.beds[INJECTORS];
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC; i++) {
+        mix[i] = avatarGain * avatars[i] + injectorGain * injectors[i];
+    }
+    return true;
+}
+
+void AudioMixerCrowdBeds::addStream(const PositionalAudioStream& stream, float gain, const Cell& listenerCell,
+                                    const AudioMixerSpatialGrid& grid, Bed& mix) const {
+    auto it = _cellSources.find(grid.getCell(stream.getPosition()));
+    if (it == _cellSources.end()) {
+        return;
+    }
+
+    // the stream was panned from the position of its cell's source, so its share of the bed is panned from there too
+    addSource(stream.getLastPopMonoFloatSamples(), gain * getStreamGain(stream), it->second.position,
+              grid.getCellCenter(listenerCell), mix);
+}
+
+void AudioMixerCrowdBeds::addSource(const float* samples, float gain, const glm::vec3& position,
+                                    const glm::vec3& cellCenter, Bed& bed) {
+    glm::vec3 relativePosition = position - cellCenter;
+    float distance = glm::max(glm::length(relativePosition), EPSILON);
+
+    // distance attenuation as in AudioMixerSlave, without zone or off-axis attenuation
+    // it is worked out for a unit gain, so a stream's share is taken out with the attenuation it went in with
+    float attenuation = applyDistanceAttenuation(1.0f, AudioMixer::getAttenuationPerDoublingInDistance(), distance);
+    if (attenuation == 0.0f) {
+        return;
+    }
+    gain *= attenuation;
+
+    // convert from Y-up (OpenGL) to Z-up (Ambisonic) coordinate system
+    glm::vec3 direction = relativePosition / distance;
+    float x = -direction.z;
+    float y = -direction.x;
+    float z = direction.y;
+
+    // pan into ambiX (ACN/SN3D) channel order: W, Y, Z, X
+    for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+        float sample = gain * samples[i];
+        bed[4*i+0] += sample;
+        bed[4*i+1] += y * sample;
+        bed[4*i+2] += z * sample;
+        bed[4*i+3] += x * sample;
+    }
+}
@@ -0,0 +1,82 @@
+//
+//  AudioMixerCrowdBeds.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerCrowdBeds_h
+#define hifi_AudioMixerCrowdBeds_h
+
+#include <array>
+#include <unordered_map>
+
+#include <AudioConstants.h>
+
+#include "AudioMixerSpatialGrid.h"
+
+// First-order ambisonic "crowd beds", used while the mixer is throttling.
+// The audible mono streams of each occupied grid cell are first summed once per frame into a single source,
+// placed at their mean position. For every grid cell holding a listener, the sources of its far-field cells are
+// then panned into a world-aligned ambiX bed, so a bed costs one pan per occupied cell rather than one per stream.
+// Avatar and injector streams have separate beds, so that each listener in the cell can mix them with its own
+// master gains, and take out or adjust the few streams it doesn't hear like the others do (ignores, ignore boxes,
+// per-avatar gains). Each listener renders that mix with its own orientation, instead of dropping its distant
+// streams, so the cost per listener stays constant as the crowd grows.
+//   The beds are written by the AudioMixer thread and are read-only while slaves are mixing.
+class AudioMixerCrowdBeds {
+public:
+    using ConstIter = NodeList::const_iterator;
+    using Cell = AudioMixerSpatialGrid::Cell;
+    using Bed = std::array<float, AudioConstants::NETWORK_FRAME_SAMPLES_AMBISONIC>;
+
+    // whether the stream is summed into the beds of the cells it is in the far field of
+    static bool isInBed(const PositionalAudioStream& stream);
+
+    void setEnabled(bool enabled) { _isEnabled = enabled; }
+    bool isEnabled() const { return _isEnabled; }
+
+    void rebuild(ConstIter begin, ConstIter end, const AudioMixerSpatialGrid& grid);
+    void clear();
+
+    // mixes the avatar and injector beds of the cell into mix with the given gains,
+    // returns false if no bed was built for this cell
+    bool mixBeds(const Cell& cell, float avatarGain, float injectorGain, Bed& mix) const;
+    // adds the stream's share of the bed of the listener's cell, times gain, to mix
+    // the stream must be in the bed, i.e. in it and in the far field of the listener's cell
+    void addStream(const PositionalAudioStream& stream, float gain, const Cell& listenerCell,
+                   const AudioMixerSpatialGrid& grid, Bed& mix) const;
+
+    int getNumBeds() const { return (int)_beds.size(); }
+    int getNumBedSources() const { return _numBedSources; }
+
+private:
+    using Samples = std::array<float, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL>;
+
+    enum SourceType { AVATARS = 0, INJECTORS, NUM_SOURCE_TYPES };
+
+    // the summed audible mono streams of one grid cell
+    struct CellSource {
+        Samples samples[NUM_SOURCE_TYPES];
+        glm::vec3 position;
+        int numStreams[NUM_SOURCE_TYPES] { 0, 0 };
+    };
+    struct CellBeds {
+        Bed beds[NUM_SOURCE_TYPES];
+    };
+
+    static SourceType getSourceType(const PositionalAudioStream& stream);
+    static float getStreamGain(const PositionalAudioStream& stream);
+    static void addSource(const float* samples, float gain, const glm::vec3& position, const glm::vec3& cellCenter,
+                          Bed& bed);
+
+    bool _isEnabled { false };
+    int _numBedSources { 0 };
+    std::unordered_map<Cell, CellSource, AudioMixerSpatialGrid::CellHash> _cellSources;
+    std::unordered_map<Cell, CellBeds, AudioMixerSpatialGrid::CellHash> _beds;
+};
+
+#endif // hifi_AudioMixerCrowdBeds_h
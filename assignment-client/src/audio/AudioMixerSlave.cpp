@@ -229,6 +229,74 @@ void AudioMixerSlave::addStreams(Node& listener, AudioMixerClientData& listenerD
     }
 }
 
+void AudioMixerSlave::unparkStreams(AudioMixerClientData& listenerData, AvatarAudioStream& listenerAudioStream,
+                                    const AudioMixerSpatialGrid::Cell& listenerCell, bool isUnparkingAll) {
+    auto& streams = listenerData.getStreams();
+    auto& parked = streams.parked;
+
+    if (parked.empty()) {
+        return;
+    }
+
+    // parked streams are not visited by the loops in prepareMix, so drop the removed ones here
+    for (const auto& removedStream : _sharedData.removedStreams) {
+        parked.erase(AudioMixerSpatialGrid::getStreamKey(removedStream));
+    }
+    if (!_sharedData.removedNodes.empty()) {
+        for (auto it = parked.begin(); it != parked.end();) {
+            if (contains(_sharedData.removedNodes, it->first.nodeLocalID)) {
+                it = parked.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    bool isThrottling = _numToRetain != -1;
+
+    auto unpark = [&](AudioMixerClientData::ParkedStreams::iterator it) {
+        auto& stream = it->second.stream;
+
+        // the HRTF parameters were not updated while parked, bring them up to date before the stream can be mixed
+        if (!isThrottling) {
+            updateHRTFParameters(stream, listenerAudioStream, listenerData.getMasterAvatarGain(),
+                                 listenerData.getMasterInjectorGain());
+        }
+
+        if (it->second.isSkipped) {
+            streams.skipped.push_back(move(stream));
+        } else {
+            streams.inactive.push_back(move(stream));
+        }
+        return parked.erase(it);
+    };
+
+    if (isUnparkingAll) {
+        for (auto it = parked.begin(); it != parked.end();) {
+            it = unpark(it);
+        }
+        return;
+    }
+
+    const auto& spatialGrid = _sharedData.spatialGrid;
+
+    // streams that came near the listener, or that the listener came near
+    spatialGrid.forEachNeighbourStream(listenerCell, [&](const AudioMixerSpatialGrid::StreamKey& key) {
+        auto it = parked.find(key);
+        if (it != parked.end()) {
+            unpark(it);
+        }
+    });
+
+    // streams that started talking
+    for (const auto& key : spatialGrid.getAudibleStreams()) {
+        auto it = parked.find(key);
+        if (it != parked.end()) {
+            unpark(it);
+        }
+    }
+}
+
 bool shouldBeRemoved(const MixableStream& stream, const AudioMixerSlave::SharedData& sharedData) {
     return (contains(sharedData.removedNodes, stream.nodeStreamID.nodeLocalID) ||
             contains(sharedData.removedStreams, stream.nodeStreamID));
@@ -320,12 +388,58 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
 
     addStreams(*listener, *listenerData);
 
+    // far-field streams that are skipped or quiet are parked, and only evaluated again once they are in the
+    // listener's neighbourhood cells or audible, so the work per listener follows its surroundings, not the crowd
+    // everything is unparked while ignore or solo changes are staged (they are only visible during this frame)
+    const auto& spatialGrid = _sharedData.spatialGrid;
+    bool hasStagedChanges = !listenerData->getNewIgnoredNodeIDs().empty() ||
+                            !listenerData->getNewUnignoredNodeIDs().empty() ||
+                            !listenerData->getNewIgnoringNodeIDs().empty() ||
+                            !listenerData->getNewUnignoringNodeIDs().empty() ||
+                            listenerData->hasStagedSoloChanges();
+    bool isCullingFarField = spatialGrid.isEnabled() && !hasStagedChanges;
+    AudioMixerSpatialGrid::Cell listenerCell;
+    if (spatialGrid.isEnabled()) {
+        listenerCell = spatialGrid.getCell(listenerAudioStream->getPosition());
+    }
+
+    unparkStreams(*listenerData, *listenerAudioStream, listenerCell, !isCullingFarField);
+
+    auto isFarField = [&](const MixableStream& stream) {
+        return spatialGrid.isFarField(listenerCell, AudioMixerSpatialGrid::getStreamKey(stream.nodeStreamID));
+    };
+    auto park = [&](MixableStream& stream, bool isSkipped) {
+        auto key = AudioMixerSpatialGrid::getStreamKey(stream.nodeStreamID);
+        streams.parked.emplace(key, AudioMixerClientData::ParkedStream { move(stream), isSkipped });
+    };
+
+    // while throttling, far-field mono streams are heard through the crowd beds of the listener's cell, mixed with
+    // its master gains into its own copy, where the streams it skips or has a gain for are then taken out or adjusted
+    // soloing skips nearly every stream, so it doesn't use the beds
+    const auto& crowdBeds = _sharedData.crowdBeds;
+    bool hasCrowdBed = isThrottling && crowdBeds.isEnabled() && spatialGrid.isEnabled() && !isSoloing &&
+        crowdBeds.mixBeds(listenerCell, listenerData->getMasterAvatarGain(), listenerData->getMasterInjectorGain(),
+                          _crowdBed);
+    int numCrowdBedStreams = 0;
+
+    auto isInCrowdBed = [&](const MixableStream& stream) {
+        return hasCrowdBed && AudioMixerCrowdBeds::isInBed(*stream.positionalStream) && isFarField(stream);
+    };
+    auto adjustCrowdBed = [&](const MixableStream& stream, float gainAdjustment) {
+        const auto& positionalStream = *stream.positionalStream;
+        float masterGain = positionalStream.getType() == PositionalAudioStream::Injector ?
+            listenerData->getMasterInjectorGain() : listenerData->getMasterAvatarGain();
+        crowdBeds.addStream(positionalStream, masterGain * gainAdjustment, listenerCell, spatialGrid, _crowdBed);
+    };
+
     // Process skipped streams
     erase_if(streams.skipped, [&](MixableStream& stream) {
         if (shouldBeRemoved(stream, _sharedData)) {
             return true;
         }
 
+        ++stats.pairsEvaluated;
+
         if (!shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
             if (shouldBeInactive(stream)) {
                 streams.inactive.push_back(move(stream));
@@ -337,6 +451,15 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
+        if (isInCrowdBed(stream)) {
+            adjustCrowdBed(stream, -1.0f);
+        }
+
+        if (isCullingFarField && isFarField(stream)) {
+            park(stream, true);
+            return true;
+        }
+
         if (!isThrottling) {
             updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
                                  listenerData->getMasterInjectorGain());
@@ -350,7 +473,13 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
+        ++stats.pairsEvaluated;
+
         if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
+            // the skipped streams were already looked at
+            if (isInCrowdBed(stream)) {
+                adjustCrowdBed(stream, -1.0f);
+            }
             streams.skipped.push_back(move(stream));
             ++stats.inactiveToSkipped;
             return true;
@@ -362,6 +491,11 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
+        if (isCullingFarField && isFarField(stream)) {
+            park(stream, false);
+            return true;
+        }
+
         if (!isThrottling) {
             updateHRTFParameters(stream, *listenerAudioStream, listenerData->getMasterAvatarGain(),
                                  listenerData->getMasterInjectorGain());
@@ -375,10 +509,33 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
             return true;
         }
 
+        ++stats.pairsEvaluated;
+
         if (isThrottling) {
             // we're throttling, so we need to update the approximate volume for any un-skipped streams
             // unless this is simply for an echo (in which case the approx volume is 1.0)
-            stream.approximateVolume = approximateVolume(stream, listenerAudioStream);
+            if (isInCrowdBed(stream)) {
+                if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
+                    adjustCrowdBed(stream, -1.0f);
+                    resetHRTFState(stream);
+                    streams.skipped.push_back(move(stream));
+                    ++stats.activeToSkipped;
+                    return true;
+                }
+
+                // the gain this listener set for the avatar
+                float avatarGain = stream.hrtf->getGainAdjustment() / HRTF_GAIN;
+                if (stream.nodeStreamID.streamID.isNull() && avatarGain != 1.0f) {
+                    adjustCrowdBed(stream, avatarGain - 1.0f);
+                }
+
+                // already in the crowd bed, so sort it behind every individually mixed stream
+                stream.approximateVolume = -1.0f;
+                ++numCrowdBedStreams;
+                ++stats.crowdBedStreams;
+            } else {
+                stream.approximateVolume = approximateVolume(stream, listenerAudioStream);
+            }
         } else {
             if (shouldBeSkipped(stream, *listener, *listenerAudioStream, *listenerData)) {
                 addStream(stream, *listenerAudioStream, 0.0f, 0.0f, isSoloing);
@@ -405,7 +562,8 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
 
     if (isThrottling) {
         // since we're throttling, we need to partition the mixable into throttled and unthrottled streams
-        int numToRetain = min(_numToRetain, (int)streams.active.size()); // Make sure we don't overflow
+        // streams carried by the crowd bed are never retained
+        int numToRetain = min(_numToRetain, (int)streams.active.size() - numCrowdBedStreams); // Make sure we don't overflow
         auto throttlePoint = begin(streams.active) + numToRetain;
 
         std::nth_element(streams.active.begin(), throttlePoint, streams.active.end(),
@@ -460,6 +618,30 @@ bool AudioMixerSlave::prepareMix(const SharedNodePointer& listener) {
         });
     }
 
+    // render the HRTF of all mono sources gathered above
+    renderHRTFBatch();
+
+    if (hasCrowdBed) {
+        // the bed is in world orientation, so rotate it into the listener's frame
+        glm::quat relativeOrientation = glm::inverse(listenerAudioStream->getOrientation());
+
+        // convert from Y-up (OpenGL) to Z-up (Ambisonic) coordinate system
+        float qw = relativeOrientation.w;
+        float qx = -relativeOrientation.z;
+        float qy = -relativeOrientation.x;
+        float qz = relativeOrientation.y;
+
+        const int HRTF_DATASET_INDEX = 1;
+        // the master gains were applied when mixing the beds
+        listenerData->crowdBedFOA.render(_crowdBed.data(), _mixSamples, HRTF_DATASET_INDEX, qw, qx, qy, qz, 1.0f,
+                                         AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        ++stats.crowdBedRenders;
+    } else {
+        // start from a clean rotation state the next time this listener hears a bed
+        listenerData->crowdBedFOA.reset();
+    }
+
+    stats.pairsCulled += (int)streams.parked.size();
     stats.skipped += (int)streams.skipped.size();
     stats.inactive += (int)streams.inactive.size();
     stats.active += (int)streams.active.size();
@@ -510,8 +692,6 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
                                                    relativePosition, distance));
     float azimuth = isEcho ? 0.0f : computeAzimuth(listeningNodeStream, listeningNodeStream, relativePosition);
 
-    const int HRTF_DATASET_INDEX = 1;
-
     if (!streamToAdd->lastPopSucceeded()) {
         bool forceSilentBlock = true;
 
@@ -535,44 +715,54 @@ void AudioMixerSlave::addStream(AudioMixerClientData::MixableStream& mixableStre
             // call renderSilent with a forced silent block to reduce artifacts
             // (this is not done for stereo streams since they do not go through the HRTF)
             if (!streamToAdd->isStereo() && !isEcho) {
-                static int16_t silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
-                mixableStream.hrtf->render(silentMonoBlock, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
-                ++stats.hrtfRenders;
+                static const float silentMonoBlock[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] = {};
+                queueHRTFRender(mixableStream, silentMonoBlock, azimuth, distance, gain);
             }
 
             return;
         }
     }
 
-    // grab the stream from the ring buffer
-    AudioRingBuffer::ConstIterator streamPopOutput = streamToAdd->getLastPopOutput();
-
+    // the last popped frame was decoded once for all listeners while processing packets
     if (streamToAdd->isStereo()) {
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
-
         // stereo sources are not passed through HRTF
-        mixableStream.hrtf->mixStereo(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        mixableStream.hrtf->mixStereo(streamToAdd->getLastPopSamples(), _mixSamples, gain,
+                                      AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualStereoMixes;
     } else if (isEcho) {
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-
         // echo sources are not passed through HRTF
-        mixableStream.hrtf->mixMono(_bufferSamples, _mixSamples, gain, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        mixableStream.hrtf->mixMono(streamToAdd->getLastPopSamples(), _mixSamples, gain,
+                                    AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
 
         ++stats.manualEchoMixes;
     } else {
 
-        streamPopOutput.readSamples(_bufferSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+        queueHRTFRender(mixableStream, streamToAdd->getLastPopMonoFloatSamples(), azimuth, distance, gain);
+    }
+}
+
+void AudioMixerSlave::queueHRTFRender(AudioMixerClientData::MixableStream& mixableStream, const float* input,
+                                      float azimuth, float distance, float gain) {
+    _hrtfJobs.push_back({ mixableStream.hrtf.get(), input, azimuth, distance, gain });
 
-        mixableStream.hrtf->render(_bufferSamples, _mixSamples, HRTF_DATASET_INDEX, azimuth, distance, gain,
-                                   AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
-        ++stats.hrtfRenders;
+    ++stats.hrtfRenders;
+}
+
+void AudioMixerSlave::renderHRTFBatch() {
+    if (_hrtfJobs.empty()) {
+        return;
     }
+
+    const int HRTF_DATASET_INDEX = 1;
+
+    AudioHRTF::renderBatch(_hrtfJobs.data(), (int)_hrtfJobs.size(), _mixSamples, HRTF_DATASET_INDEX,
+                           AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+    ++stats.hrtfBatches;
+
+    _hrtfJobs.clear();
 }
 
 void AudioMixerSlave::updateHRTFParameters(AudioMixerClientData::MixableStream& mixableStream,
@@ -771,6 +961,10 @@ float computeGain(float masterAvatarGain,
         }
     }
 
+    return applyDistanceAttenuation(gain, attenuationPerDoublingInDistance, distance);
+}
+
+float applyDistanceAttenuation(float gain, float attenuationPerDoublingInDistance, float distance) {
     if (attenuationPerDoublingInDistance < 0.0f) {
         // translate a negative zone setting to distance limit
         const float MIN_DISTANCE_LIMIT = ATTN_DISTANCE_REF + 1.0f;  // silent after 1m
@@ -17,6 +17,8 @@
 #include <tbb/concurrent_vector.h>
 #endif
 
+#include <vector>
+
 #include <AABox.h>
 #include <AudioHRTF.h>
 #include <AudioRingBuffer.h>
@@ -26,6 +28,8 @@
 #include <PositionalAudioStream.h>
 
 #include "AudioMixerClientData.h"
+#include "AudioMixerCrowdBeds.h"
+#include "AudioMixerSpatialGrid.h"
 #include "AudioMixerStats.h"
 
 class AvatarAudioStream;
@@ -39,6 +43,8 @@ public:
         AudioMixerClientData::ConcurrentAddedStreams addedStreams;
         std::vector<Node::LocalID> removedNodes;
         std::vector<NodeIDStreamID> removedStreams;
+        AudioMixerSpatialGrid spatialGrid;
+        AudioMixerCrowdBeds crowdBeds;
     };
 
     AudioMixerSlave(SharedData& sharedData) : _sharedData(sharedData) {};
@@ -69,12 +75,28 @@ private:
                               float masterInjectorGain);
     void resetHRTFState(AudioMixerClientData::MixableStream& mixableStream);
 
+    // queue a mono source for the batched HRTF render, input must remain valid until renderHRTFBatch
+    void queueHRTFRender(AudioMixerClientData::MixableStream& mixableStream, const float* input,
+                         float azimuth, float distance, float gain);
+    // render all queued mono sources into the mix
+    void renderHRTFBatch();
+
     void addStreams(Node& listener, AudioMixerClientData& listenerData);
 
+    // move parked far-field streams that need a look this frame back into the skipped and inactive streams
+    void unparkStreams(AudioMixerClientData& listenerData, AvatarAudioStream& listenerAudioStream,
+                       const AudioMixerSpatialGrid::Cell& listenerCell, bool isUnparkingAll);
+
     // mixing buffers
     float _mixSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
     int16_t _bufferSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO];
 
+    // the crowd beds of the current listener's cell, as it hears them
+    AudioMixerCrowdBeds::Bed _crowdBed;
+
+    // batched HRTF renders for the current listener (capacity is retained across listeners)
+    std::vector<AudioHRTF::RenderJob> _hrtfJobs;
+
     // frame state
     ConstIter _begin;
     ConstIter _end;
@@ -84,4 +106,7 @@ private:
     SharedData& _sharedData;
 };
 
+// attenuate a source gain with distance, using the domain or audio zone attenuation coefficient
+float applyDistanceAttenuation(float gain, float attenuationPerDoublingInDistance, float distance);
+
 #endif // hifi_AudioMixerSlave_h
@@ -22,11 +22,10 @@ void AudioMixerSlaveThread::run() {
     while (true) {
         wait();
 
-        // iterate over all available nodes
-        SharedNodePointer node;
-        while (try_pop(node)) {
+        // iterate over our share of the nodes, then help the other threads with theirs
+        _pool._scheduler.run(_index, [&](const SharedNodePointer& node) {
             (this->*_function)(node);
-        }
+        });
 
         bool stopping = _stop;
         notify(stopping);
@@ -64,14 +63,10 @@ void AudioMixerSlaveThread::notify(bool stopping) {
     _pool._poolCondition.notify_one();
 }
 
-bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node) {
-    return _pool._queue.try_pop(node);
-}
-
 void AudioMixerSlavePool::processPackets(ConstIter begin, ConstIter end) {
     _function = &AudioMixerSlave::processPackets;
     _configure = [](AudioMixerSlave& slave) {};
-    run(begin, end);
+    run(begin, end, _packetCostHints);
 }
 
 void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame, int numToRetain) {
@@ -80,17 +75,22 @@ void AudioMixerSlavePool::mix(ConstIter begin, ConstIter end, unsigned int frame
         slave.configureMix(_begin, _end, frame, numToRetain);
     };
 
-    run(begin, end);
+    run(begin, end, _mixCostHints);
 }
 
-void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
+void AudioMixerSlavePool::run(ConstIter begin, ConstIter end, CostHints& costHints) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
+    // deal the nodes to the threads, using what each cost on the previous frame
+    _scheduler.clear();
     std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
+        auto hint = costHints.find(node->getLocalID());
+        _scheduler.push(node, hint != costHints.end() ? hint->second : 0);
     });
+    _scheduler.distribute();
+
+    auto start = p_high_resolution_clock::now();
 
     {
         Lock lock(_mutex);
@@ -108,7 +108,28 @@ void AudioMixerSlavePool::run(ConstIter begin, ConstIter end) {
         assert(_numStarted == _numThreads);
     }
 
-    assert(_queue.empty());
+    assert(_scheduler.isEmpty());
+
+    auto end = p_high_resolution_clock::now();
+    Scheduler::Cost runTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    // this frame's costs are the next frame's hints
+    costHints.clear();
+    for (int i = 0; i < _scheduler.getNumTasks(); ++i) {
+        costHints[_scheduler.getTask(i)->getLocalID()] = _scheduler.getTaskCost(i);
+    }
+
+    for (int i = 0; i < _numThreads; ++i) {
+        const auto& workerStats = _scheduler.getWorkerStats(i);
+        auto& stats = _threadStats[i];
+        stats.busyTime += workerStats.busyTime;
+        stats.idleTime += runTime - std::min(workerStats.busyTime, runTime);
+        stats.numTasks += workerStats.numTasks;
+        stats.numStolen += workerStats.numStolen;
+    }
+
+    // release the node pointers until the next frame
+    _scheduler.clear();
 }
 
 void AudioMixerSlavePool::each(std::function<void(AudioMixerSlave& slave)> functor) {
@@ -130,6 +151,24 @@ void AudioMixerSlavePool::queueStats(QJsonObject& stats) {
 }
 #endif // DEBUG_EVENT_QUEUE
 
+void AudioMixerSlavePool::threadStats(QJsonObject& stats, int numFrames) {
+    const int NSEC_PER_USEC = 1000;
+    float usecPerFrame = (float)NSEC_PER_USEC * (float)std::max(numFrames, 1);
+
+    for (int i = 0; i < (int)_threadStats.size(); ++i) {
+        auto& threadStats = _threadStats[i];
+
+        QJsonObject threadObject;
+        threadObject["us_busy_per_frame"] = (float)threadStats.busyTime / usecPerFrame;
+        threadObject["us_idle_per_frame"] = (float)threadStats.idleTime / usecPerFrame;
+        threadObject["nodes_per_frame"] = (float)threadStats.numTasks / (float)std::max(numFrames, 1);
+        threadObject["stolen_per_frame"] = (float)threadStats.numStolen / (float)std::max(numFrames, 1);
+        stats[QString("audio_thread_%1").arg(i)] = threadObject;
+
+        threadStats = Scheduler::WorkerStats();
+    }
+}
+
 void AudioMixerSlavePool::setNumThreads(int numThreads) {
     // clamp to allowed size
     {
@@ -160,7 +199,7 @@ void AudioMixerSlavePool::resize(int numThreads) {
     if (numThreads > _numThreads) {
         // start new slaves
         for (int i = 0; i < numThreads - _numThreads; ++i) {
-            auto slave = new AudioMixerSlaveThread(*this, _workerSharedData);
+            auto slave = new AudioMixerSlaveThread(*this, _workerSharedData, _numThreads + i);
             QObject::connect(slave, &QThread::started, [] { setThreadName("AudioMixerSlaveThread"); });
             slave->start();
             _slaves.emplace_back(slave);
@@ -200,5 +239,7 @@ void AudioMixerSlavePool::resize(int numThreads) {
     }
 
     _numThreads = _numStarted = _numFinished = numThreads;
+    _scheduler.setNumWorkers(numThreads);
+    _threadStats.resize(numThreads);
     assert(_numThreads == (int)_slaves.size());
 }
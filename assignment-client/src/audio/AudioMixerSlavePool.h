@@ -14,11 +14,13 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
+#include <QJsonObject>
 #include <QThread>
 #include <shared/QtHelpers.h>
-#include <TBBHelpers.h>
+#include <WorkStealingScheduler.h>
 
 #include "AudioMixerSlave.h"
 
@@ -31,8 +33,8 @@ class AudioMixerSlaveThread : public QThread, public AudioMixerSlave {
     using Lock = std::unique_lock<Mutex>;
 
 public:
-    AudioMixerSlaveThread(AudioMixerSlavePool& pool, AudioMixerSlave::SharedData& sharedData)
-        : AudioMixerSlave(sharedData), _pool(pool) {}
+    AudioMixerSlaveThread(AudioMixerSlavePool& pool, AudioMixerSlave::SharedData& sharedData, int index)
+        : AudioMixerSlave(sharedData), _pool(pool), _index(index) {}
 
     void run() override final;
 
@@ -41,9 +43,9 @@ private:
 
     void wait();
     void notify(bool stopping);
-    bool try_pop(SharedNodePointer& node);
 
     AudioMixerSlavePool& _pool;
+    int _index;
     void (AudioMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
     bool _stop { false };
 };
@@ -51,7 +53,8 @@ private:
 // Slave pool for audio mixers
 //   AudioMixerSlavePool is not thread-safe! It should be instantiated and used from a single thread.
 class AudioMixerSlavePool {
-    using Queue = tbb::concurrent_queue<SharedNodePointer>;
+    using Scheduler = WorkStealingScheduler<SharedNodePointer>;
+    using CostHints = std::unordered_map<Node::LocalID, Scheduler::Cost>;
     using Mutex = std::mutex;
     using Lock = std::unique_lock<Mutex>;
     using ConditionVariable = std::condition_variable;
@@ -76,18 +79,20 @@ public:
     void queueStats(QJsonObject& stats);
 #endif
 
+    // per-thread busy and idle time since the last call, averaged over the given number of frames
+    void threadStats(QJsonObject& stats, int numFrames);
+
     void setNumThreads(int numThreads);
     int numThreads() { return _numThreads; }
 
 private:
-    void run(ConstIter begin, ConstIter end);
+    void run(ConstIter begin, ConstIter end, CostHints& costHints);
     void resize(int numThreads);
 
     std::vector<std::unique_ptr<AudioMixerSlaveThread>> _slaves;
 
     friend void AudioMixerSlaveThread::wait();
     friend void AudioMixerSlaveThread::notify(bool stopping);
-    friend bool AudioMixerSlaveThread::try_pop(SharedNodePointer& node);
 
     // synchronization state
     Mutex _mutex;
@@ -101,10 +106,16 @@ private:
     int _numStopped { 0 }; // guarded by _mutex
 
     // frame state
-    Queue _queue;
+    Scheduler _scheduler;
     ConstIter _begin;
     ConstIter _end;
 
+    // what each node cost on the previous frame, by job
+    CostHints _packetCostHints;
+    CostHints _mixCostHints;
+
+    std::vector<Scheduler::WorkerStats> _threadStats;
+
     AudioMixerSlave::SharedData& _workerSharedData;
 };
 
@@ -0,0 +1,89 @@
+//
+//  AudioMixerSpatialGrid.cpp
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioMixerSpatialGrid.h"
+
+#include <algorithm>
+
+#include <QtCore/QUuid>
+
+#include "AudioMixerClientData.h"
+
+size_t AudioMixerSpatialGrid::CellHash::operator()(const Cell& cell) const {
+    // large primes, as in Teschner et al. "Optimized Spatial Hashing for Collision Detection"
+    return ((size_t)cell.x * 73856093) ^ ((size_t)cell.y * 19349663) ^ ((size_t)cell.z * 83492791);
+}
+
+size_t AudioMixerSpatialGrid::StreamKeyHash::operator()(const StreamKey& key) const {
+    return qHash(key.streamID, key.nodeLocalID);
+}
+
+void AudioMixerSpatialGrid::rebuild(ConstIter begin, ConstIter end) {
+    // keep the per-cell vectors allocated, cells are usually occupied again on the next frame
+    for (auto& cellStreams : _cellStreams) {
+        cellStreams.second.clear();
+    }
+    _streamCells.clear();
+    _audibleStreams.clear();
+
+    if (!isEnabled()) {
+        _cellStreams.clear();
+        return;
+    }
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        AudioMixerClientData* nodeData = static_cast<AudioMixerClientData*>(node->getLinkedData());
+        if (nodeData) {
+            for (auto& stream : nodeData->getAudioStreams()) {
+                StreamKey key { node->getLocalID(), stream->getStreamIdentifier() };
+                Cell cell = getCell(stream->getPosition());
+
+                _cellStreams[cell].push_back(key);
+                _streamCells[key] = cell;
+
+                if (stream->lastPopSucceeded() && stream->getLastPopOutputLoudness() != 0.0f) {
+                    _audibleStreams.push_back(key);
+                }
+            }
+        }
+    });
+
+    // drop the cells that were left empty
+    for (auto it = _cellStreams.begin(); it != _cellStreams.end();) {
+        if (it->second.empty()) {
+            it = _cellStreams.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+AudioMixerSpatialGrid::Cell AudioMixerSpatialGrid::getCell(const glm::vec3& position) const {
+    return Cell(glm::floor(position / _cellSize));
+}
+
+glm::vec3 AudioMixerSpatialGrid::getCellCenter(const Cell& cell) const {
+    return (glm::vec3(cell) + 0.5f) * _cellSize;
+}
+
+bool AudioMixerSpatialGrid::isFarField(const Cell& listenerCell, const StreamKey& key) const {
+    auto it = _streamCells.find(key);
+    if (it == _streamCells.end()) {
+        // added after the grid was built, always treat as near
+        return false;
+    }
+
+    return isFarField(listenerCell, it->second);
+}
+
+bool AudioMixerSpatialGrid::isFarField(const Cell& listenerCell, const Cell& streamCell) {
+    Cell offset = glm::abs(streamCell - listenerCell);
+    return glm::max(offset.x, glm::max(offset.y, offset.z)) > 1;
+}
@@ -0,0 +1,99 @@
+//
+//  AudioMixerSpatialGrid.h
+//  assignment-client/src/audio
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AudioMixerSpatialGrid_h
+#define hifi_AudioMixerSpatialGrid_h
+
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <NodeList.h>
+#include <PositionalAudioStream.h>
+
+// Uniform spatial hash of audio stream positions, rebuilt once per frame before mixing.
+// Streams in the cells around a listener are its near field; everything else is its far field.
+// The AudioMixerSlave parks far-field streams that are skipped or quiet, and only looks at them again
+// once they are in the listener's neighbourhood cells or audible.
+//   Streams are identified by node local ID and stream ID, so nothing here can outlive a stream.
+//   The grid is written by the AudioMixer thread and is read-only while slaves are mixing.
+class AudioMixerSpatialGrid {
+public:
+    using ConstIter = NodeList::const_iterator;
+    using Cell = glm::ivec3;
+    struct CellHash {
+        size_t operator()(const Cell& cell) const;
+    };
+
+    struct StreamKey {
+        Node::LocalID nodeLocalID;
+        StreamID streamID;
+
+        bool operator==(const StreamKey& other) const {
+            return nodeLocalID == other.nodeLocalID && streamID == other.streamID;
+        }
+    };
+    struct StreamKeyHash {
+        size_t operator()(const StreamKey& key) const;
+    };
+    static StreamKey getStreamKey(const NodeIDStreamID& nodeStreamID) {
+        return { nodeStreamID.nodeLocalID, nodeStreamID.streamID };
+    }
+
+    using StreamKeys = std::vector<StreamKey>;
+
+    // a cell size of zero disables culling
+    void setCellSize(float cellSize) { _cellSize = glm::max(cellSize, 0.0f); }
+    float getCellSize() const { return _cellSize; }
+    bool isEnabled() const { return _cellSize > 0.0f; }
+
+    void rebuild(ConstIter begin, ConstIter end);
+
+    Cell getCell(const glm::vec3& position) const;
+    glm::vec3 getCellCenter(const Cell& cell) const;
+
+    // calls f with the key of every stream in the cell and the cells neighbouring it
+    template <typename F>
+    void forEachNeighbourStream(const Cell& cell, F f) const;
+
+    // true if the stream is outside the cells neighbouring the listener cell
+    bool isFarField(const Cell& listenerCell, const StreamKey& key) const;
+    static bool isFarField(const Cell& listenerCell, const Cell& streamCell);
+
+    // streams that popped a non-silent frame this frame
+    const StreamKeys& getAudibleStreams() const { return _audibleStreams; }
+
+    int getNumOccupiedCells() const { return (int)_cellStreams.size(); }
+
+private:
+    float _cellSize { 0.0f };
+    std::unordered_map<Cell, StreamKeys, CellHash> _cellStreams;
+    std::unordered_map<StreamKey, Cell, StreamKeyHash> _streamCells;
+    StreamKeys _audibleStreams;
+};
+
+template <typename F>
+void AudioMixerSpatialGrid::forEachNeighbourStream(const Cell& cell, F f) const {
+    for (int x = -1; x <= 1; ++x) {
+        for (int y = -1; y <= 1; ++y) {
+            for (int z = -1; z <= 1; ++z) {
+                auto it = _cellStreams.find(cell + Cell(x, y, z));
+                if (it != _cellStreams.end()) {
+                    for (const auto& key : it->second) {
+                        f(key);
+                    }
+                }
+            }
+        }
+    }
+}
+
+#endif // hifi_AudioMixerSpatialGrid_h
@@ -21,6 +21,7 @@ void AudioMixerStats::reset() {
     hrtfRenders = 0;
     hrtfResets = 0;
     hrtfUpdates = 0;
+    hrtfBatches = 0;
 
     manualStereoMixes = 0;
     manualEchoMixes = 0;
@@ -36,6 +37,12 @@ void AudioMixerStats::reset() {
     inactive = 0;
     active = 0;
 
+    pairsEvaluated = 0;
+    pairsCulled = 0;
+
+    crowdBedRenders = 0;
+    crowdBedStreams = 0;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime = 0;
 #endif
@@ -51,6 +58,7 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     hrtfRenders += otherStats.hrtfRenders;
     hrtfResets += otherStats.hrtfResets;
     hrtfUpdates += otherStats.hrtfUpdates;
+    hrtfBatches += otherStats.hrtfBatches;
 
     manualStereoMixes += otherStats.manualStereoMixes;
     manualEchoMixes += otherStats.manualEchoMixes;
@@ -66,6 +74,12 @@ void AudioMixerStats::accumulate(const AudioMixerStats& otherStats) {
     inactive += otherStats.inactive;
     active += otherStats.active;
 
+    pairsEvaluated += otherStats.pairsEvaluated;
+    pairsCulled += otherStats.pairsCulled;
+
+    crowdBedRenders += otherStats.crowdBedRenders;
+    crowdBedStreams += otherStats.crowdBedStreams;
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     mixTime += otherStats.mixTime;
 #endif
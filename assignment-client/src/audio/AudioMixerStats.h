@@ -26,6 +26,7 @@ struct AudioMixerStats {
     int hrtfRenders { 0 };
     int hrtfResets { 0 };
     int hrtfUpdates { 0 };
+    int hrtfBatches { 0 };
 
     int manualStereoMixes { 0 };
     int manualEchoMixes { 0 };
@@ -41,6 +42,12 @@ struct AudioMixerStats {
     int inactive { 0 };
     int active { 0 };
 
+    int pairsEvaluated { 0 };
+    int pairsCulled { 0 };
+
+    int crowdBedRenders { 0 };
+    int crowdBedStreams { 0 };
+
 #ifdef HIFI_AUDIO_MIXER_DEBUG
     uint64_t mixTime { 0 };
 #endif
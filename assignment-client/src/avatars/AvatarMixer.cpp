@@ -72,8 +72,12 @@ AvatarMixer::AvatarMixer(ReceivedMessage& message) :
     connect(DependencyManager::get<NodeList>().data(), &NodeList::nodeKilled, this, &AvatarMixer::handleAvatarKilled);
 
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
-    packetReceiver.registerListener(PacketType::AvatarData,
-        PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::queueIncomingPacket));
+    // the packets queued with their nodes skip the event queue of the mixer thread, they are queued at the start of each frame
+    packetReceiver.registerInboxListenerForTypes({
+        PacketType::AvatarData,
+        PacketType::SetAvatarTraits,
+        PacketType::BulkAvatarTraitsAck
+    }, PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::queueIncomingPacket), _packetInbox);
     packetReceiver.registerListener(PacketType::AdjustAvatarSorting,
         PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::handleAdjustAvatarSorting));
     packetReceiver.registerListener(PacketType::AvatarQuery,
@@ -88,10 +92,6 @@ AvatarMixer::AvatarMixer(ReceivedMessage& message) :
         PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::handleRadiusIgnoreRequestPacket));
     packetReceiver.registerListener(PacketType::RequestsDomainListData,
         PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::handleRequestsDomainListDataPacket));
-    packetReceiver.registerListener(PacketType::SetAvatarTraits,
-        PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::queueIncomingPacket));
-    packetReceiver.registerListener(PacketType::BulkAvatarTraitsAck,
-        PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::queueIncomingPacket));
     packetReceiver.registerListenerForTypes({ PacketType::OctreeStats, PacketType::EntityData, PacketType::EntityErase },
         PacketReceiver::makeSourcedListenerReference<AvatarMixer>(this, &AvatarMixer::handleOctreePacket));
 
@@ -293,6 +293,9 @@ void AvatarMixer::start() {
         {
             auto start = usecTimestampNow();
 
+            // queue the packets received since the last frame with their nodes
+            _packetInbox->drain();
+
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
                 auto end = usecTimestampNow();
                 _processQueuedAvatarDataPacketsLockWaitElapsedTime += (end - start);
@@ -333,6 +336,7 @@ void AvatarMixer::start() {
             auto start = usecTimestampNow();
             nodeList->nestedEach([&](NodeList::const_iterator cbegin, NodeList::const_iterator cend) {
                 auto start = usecTimestampNow();
+                _slaveSharedData.avatarIndex.build(cbegin, cend);
                 _slavePool.broadcastAvatarData(cbegin, cend, _lastFrameTimestamp, _maxKbpsPerNode, _throttlingRatio);
                 auto end = usecTimestampNow();
                 _broadcastAvatarDataInner += (end - start);
@@ -762,6 +766,7 @@ void AvatarMixer::sendStatsPacket() {
 
     statsObject["broadcast_loop_rate"] = _loopRate.rate();
     statsObject["threads"] = _slavePool.numThreads();
+    statsObject["packet_inbox"] = _packetInbox->sampleStats();
     statsObject["trailing_mix_ratio"] = _trailingMixRatio;
     statsObject["throttling_ratio"] = _throttlingRatio;
 
@@ -780,6 +785,10 @@ void AvatarMixer::sendStatsPacket() {
 
     statsObject["average_listeners_last_second"] = TIGHT_LOOP_STAT(_sumListeners);
 
+    QJsonObject threadStats;
+    _slavePool.threadStats(threadStats, tightLoopFrames);
+    statsObject["thread_stats"] = threadStats;
+
     QJsonObject singleCoreTasks;
     singleCoreTasks["processEvents"] = TIGHT_LOOP_STAT_UINT64(_processEventsElapsedTime);
     singleCoreTasks["queueIncomingPacket"] = TIGHT_LOOP_STAT_UINT64(_queueIncomingPacketElapsedTime);
@@ -847,6 +856,11 @@ void AvatarMixer::sendStatsPacket() {
     slavesAggregatObject["sent_5_averageTraitsBytes"] = TIGHT_LOOP_STAT(aggregateStats.numTraitsBytesSent);
     slavesAggregatObject["sent_6_averageIdentityBytes"] = TIGHT_LOOP_STAT(aggregateStats.numIdentityBytesSent);
     slavesAggregatObject["sent_7_averageHeroAvatars"] = TIGHT_LOOP_STAT(aggregateStats.numHeroesIncluded);
+    slavesAggregatObject["sent_8_averageEncodings"] = TIGHT_LOOP_STAT(aggregateStats.numEncodingsSent);
+    slavesAggregatObject["sent_9_averageSharedEncodings"] = TIGHT_LOOP_STAT(aggregateStats.numSharedEncodingsSent);
+
+    float averageCandidatesConsidered = averageNodes ? aggregateStats.numCandidatesConsidered / averageNodes : 0.0f;
+    slavesAggregatObject["sent_10_averageCandidatesConsidered"] = TIGHT_LOOP_STAT(averageCandidatesConsidered);
 
     slavesAggregatObject["timing_1_processIncomingPackets"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.processIncomingPacketsElapsedTime);
     slavesAggregatObject["timing_2_ignoreCalculation"] = TIGHT_LOOP_STAT_UINT64(aggregateStats.ignoreCalculationElapsedTime);
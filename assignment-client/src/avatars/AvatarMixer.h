@@ -20,6 +20,7 @@
 
 #include <set>
 #include <shared/RateCounter.h>
+#include <PacketInbox.h>
 #include <PortableHighResolutionClock.h>
 
 #include <ThreadedAssignment.h>
@@ -155,6 +156,9 @@ private:
 
     AvatarMixerSlavePool _slavePool;
     SlaveSharedData _slaveSharedData;
+
+    // avatar data and traits packets, queued with their nodes at the start of each frame
+    std::shared_ptr<PacketInbox> _packetInbox { std::make_shared<PacketInbox>() };
 };
 
 #endif // hifi_AvatarMixer_h
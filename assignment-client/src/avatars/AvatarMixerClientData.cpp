@@ -12,6 +12,8 @@
 #include "AvatarMixerClientData.h"
 
 #include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <udt/PacketHeaders.h>
 
 #include <DependencyManager.h>
@@ -45,6 +47,90 @@ void AvatarMixerClientData::setLastOtherAvatarEncodeTime(NLPacket::LocalID other
     }
 }
 
+uint64_t AvatarMixerClientData::getLastOtherAvatarSharedEncoding(NLPacket::LocalID otherAvatar) const {
+    const auto itr = _lastOtherAvatarSharedEncodings.find(otherAvatar);
+    if (itr != _lastOtherAvatarSharedEncodings.end()) {
+        return itr->second;
+    }
+    return 0;
+}
+
+int AvatarMixerClientData::getSharedEncodingBand(float distance) {
+    // the same bands as AvatarData::getDistanceBasedMinRotationDOT
+    static const float BAND_LIMITS[NUM_SHARED_ENCODING_BANDS - 1] = {
+        AVATAR_DISTANCE_LEVEL_1, AVATAR_DISTANCE_LEVEL_2, AVATAR_DISTANCE_LEVEL_3,
+        AVATAR_DISTANCE_LEVEL_4, AVATAR_DISTANCE_LEVEL_5
+    };
+    return (int)(std::upper_bound(std::begin(BAND_LIMITS), std::end(BAND_LIMITS), distance) - std::begin(BAND_LIMITS));
+}
+
+SharedAvatarEncodingPointer AvatarMixerClientData::getSharedEncoding(int band, bool needsKeyframe) const {
+    // ids are unique across avatars and bands, a receiver can't mistake a new avatar that reuses a local ID for an old one
+    static std::atomic<uint64_t> nextEncodingID { 1 };
+
+    // a viewer distance inside each band, away from its limits so that rounding doesn't move it to the next one
+    static const float BAND_VIEWER_DISTANCES[NUM_SHARED_ENCODING_BANDS] = {
+        0.0f,
+        (AVATAR_DISTANCE_LEVEL_1 + AVATAR_DISTANCE_LEVEL_2) / 2.0f,
+        (AVATAR_DISTANCE_LEVEL_2 + AVATAR_DISTANCE_LEVEL_3) / 2.0f,
+        (AVATAR_DISTANCE_LEVEL_3 + AVATAR_DISTANCE_LEVEL_4) / 2.0f,
+        (AVATAR_DISTANCE_LEVEL_4 + AVATAR_DISTANCE_LEVEL_5) / 2.0f,
+        AVATAR_DISTANCE_LEVEL_5 * 2.0f
+    };
+
+    assert(band >= 0 && band < NUM_SHARED_ENCODING_BANDS);
+
+    std::lock_guard<std::mutex> lock(_sharedEncodingMutex);
+
+    // avatar data only changes while packets are processed, so one encoding per band serves a whole broadcast
+    auto& sharedEncoding = _sharedEncodings[band];
+    if (!sharedEncoding || sharedEncoding->sequenceNumber != _lastReceivedSequenceNumber) {
+        auto previous = sharedEncoding;
+        auto encoding = std::make_shared<SharedAvatarEncoding>();
+        encoding->id = nextEncodingID++;
+        encoding->sequenceNumber = _lastReceivedSequenceNumber;
+        encoding->encodeTime = usecTimestampNow();
+
+        if (previous) {
+            // the nearest band gets every change, the others cull small joint changes as their distance does
+            bool isNearest = band == 0;
+            auto detail = isNearest ? AvatarData::IncludeSmallData : AvatarData::CullSmallData;
+            glm::vec3 viewerPosition = _avatar->getClientGlobalPosition() + glm::vec3(BAND_VIEWER_DISTANCES[band], 0.0f, 0.0f);
+
+            // the delta has to leave receivers with exactly the joints of the band, which all of them are assumed to have
+            encoding->previousID = previous->id;
+            encoding->joints = previous->joints;
+            AvatarDataPacket::SendStatus sendStatus;
+            sendStatus.sendUUID = true;
+            encoding->delta = _avatar->toByteArray(detail, previous->encodeTime, encoding->joints, sendStatus,
+                                                   false, !isNearest, viewerPosition, &encoding->joints);
+        } else {
+            needsKeyframe = true;
+        }
+
+        sharedEncoding = encoding;
+    }
+
+    if (needsKeyframe && sharedEncoding->keyframe.isEmpty()) {
+        // the keyframe doesn't depend on distance, the bands share one per update
+        if (_sharedKeyframe.isEmpty() || _sharedKeyframeSequenceNumber != _lastReceivedSequenceNumber) {
+            _sharedKeyframeJoints = QVector<JointData>(_avatar->getJointData().size());
+            AvatarDataPacket::SendStatus sendStatus;
+            sendStatus.sendUUID = true;
+            _sharedKeyframe = _avatar->toByteArray(AvatarData::SendAllData, 0, _sharedKeyframeJoints, sendStatus,
+                                                   false, false, glm::vec3(0), &_sharedKeyframeJoints);
+            _sharedKeyframeSequenceNumber = _lastReceivedSequenceNumber;
+        }
+
+        sharedEncoding->keyframe = _sharedKeyframe;
+        if (sharedEncoding->previousID == 0) {
+            sharedEncoding->joints = _sharedKeyframeJoints;
+        }
+    }
+
+    return sharedEncoding;
+}
+
 void AvatarMixerClientData::queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node) {
     if (!_packetQueue.node) {
         _packetQueue.node = node;
@@ -501,6 +587,7 @@ bool AvatarMixerClientData::otherAvatarInView(const AABox& otherAvatarBox) {
 void AvatarMixerClientData::loadJSONStats(QJsonObject& jsonObject) const {
     jsonObject["display_name"] = _avatar->getDisplayName();
     jsonObject["num_avs_sent_last_frame"] = _numAvatarsSentLastFrame;
+    jsonObject["num_av_candidates_last_frame"] = _numCandidatesLastFrame;
     jsonObject["avg_other_av_starves_per_second"] = getAvgNumOtherAvatarStarvesPerSecond();
     jsonObject["avg_other_av_skips_per_second"] = getAvgNumOtherAvatarSkipsPerSecond();
     jsonObject["total_num_out_of_order_sends"] = _numOutOfOrderSends;
@@ -528,6 +615,7 @@ AvatarMixerClientData::TraitsCheckTimestamp AvatarMixerClientData::getLastOtherA
 void AvatarMixerClientData::cleanupKilledNode(const QUuid&, Node::LocalID nodeLocalID) {
     removeLastBroadcastSequenceNumber(nodeLocalID);
     removeLastBroadcastTime(nodeLocalID);
+    _lastOtherAvatarSharedEncodings.erase(nodeLocalID);
     _lastSentTraitsTimestamps.erase(nodeLocalID);
     _perNodeSentTraitVersions.erase(nodeLocalID);
     _perNodeAckedTraitVersions.erase(nodeLocalID);
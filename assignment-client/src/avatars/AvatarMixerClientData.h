@@ -14,6 +14,8 @@
 
 #include <algorithm>
 #include <cfloat>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <queue>
@@ -38,6 +40,28 @@ const QString INBOUND_AVATAR_DATA_STATS_KEY = "inbound_av_data_kbps";
 
 struct SlaveSharedData;
 
+// Encodings of one update of an avatar, shared by every receiver in one distance band it is sent to
+//   The keyframe holds the whole avatar, the delta what changed since the previous shared encoding of the band,
+//   culled by the band's distance. The delta only applies on top of the previous shared encoding of the band, and
+//   leaves out what the band's distance culls, so it doesn't leave a receiver with the same state as the keyframe.
+//   A receiver in the band that got the previous shared encoding can be sent the delta of this one without encoding
+//   anything of its own; any other receiver first needs its own catch-up encoding, with IncludeSmallData.
+struct SharedAvatarEncoding {
+    uint64_t id { 0 };
+    uint64_t previousID { 0 };
+    uint16_t sequenceNumber { 0 };
+    uint64_t encodeTime { 0 };
+    QByteArray delta; // empty when there is no previous encoding to build on
+    QVector<JointData> joints; // the joints a receiver has been sent once it gets either encoding
+
+    QByteArray getKeyframe() const { return keyframe; }
+
+private:
+    friend class AvatarMixerClientData;
+    QByteArray keyframe; // built the first time a receiver asks for it, shared by the bands
+};
+using SharedAvatarEncodingPointer = std::shared_ptr<const SharedAvatarEncoding>;
+
 class AvatarMixerClientData : public NodeData {
     Q_OBJECT
 public:
@@ -73,6 +97,9 @@ public:
     bool getAvatarSessionDisplayNameMustChange() const { return _avatarSessionDisplayNameMustChange; }
     void setAvatarSessionDisplayNameMustChange(bool set = true) { _avatarSessionDisplayNameMustChange = set; }
 
+    void setNumCandidatesLastFrame(int numCandidates) { _numCandidatesLastFrame = numCandidates; }
+    int getNumCandidatesLastFrame() const { return _numCandidatesLastFrame; }
+
     void resetNumAvatarsSentLastFrame() { _numAvatarsSentLastFrame = 0; }
     void incrementNumAvatarsSentLastFrame() { ++_numAvatarsSentLastFrame; }
     int getNumAvatarsSentLastFrame() const { return _numAvatarsSentLastFrame; }
@@ -105,6 +132,7 @@ public:
     bool isRadiusIgnoring(const QUuid& other) const;
     void addToRadiusIgnoringSet(const QUuid& other);
     void removeFromRadiusIgnoringSet(const QUuid& other);
+    const std::vector<QUuid>& getRadiusIgnoredOthers() const { return _radiusIgnoredOthers; }
     void ignoreOther(SharedNodePointer self, SharedNodePointer other);
     void ignoreOther(const Node* self, const Node* other);
 
@@ -129,6 +157,19 @@ public:
 
     QVector<JointData>& getLastOtherAvatarSentJoints(NLPacket::LocalID otherAvatar) { return _lastOtherAvatarSentJoints[otherAvatar]; }
 
+    // joint culling is the same within each of the AVATAR_DISTANCE_LEVEL_* bands, so receivers in a band share encodings
+    static const int NUM_SHARED_ENCODING_BANDS = 6;
+    static int getSharedEncodingBand(float distance);
+
+    // returns the shared encoding for a band of the latest update received from this avatar, building it if needed,
+    // this is called by every slave broadcasting this avatar
+    SharedAvatarEncodingPointer getSharedEncoding(int band, bool needsKeyframe) const;
+
+    // the shared encoding of the other avatar that was last sent in full to this node, 0 if none was
+    uint64_t getLastOtherAvatarSharedEncoding(NLPacket::LocalID otherAvatar) const;
+    void setLastOtherAvatarSharedEncoding(NLPacket::LocalID otherAvatar, uint64_t encodingID)
+        { _lastOtherAvatarSharedEncodings[otherAvatar] = encodingID; }
+
     void queuePacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer node);
     int processPackets(const SlaveSharedData& slaveSharedData); // returns number of packets processed
 
@@ -176,12 +217,21 @@ private:
     // sending to "this" node
     std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarEncodeTime;
     std::unordered_map<NLPacket::LocalID, QVector<JointData>> _lastOtherAvatarSentJoints;
+    std::unordered_map<NLPacket::LocalID, uint64_t> _lastOtherAvatarSharedEncodings;
+
+    mutable std::mutex _sharedEncodingMutex;
+    // guarded by _sharedEncodingMutex
+    mutable std::shared_ptr<SharedAvatarEncoding> _sharedEncodings[NUM_SHARED_ENCODING_BANDS];
+    mutable QByteArray _sharedKeyframe;
+    mutable QVector<JointData> _sharedKeyframeJoints;
+    mutable uint16_t _sharedKeyframeSequenceNumber { 0 };
 
     uint64_t _identityChangeTimestamp;
     bool _avatarSessionDisplayNameMustChange{ true };
     bool _avatarSkeletonModelUrlMustChange{ false };
 
     int _numAvatarsSentLastFrame = 0;
+    int _numCandidatesLastFrame = 0;
     int _numFramesSinceAdjustment = 0;
 
     SimpleMovingAverage _otherAvatarStarves;
@@ -262,6 +262,10 @@ int AvatarMixerSlave::sendReplicatedIdentityPacket(const Node& agentNode, const
 
 static const int AVATAR_MIXER_BROADCAST_FRAMES_PER_SECOND = 45;
 
+// below this many avatars checking all of them is cheaper than querying the spatial index
+static const int MIN_AVATARS_FOR_SPATIAL_INDEX = 100;
+static const int NUM_DISTANT_AVATAR_SAMPLES = 8;
+
 void AvatarMixerSlave::broadcastAvatarData(const SharedNodePointer& node) {
     quint64 start = usecTimestampNow();
 
@@ -384,10 +388,25 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
             AvatarData::_avatarSortCoefficientCenter, AvatarData::_avatarSortCoefficientAge}
     };
 
-    avatarPriorityQueues[kNonhero].reserve(_end - _begin);
+    // In a big crowd only the avatars around the receiver are considered. The PAL lists everyone, and closing it
+    // may have to kill ignored avatars anywhere, so then every avatar is.
+    std::vector<Node*> candidates;
+    const auto& avatarIndex = _sharedData->avatarIndex;
+    if (avatarIndex.size() >= MIN_AVATARS_FOR_SPATIAL_INDEX && !PALIsOpen && !PALWasOpen) {
+        avatarIndex.query(destinationPosition, numToSendEst, destinationNodeData->getRadiusIgnoredOthers(),
+                          NUM_DISTANT_AVATAR_SAMPLES, generator, candidates);
+    } else {
+        candidates.reserve(_end - _begin);
+        for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
+            candidates.push_back((*listedNode).data());
+        }
+    }
+    destinationNodeData->setNumCandidatesLastFrame((int)candidates.size());
+    _stats.numCandidatesConsidered += (int)candidates.size();
+
+    avatarPriorityQueues[kNonhero].reserve(candidates.size());
 
-    for (auto listedNode = _begin; listedNode != _end; ++listedNode) {
-        Node* otherNodeRaw = (*listedNode).data();
+    for (Node* otherNodeRaw : candidates) {
         if (otherNodeRaw->getType() != NodeType::Agent
             || !otherNodeRaw->getLinkedData()
             || otherNodeRaw == destinationNode) {
@@ -575,31 +594,93 @@ void AvatarMixerSlave::broadcastAvatarDataToAgent(const SharedNodePointer& node)
 
             QVector<JointData>& lastSentJointsForOther = destinationNodeData->getLastOtherAvatarSentJoints(sourceNode->getLocalID());
 
-            const bool distanceAdjust = true;
-            const bool dropFaceTracking = false;
-            AvatarDataPacket::SendStatus sendStatus;
-            sendStatus.sendUUID = true;
-
-            do {
+            // Full updates don't depend on the receiver, and culled updates only on the distance band it is in, so they
+            // are encoded once per update of the source avatar and band, and copied to everyone who is due for them.
+            SharedAvatarEncodingPointer sharedEncoding;
+            QByteArray sharedBytes;
+            if (detail == AvatarData::SendAllData || detail == AvatarData::CullSmallData) {
                 auto startSerialize = chrono::high_resolution_clock::now();
-                QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
-                    sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
-                    &lastSentJointsForOther, avatarSpaceAvailable);
+                bool isKeyframe = detail == AvatarData::SendAllData;
+                int band = AvatarMixerClientData::getSharedEncodingBand(
+                    glm::distance(sourceAvatar->getClientGlobalPosition(), destinationPosition));
+                sharedEncoding = sourceNodeData->getSharedEncoding(band, isKeyframe);
                 auto endSerialize = chrono::high_resolution_clock::now();
                 _stats.toByteArrayElapsedTime +=
                     (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
 
-                avatarPacket->write(bytes);
-                avatarSpaceAvailable -= bytes.size();
-                numAvatarDataBytes += bytes.size();
-                if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
-                    // Weren't able to fit everything.
+                auto lastSharedEncoding = destinationNodeData->getLastOtherAvatarSharedEncoding(sourceNode->getLocalID());
+                if (isKeyframe) {
+                    sharedBytes = sharedEncoding->getKeyframe();
+                } else if (lastSharedEncoding != 0 && lastSharedEncoding == sharedEncoding->previousID) {
+                    sharedBytes = sharedEncoding->delta;
+                } else {
+                    // catch this receiver up without culling, e.g. when it moved to another band, so that it can take
+                    // the shared delta of the next update
+                    detail = AvatarData::IncludeSmallData;
+                }
+
+                if (sharedBytes.size() > avatarSpaceAvailable) {
+                    if (sharedBytes.size() <= avatarPacketCapacity) {
+                        nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                        ++numPacketsSent;
+                        avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                        avatarSpaceAvailable = avatarPacketCapacity;
+                    } else {
+                        // too big for a single packet, the encoding below splits it up
+                        sharedBytes.clear();
+                    }
+                }
+            }
+
+            if (!sharedBytes.isEmpty()) {
+                avatarPacket->write(sharedBytes);
+                avatarSpaceAvailable -= sharedBytes.size();
+                numAvatarDataBytes += sharedBytes.size();
+                if (avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
                     nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
                     ++numPacketsSent;
                     avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
                     avatarSpaceAvailable = avatarPacketCapacity;
                 }
-            } while (!sendStatus);
+
+                lastSentJointsForOther = sharedEncoding->joints;
+                destinationNodeData->setLastOtherAvatarSharedEncoding(sourceNode->getLocalID(), sharedEncoding->id);
+                _stats.numSharedEncodingsSent++;
+            } else {
+                const bool distanceAdjust = true;
+                const bool dropFaceTracking = false;
+                AvatarDataPacket::SendStatus sendStatus;
+                sendStatus.sendUUID = true;
+
+                do {
+                    auto startSerialize = chrono::high_resolution_clock::now();
+                    QByteArray bytes = sourceAvatar->toByteArray(detail, lastEncodeForOther, lastSentJointsForOther,
+                        sendStatus, dropFaceTracking, distanceAdjust, destinationPosition,
+                        &lastSentJointsForOther, avatarSpaceAvailable);
+                    auto endSerialize = chrono::high_resolution_clock::now();
+                    _stats.toByteArrayElapsedTime +=
+                        (quint64)chrono::duration_cast<chrono::microseconds>(endSerialize - startSerialize).count();
+
+                    avatarPacket->write(bytes);
+                    avatarSpaceAvailable -= bytes.size();
+                    numAvatarDataBytes += bytes.size();
+                    if (!sendStatus || avatarSpaceAvailable < (int)AvatarDataPacket::MIN_BULK_PACKET_SIZE) {
+                        // Weren't able to fit everything.
+                        nodeList->sendPacket(std::move(avatarPacket), *destinationNode);
+                        ++numPacketsSent;
+                        avatarPacket = NLPacket::create(PacketType::BulkAvatarData);
+                        avatarSpaceAvailable = avatarPacketCapacity;
+                    }
+                } while (!sendStatus);
+
+                // only a complete update leaves the receiver where a shared delta can build on it
+                bool isComplete = detail == AvatarData::IncludeSmallData || detail == AvatarData::SendAllData;
+                destinationNodeData->setLastOtherAvatarSharedEncoding(sourceNode->getLocalID(),
+                                                                     isComplete && sharedEncoding ? sharedEncoding->id : 0);
+                if (detail != AvatarData::NoData) {
+                    _stats.numEncodingsSent++;
+                }
+            }
 
             if (detail != AvatarData::NoData) {
                 _stats.numOthersIncluded++;
@@ -14,6 +14,8 @@
 
 #include <NodeList.h>
 
+#include "AvatarSpatialIndex.h"
+
 class AvatarMixerClientData;
 
 class AvatarMixerSlaveStats {
@@ -33,6 +35,9 @@ public:
     int numOthersIncluded { 0 };
     int overBudgetAvatars { 0 };
     int numHeroesIncluded { 0 };
+    int numEncodingsSent { 0 };
+    int numSharedEncodingsSent { 0 };
+    int numCandidatesConsidered { 0 };
 
     quint64 ignoreCalculationElapsedTime { 0 };
     quint64 avatarDataPackingElapsedTime { 0 };
@@ -59,6 +64,9 @@ public:
         numOthersIncluded = 0;
         overBudgetAvatars = 0;
         numHeroesIncluded = 0;
+        numEncodingsSent = 0;
+        numSharedEncodingsSent = 0;
+        numCandidatesConsidered = 0;
 
         ignoreCalculationElapsedTime = 0;
         avatarDataPackingElapsedTime = 0;
@@ -83,6 +91,9 @@ public:
         numOthersIncluded += rhs.numOthersIncluded;
         overBudgetAvatars += rhs.overBudgetAvatars;
         numHeroesIncluded += rhs.numHeroesIncluded;
+        numEncodingsSent += rhs.numEncodingsSent;
+        numSharedEncodingsSent += rhs.numSharedEncodingsSent;
+        numCandidatesConsidered += rhs.numCandidatesConsidered;
 
         ignoreCalculationElapsedTime += rhs.ignoreCalculationElapsedTime;
         avatarDataPackingElapsedTime += rhs.avatarDataPackingElapsedTime;
@@ -100,6 +111,7 @@ struct SlaveSharedData {
     QStringList skeletonURLWhitelist;
     QUrl skeletonReplacementURL;
     EntityTreePointer entityTree;
+    AvatarSpatialIndex avatarIndex; // rebuilt before each broadcast
 };
 
 class AvatarMixerSlave {
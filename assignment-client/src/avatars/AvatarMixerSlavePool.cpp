@@ -18,11 +18,10 @@ void AvatarMixerSlaveThread::run() {
     while (true) {
         wait();
 
-        // iterate over all available nodes
-        SharedNodePointer node;
-        while (try_pop(node)) {
+        // iterate over our share of the nodes, then help the other threads with theirs
+        _pool._scheduler.run(_index, [&](const SharedNodePointer& node) {
             (this->*_function)(node);
-        }
+        });
 
         bool stopping = _stop;
         notify(stopping);
@@ -59,16 +58,12 @@ void AvatarMixerSlaveThread::notify(bool stopping) {
     _pool._poolCondition.notify_one();
 }
 
-bool AvatarMixerSlaveThread::try_pop(SharedNodePointer& node) {
-    return _pool._queue.try_pop(node);
-}
-
 void AvatarMixerSlavePool::processIncomingPackets(ConstIter begin, ConstIter end) {
     _function = &AvatarMixerSlave::processIncomingPackets;
     _configure = [=](AvatarMixerSlave& slave) { 
         slave.configure(begin, end);
     };
-    run(begin, end);
+    run(begin, end, _packetCostHints);
 }
 
 void AvatarMixerSlavePool::broadcastAvatarData(ConstIter begin, ConstIter end, 
@@ -79,17 +74,22 @@ void AvatarMixerSlavePool::broadcastAvatarData(ConstIter begin, ConstIter end,
         slave.configureBroadcast(begin, end, lastFrameTimestamp, maxKbpsPerNode, throttlingRatio,
             _priorityReservedFraction);
    };
-    run(begin, end);
+    run(begin, end, _broadcastCostHints);
 }
 
-void AvatarMixerSlavePool::run(ConstIter begin, ConstIter end) {
+void AvatarMixerSlavePool::run(ConstIter begin, ConstIter end, CostHints& costHints) {
     _begin = begin;
     _end = end;
 
-    // fill the queue
+    // deal the nodes to the threads, using what each cost on the previous frame
+    _scheduler.clear();
     std::for_each(_begin, _end, [&](const SharedNodePointer& node) {
-        _queue.push(node);
+        auto hint = costHints.find(node->getLocalID());
+        _scheduler.push(node, hint != costHints.end() ? hint->second : 0);
     });
+    _scheduler.distribute();
+
+    auto start = p_high_resolution_clock::now();
 
     {
         Lock lock(_mutex);
@@ -107,7 +107,28 @@ void AvatarMixerSlavePool::run(ConstIter begin, ConstIter end) {
         assert(_numStarted == _numThreads);
     }
 
-    assert(_queue.empty());
+    assert(_scheduler.isEmpty());
+
+    auto end = p_high_resolution_clock::now();
+    Scheduler::Cost runTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    // this frame's costs are the next frame's hints
+    costHints.clear();
+    for (int i = 0; i < _scheduler.getNumTasks(); ++i) {
+        costHints[_scheduler.getTask(i)->getLocalID()] = _scheduler.getTaskCost(i);
+    }
+
+    for (int i = 0; i < _numThreads; ++i) {
+        const auto& workerStats = _scheduler.getWorkerStats(i);
+        auto& stats = _threadStats[i];
+        stats.busyTime += workerStats.busyTime;
+        stats.idleTime += runTime - std::min(workerStats.busyTime, runTime);
+        stats.numTasks += workerStats.numTasks;
+        stats.numStolen += workerStats.numStolen;
+    }
+
+    // release the node pointers until the next frame
+    _scheduler.clear();
 }
 
 
@@ -130,6 +151,24 @@ void AvatarMixerSlavePool::queueStats(QJsonObject& stats) {
 }
 #endif // DEBUG_EVENT_QUEUE
 
+void AvatarMixerSlavePool::threadStats(QJsonObject& stats, int numFrames) {
+    const int NSEC_PER_USEC = 1000;
+    float usecPerFrame = (float)NSEC_PER_USEC * (float)std::max(numFrames, 1);
+
+    for (int i = 0; i < (int)_threadStats.size(); ++i) {
+        auto& threadStats = _threadStats[i];
+
+        QJsonObject threadObject;
+        threadObject["us_busy_per_frame"] = (float)threadStats.busyTime / usecPerFrame;
+        threadObject["us_idle_per_frame"] = (float)threadStats.idleTime / usecPerFrame;
+        threadObject["nodes_per_frame"] = (float)threadStats.numTasks / (float)std::max(numFrames, 1);
+        threadObject["stolen_per_frame"] = (float)threadStats.numStolen / (float)std::max(numFrames, 1);
+        stats[QString("avatar_thread_%1").arg(i)] = threadObject;
+
+        threadStats = Scheduler::WorkerStats();
+    }
+}
+
 void AvatarMixerSlavePool::setNumThreads(int numThreads) {
     // clamp to allowed size
     {
@@ -160,7 +199,7 @@ void AvatarMixerSlavePool::resize(int numThreads) {
     if (numThreads > _numThreads) {
         // start new slaves
         for (int i = 0; i < numThreads - _numThreads; ++i) {
-            auto slave = new AvatarMixerSlaveThread(*this, _slaveSharedData);
+            auto slave = new AvatarMixerSlaveThread(*this, _slaveSharedData, _numThreads + i);
             slave->start();
             _slaves.emplace_back(slave);
         }
@@ -199,5 +238,7 @@ void AvatarMixerSlavePool::resize(int numThreads) {
     }
 
     _numThreads = _numStarted = _numFinished = numThreads;
+    _scheduler.setNumWorkers(numThreads);
+    _threadStats.resize(numThreads);
     assert(_numThreads == (int)_slaves.size());
 }
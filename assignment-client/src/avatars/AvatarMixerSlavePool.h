@@ -14,13 +14,15 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
+#include <QJsonObject>
 #include <QThread>
 
-#include <TBBHelpers.h>
 #include <NodeList.h>
 #include <shared/QtHelpers.h>
+#include <WorkStealingScheduler.h>
 
 #include "AvatarMixerSlave.h"
 
@@ -34,8 +36,8 @@ class AvatarMixerSlaveThread : public QThread, public AvatarMixerSlave {
     using Lock = std::unique_lock<Mutex>;
 
 public:
-    AvatarMixerSlaveThread(AvatarMixerSlavePool& pool, SlaveSharedData* slaveSharedData) :
-        AvatarMixerSlave(slaveSharedData), _pool(pool) {};
+    AvatarMixerSlaveThread(AvatarMixerSlavePool& pool, SlaveSharedData* slaveSharedData, int index) :
+        AvatarMixerSlave(slaveSharedData), _pool(pool), _index(index) {};
 
     void run() override final;
 
@@ -44,9 +46,9 @@ private:
 
     void wait();
     void notify(bool stopping);
-    bool try_pop(SharedNodePointer& node);
 
     AvatarMixerSlavePool& _pool;
+    int _index;
     void (AvatarMixerSlave::*_function)(const SharedNodePointer& node) { nullptr };
     bool _stop { false };
 };
@@ -54,7 +56,8 @@ private:
 // Slave pool for avatar mixers
 //   AvatarMixerSlavePool is not thread-safe! It should be instantiated and used from a single thread.
 class AvatarMixerSlavePool {
-    using Queue = tbb::concurrent_queue<SharedNodePointer>;
+    using Scheduler = WorkStealingScheduler<SharedNodePointer>;
+    using CostHints = std::unordered_map<Node::LocalID, Scheduler::Cost>;
     using Mutex = std::mutex;
     using Lock = std::unique_lock<Mutex>;
     using ConditionVariable = std::condition_variable;
@@ -78,6 +81,9 @@ public:
     void queueStats(QJsonObject& stats);
 #endif
 
+    // per-thread busy and idle time since the last call, averaged over the given number of frames
+    void threadStats(QJsonObject& stats, int numFrames);
+
     void setNumThreads(int numThreads);
     int numThreads() const { return _numThreads; }
 
@@ -85,14 +91,13 @@ public:
     float getPriorityReservedFraction() const { return  _priorityReservedFraction; }
 
 private:
-    void run(ConstIter begin, ConstIter end);
+    void run(ConstIter begin, ConstIter end, CostHints& costHints);
     void resize(int numThreads);
 
     std::vector<std::unique_ptr<AvatarMixerSlaveThread>> _slaves;
 
     friend void AvatarMixerSlaveThread::wait();
     friend void AvatarMixerSlaveThread::notify(bool stopping);
-    friend bool AvatarMixerSlaveThread::try_pop(SharedNodePointer& node);
 
     // synchronization state
     Mutex _mutex;
@@ -110,10 +115,16 @@ private:
     int _numStopped { 0 }; // guarded by _mutex
 
     // frame state
-    Queue _queue;
+    Scheduler _scheduler;
     ConstIter _begin;
     ConstIter _end;
 
+    // what each node cost on the previous frame, by job
+    CostHints _packetCostHints;
+    CostHints _broadcastCostHints;
+
+    std::vector<Scheduler::WorkerStats> _threadStats;
+
     SlaveSharedData* _slaveSharedData;
 };
 
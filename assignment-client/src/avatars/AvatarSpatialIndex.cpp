@@ -0,0 +1,170 @@
+//
+//  AvatarSpatialIndex.cpp
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AvatarSpatialIndex.h"
+
+#include <algorithm>
+
+#include "AvatarMixerClientData.h"
+
+static const float CELL_SIZE = 10.0f; // meters
+// avatars farther than this are only reached by sampling, they are sent the least detail anyway
+static const int MAX_RING = (int)(AVATAR_DISTANCE_LEVEL_5 / CELL_SIZE);
+// the receiver can be anywhere in its cell, so the cells around it are always looked at, however crowded its own is
+static const int MIN_RING = 1;
+
+void AvatarSpatialIndex::build(ConstIter begin, ConstIter end) {
+    _entries.clear();
+    _cells.clear();
+    _entriesByID.clear();
+    _priorityEntries.clear();
+
+    std::for_each(begin, end, [&](const SharedNodePointer& node) {
+        auto nodeData = static_cast<const AvatarMixerClientData*>(node->getLinkedData());
+        if (node->getType() != NodeType::Agent || !nodeData) {
+            return;
+        }
+
+        int index = (int)_entries.size();
+        auto cell = cellFor(nodeData->getPosition());
+        _entries.push_back({ node.data(), cell });
+
+        auto& occupied = _cells[keyFor(cell)];
+        occupied.cell = cell;
+        occupied.entries.push_back(index);
+
+        _entriesByID.insert(node->getUUID(), index);
+
+        if (nodeData->getAvatar().getHasPriority()) {
+            _priorityEntries.push_back(index);
+        }
+    });
+}
+
+void AvatarSpatialIndex::query(const glm::vec3& position, int minCount, const std::vector<QUuid>& mustInclude,
+                               int numDistantSamples, std::mt19937& generator, std::vector<Node*>& candidates) const {
+    auto center = cellFor(position);
+    const size_t start = candidates.size();
+    auto numFound = [&] { return (int)(candidates.size() - start); };
+
+    // every avatar up to and including this ring is in the candidates
+    int lastRing = MAX_RING;
+
+    for (int ring = 0; ring <= MAX_RING; ++ring) {
+        if (ring > MIN_RING && numFound() >= minCount) {
+            lastRing = ring - 1;
+            break;
+        }
+
+        if (ring > 0 && 8 * ring > (int)_cells.size()) {
+            // fewer cells are occupied than there are cells in this ring, visit the occupied ones in ring order instead
+            lastRing = ring - 1;
+            std::vector<std::pair<int, const Cell*>> remaining;
+            for (const auto& pair : _cells) {
+                int cellRing = ringOf(pair.second.cell, center);
+                if (cellRing >= ring && cellRing <= MAX_RING) {
+                    remaining.push_back({ cellRing, &pair.second });
+                }
+            }
+            std::sort(remaining.begin(), remaining.end(), [](const std::pair<int, const Cell*>& a,
+                                                             const std::pair<int, const Cell*>& b) {
+                return a.first < b.first;
+            });
+
+            for (const auto& cell : remaining) {
+                if (numFound() >= minCount && cell.first > lastRing && cell.first > MIN_RING) {
+                    break;
+                }
+                for (int index : cell.second->entries) {
+                    candidates.push_back(_entries[index].node);
+                }
+                lastRing = cell.first;
+            }
+            if (numFound() < minCount) {
+                lastRing = MAX_RING;
+            }
+            break;
+        }
+
+        if (ring == 0) {
+            appendCell(center, candidates);
+        } else {
+            for (int dx = -ring; dx <= ring; ++dx) {
+                appendCell(center + glm::ivec2(dx, -ring), candidates);
+                appendCell(center + glm::ivec2(dx, ring), candidates);
+            }
+            for (int dz = -ring + 1; dz < ring; ++dz) {
+                appendCell(center + glm::ivec2(-ring, dz), candidates);
+                appendCell(center + glm::ivec2(ring, dz), candidates);
+            }
+        }
+    }
+
+    const size_t nearbyEnd = candidates.size();
+    auto isOutside = [&](int index) {
+        if (ringOf(_entries[index].cell, center) <= lastRing) {
+            return false;
+        }
+        auto node = _entries[index].node;
+        return std::find(candidates.begin() + nearbyEnd, candidates.end(), node) == candidates.end();
+    };
+
+    // hero avatars are sent ahead of the others wherever they are
+    for (int index : _priorityEntries) {
+        if (isOutside(index)) {
+            candidates.push_back(_entries[index].node);
+        }
+    }
+
+    for (const auto& id : mustInclude) {
+        auto it = _entriesByID.find(id);
+        if (it != _entriesByID.end() && isOutside(it.value())) {
+            candidates.push_back(_entries[it.value()].node);
+        }
+    }
+
+    if (_entries.empty()) {
+        return;
+    }
+    std::uniform_int_distribution<int> distribution(0, (int)_entries.size() - 1);
+    int numSampled = 0;
+    for (int attempt = 0; attempt < 2 * numDistantSamples && numSampled < numDistantSamples; ++attempt) {
+        int index = distribution(generator);
+        if (isOutside(index)) {
+            candidates.push_back(_entries[index].node);
+            ++numSampled;
+        }
+    }
+}
+
+glm::ivec2 AvatarSpatialIndex::cellFor(const glm::vec3& position) {
+    // keep bogus positions from overflowing the cell coordinates
+    static const float MAX_CELL = 1.0e8f;
+    auto cell = glm::clamp(glm::floor(glm::vec2(position.x, position.z) / CELL_SIZE), -MAX_CELL, MAX_CELL);
+    return glm::ivec2(cell);
+}
+
+int AvatarSpatialIndex::ringOf(const glm::ivec2& cell, const glm::ivec2& center) {
+    auto offset = glm::abs(cell - center);
+    return std::max(offset.x, offset.y);
+}
+
+uint64_t AvatarSpatialIndex::keyFor(const glm::ivec2& cell) {
+    return ((uint64_t)(uint32_t)cell.x << 32) | (uint64_t)(uint32_t)cell.y;
+}
+
+void AvatarSpatialIndex::appendCell(const glm::ivec2& cell, std::vector<Node*>& candidates) const {
+    auto it = _cells.find(keyFor(cell));
+    if (it != _cells.end()) {
+        for (int index : it->second.entries) {
+            candidates.push_back(_entries[index].node);
+        }
+    }
+}
@@ -0,0 +1,65 @@
+//
+//  AvatarSpatialIndex.h
+//  assignment-client/src/avatars
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_AvatarSpatialIndex_h
+#define hifi_AvatarSpatialIndex_h
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <QtCore/QHash>
+#include <QtCore/QUuid>
+
+#include <NodeList.h>
+
+// Grid of the avatar positions of a frame, so that each receiver only considers the avatars around it
+//   Avatars mostly spread out horizontally, so the grid is two dimensional. It is rebuilt by the mixer before
+//   every broadcast and then only read, concurrently, by the slaves.
+class AvatarSpatialIndex {
+public:
+    using ConstIter = NodeList::const_iterator;
+
+    void build(ConstIter begin, ConstIter end);
+    int size() const { return (int)_entries.size(); }
+
+    // Appends the avatars in rings of cells around position until at least minCount are found, past the cells next to
+    // the receiver's, or the maximum radius is reached. Then the avatars with priority (in hero zones) and those of
+    // mustInclude wherever they are, and a few random avatars from farther out, so that distant avatars still get their
+    // occasional update.
+    void query(const glm::vec3& position, int minCount, const std::vector<QUuid>& mustInclude, int numDistantSamples,
+               std::mt19937& generator, std::vector<Node*>& candidates) const;
+
+private:
+    struct Entry {
+        Node* node;
+        glm::ivec2 cell;
+    };
+
+    struct Cell {
+        glm::ivec2 cell;
+        std::vector<int> entries;
+    };
+
+    static glm::ivec2 cellFor(const glm::vec3& position);
+    static int ringOf(const glm::ivec2& cell, const glm::ivec2& center);
+    static uint64_t keyFor(const glm::ivec2& cell);
+
+    void appendCell(const glm::ivec2& cell, std::vector<Node*>& candidates) const;
+
+    std::vector<Entry> _entries;
+    std::unordered_map<uint64_t, Cell> _cells; // occupied cells only
+    QHash<QUuid, int> _entriesByID;
+    std::vector<int> _priorityEntries;
+};
+
+#endif // hifi_AvatarSpatialIndex_h
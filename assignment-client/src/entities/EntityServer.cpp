@@ -56,6 +56,9 @@ EntityServer::EntityServer(ReceivedMessage& message) :
         PacketType::EntityErase,
         PacketType::EntityPhysics },
         PacketReceiver::makeSourcedListenerReference<EntityServer>(this, &EntityServer::handleEntityPacket));
+
+    // most entities are sent unchanged to every client, only encode them once
+    EntityItem::setEncodeCacheEnabled(true);
 }
 
 EntityServer::~EntityServer() {
@@ -397,6 +400,19 @@ QString EntityServer::serverSubclassStats() {
     statsString += QString("       EntityItem size... %1 bytes\r\n").arg(sizeof(EntityItem));
     statsString += "\r\n\r\n";
 
+    // display how often clients started from another client's traversal
+    statsString += "<b>Entity Server View Cache Statistics</b>\r\n";
+    statsString += QString("           Entries... %1\r\n").arg(_viewCache.getNumEntries());
+    statsString += QString("              Hits... %1\r\n").arg(locale.toString((qulonglong)_viewCache.getNumHits()));
+    statsString += QString("            Misses... %1\r\n").arg(locale.toString((qulonglong)_viewCache.getNumMisses()));
+    statsString += "\r\n\r\n";
+
+    // display how often entities were sent from their last encoding
+    statsString += "<b>Entity Server Encode Cache Statistics</b>\r\n";
+    statsString += QString("              Hits... %1\r\n").arg(locale.toString((qulonglong)EntityItem::getEncodeCacheHits()));
+    statsString += QString("            Misses... %1\r\n").arg(locale.toString((qulonglong)EntityItem::getEncodeCacheMisses()));
+    statsString += "\r\n\r\n";
+
     statsString += "<b>Entity Server Sending to Viewer Statistics</b>\r\n";
     statsString += "----- Viewer Node ID -----------------    ----- Entity ID ----------------------    "
                    "---------- Last Sent To ----------    ---------- Last Edited -----------\r\n";
@@ -23,6 +23,7 @@
 #include <SimpleEntitySimulation.h>
 
 #include "EntityServerConsts.h"
+#include "EntityViewCache.h"
 
 /// Handles assignments of type EntityServer - sending entities to various clients.
 
@@ -61,6 +62,8 @@ public:
 
     virtual void aboutToFinish() override;
 
+    EntityViewCache& getViewCache() { return _viewCache; }
+
 public slots:
     virtual void nodeAdded(SharedNodePointer node) override;
     virtual void nodeKilled(SharedNodePointer node) override;
@@ -79,6 +82,8 @@ private:
     SimpleEntitySimulationPointer _entitySimulation;
     QTimer* _pruneDeletedEntitiesTimer = nullptr;
 
+    EntityViewCache _viewCache;
+
     QReadWriteLock _viewerSendingStatsLock;
     QMap<QUuid, QMap<QUuid, ViewerSendingStats>> _viewerSendingStats;
 };
@@ -29,10 +29,29 @@ EntityTreeSendThread::EntityTreeSendThread(OctreeServer* myServer, const SharedN
 }
 
 void EntityTreeSendThread::resetState() {
-    qCDebug(entities) << "Clearing known EntityTreeSendThread state for" << _nodeUuid;
+    queueChange([this] {
+        qCDebug(entities) << "Clearing known EntityTreeSendThread state for" << _nodeUuid;
 
-    _knownState.clear();
-    _traversal.reset();
+        _knownState.clear();
+        _traversal.reset();
+    });
+}
+
+void EntityTreeSendThread::queueChange(std::function<void()> change) {
+    std::lock_guard<std::mutex> lock(_queuedChangesMutex);
+    _queuedChanges.push_back(std::move(change));
+}
+
+void EntityTreeSendThread::applyQueuedChanges() {
+    std::vector<std::function<void()>> changes;
+    {
+        std::lock_guard<std::mutex> lock(_queuedChangesMutex);
+        std::swap(changes, _queuedChanges);
+    }
+
+    for (auto& change : changes) {
+        change();
+    }
 }
 
 void EntityTreeSendThread::preDistributionProcessing() {
@@ -153,6 +172,11 @@ bool EntityTreeSendThread::traverseTreeAndSendContents(SharedNodePointer node, O
         #endif
         _traversal.traverse(TIME_BUDGET);
         OctreeServer::trackTreeTraverseTime((float)(usecTimestampNow() - startTime));
+
+        if (_viewCacheEntry && _traversal.finished()) {
+            static_cast<EntityServer*>(_myServer)->getViewCache().insert(std::move(_viewCacheEntry));
+            _viewCacheEntry.reset();
+        }
     }
 
     bool sendComplete = OctreeSendThread::traverseTreeAndSendContents(node, nodeData, viewFrustumChanged, isFullScene);
@@ -229,6 +253,8 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
                                              bool forceFirstPass) {
 
     DiffTraversal::Type type = _traversal.prepareNewTraversal(view, root, forceFirstPass);
+    _viewCacheEntry.reset();
+
     // there are three types of traversal:
     //
     //      (1) FirstTime = at login --> find everything in view
@@ -238,9 +264,32 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
     // The "scanCallback" we provide to the traversal depends on the type:
 
     switch (type) {
-        case DiffTraversal::First:
+        case DiffTraversal::First: {
             // When we get to a First traversal, clear the _knownState
             _knownState.clear();
+
+            // If another client with a very similar view recently completed one, start from its results instead
+            auto& viewCache = static_cast<EntityServer*>(_myServer)->getViewCache();
+            if (auto cached = viewCache.find(_traversal.getCurrentView())) {
+                for (const auto& cachedEntity : cached->entities) {
+                    EntityItemPointer entity = cachedEntity.getEntity();
+                    if (entity && !_sendQueue.contains(entity.get())) {
+                        _sendQueue.emplace(entity, cachedEntity.getPriority());
+                    }
+                }
+
+                DiffTraversal::View completedView = _traversal.getCurrentView();
+                completedView.startTime = cached->view.startTime;
+                _traversal.adoptCompletedView(completedView);
+                break;
+            }
+
+            // Only a traversal starting from an empty queue sees everything in view, so only that one can be shared
+            if (_sendQueue.empty()) {
+                _viewCacheEntry = std::make_shared<EntityViewCache::Entry>();
+                _viewCacheEntry->view = _traversal.getCurrentView();
+            }
+
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
                 next.element->forEachEntity([&](EntityItemPointer entity) {
                     // Bail early if we've already checked this entity this frame
@@ -252,10 +301,14 @@ void EntityTreeSendThread::startNewTraversal(const DiffTraversal::View& view, En
 
                     if (priority != PrioritizedEntity::DO_NOT_SEND) {
                         _sendQueue.emplace(entity, priority);
+                        if (_viewCacheEntry) {
+                            _viewCacheEntry->entities.emplace_back(entity, priority);
+                        }
                     }
                 });
             });
             break;
+        }
         case DiffTraversal::Repeat:
             _traversal.setScanCallback([this](DiffTraversal::VisibleElement& next) {
                 uint64_t startOfCompletedTraversal = _traversal.getStartOfCompletedTraversal();
@@ -420,20 +473,24 @@ bool EntityTreeSendThread::traverseTreeAndBuildNextPacketPayload(EncodeBitstream
 
 void EntityTreeSendThread::editingEntityPointer(const EntityItemPointer& entity) {
     if (entity) {
-        if (!_sendQueue.contains(entity.get()) && _knownState.find(entity.get()) != _knownState.end()) {
-            const auto& view = _traversal.getCurrentView();
-            float priority = view.computePriority(entity);
-
-            // We can force a removal from _knownState if the current view is used and entity is out of view
-            if (priority == PrioritizedEntity::DO_NOT_SEND) {
-                _sendQueue.emplace(entity, PrioritizedEntity::FORCE_REMOVE, true);
-            } else if (priority == PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY) {
-                _sendQueue.emplace(entity, PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY, true);
+        queueChange([this, entity] {
+            if (!_sendQueue.contains(entity.get()) && _knownState.find(entity.get()) != _knownState.end()) {
+                const auto& view = _traversal.getCurrentView();
+                float priority = view.computePriority(entity);
+
+                // We can force a removal from _knownState if the current view is used and entity is out of view
+                if (priority == PrioritizedEntity::DO_NOT_SEND) {
+                    _sendQueue.emplace(entity, PrioritizedEntity::FORCE_REMOVE, true);
+                } else if (priority == PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY) {
+                    _sendQueue.emplace(entity, PrioritizedEntity::WHEN_IN_DOUBT_PRIORITY, true);
+                }
             }
-        }
+        });
     }
 }
 
 void EntityTreeSendThread::deletingEntityPointer(EntityItem* entity) {
-    _knownState.erase(entity);
+    queueChange([this, entity] {
+        _knownState.erase(entity);
+    });
 }
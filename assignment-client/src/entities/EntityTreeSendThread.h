@@ -12,7 +12,10 @@
 #ifndef hifi_EntityTreeSendThread_h
 #define hifi_EntityTreeSendThread_h
 
+#include <functional>
+#include <mutex>
 #include <unordered_set>
+#include <vector>
 
 #include "../octree/OctreeSendThread.h"
 
@@ -20,6 +23,8 @@
 #include <EntityPriorityQueue.h>
 #include <shared/ConicalViewFrustum.h>
 
+#include "EntityViewCache.h"
+
 
 class EntityNodeData;
 class EntityItem;
@@ -49,8 +54,13 @@ private:
     bool hasSomethingToSend(OctreeQueryNode* nodeData) override { return !_sendQueue.empty(); }
     bool shouldStartNewTraversal(OctreeQueryNode* nodeData, bool viewFrustumChanged) override { return viewFrustumChanged || _traversal.finished(); }
 
+    // the slots below run on the server's thread, so they only queue changes for the next slice to apply
+    void queueChange(std::function<void()> change);
+    void applyQueuedChanges() override;
+
     DiffTraversal _traversal;
     EntityPriorityQueue _sendQueue;
+    std::shared_ptr<EntityViewCache::Entry> _viewCacheEntry; // results of the current First traversal, to share once complete
     std::unordered_map<EntityItem*, uint64_t> _knownState;
 
     // packet construction stuff
@@ -58,6 +68,9 @@ private:
     int32_t _numEntitiesOffset { 0 };
     uint16_t _numEntities { 0 };
 
+    std::mutex _queuedChangesMutex;
+    std::vector<std::function<void()>> _queuedChanges;
+
 private slots:
     void editingEntityPointer(const EntityItemPointer& entity);
     void deletingEntityPointer(EntityItem* entity);
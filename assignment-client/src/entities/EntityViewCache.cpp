@@ -0,0 +1,63 @@
+//
+//  EntityViewCache.cpp
+//  assignment-client/src/entities
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "EntityViewCache.h"
+
+#include <algorithm>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+// the older an entry, the more its users have to catch up on in their next Repeat traversal
+static const uint64_t MAX_ENTRY_AGE = USECS_PER_SECOND;
+static const size_t MAX_ENTRIES = 32;
+
+EntityViewCache::EntryPointer EntityViewCache::find(const DiffTraversal::View& view) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    pruneExpired(usecTimestampNow());
+
+    auto it = std::find_if(_entries.rbegin(), _entries.rend(), [&](const EntryPointer& entry) {
+        return entry->view.usesViewFrustums() == view.usesViewFrustums() && entry->view.isVerySimilar(view);
+    });
+    if (it == _entries.rend()) {
+        ++_numMisses;
+        return EntryPointer();
+    }
+
+    ++_numHits;
+    return *it;
+}
+
+void EntityViewCache::insert(EntryPointer entry) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    pruneExpired(usecTimestampNow());
+
+    // a newer entry supersedes any entry for a very similar view
+    _entries.erase(std::remove_if(_entries.begin(), _entries.end(), [&](const EntryPointer& other) {
+        return other->view.isVerySimilar(entry->view);
+    }), _entries.end());
+
+    if (_entries.size() >= MAX_ENTRIES) {
+        _entries.erase(_entries.begin());
+    }
+    _entries.push_back(std::move(entry));
+}
+
+int EntityViewCache::getNumEntries() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (int)_entries.size();
+}
+
+void EntityViewCache::pruneExpired(uint64_t now) {
+    // entries are inserted in order, but their traversals may have started in a different one
+    _entries.erase(std::remove_if(_entries.begin(), _entries.end(), [&](const EntryPointer& entry) {
+        return now > entry->view.startTime + MAX_ENTRY_AGE;
+    }), _entries.end());
+}
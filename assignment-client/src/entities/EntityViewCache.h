@@ -0,0 +1,53 @@
+//
+//  EntityViewCache.h
+//  assignment-client/src/entities
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_EntityViewCache_h
+#define hifi_EntityViewCache_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <DiffTraversal.h>
+#include <EntityPriorityQueue.h>
+
+// Results of complete First traversals, shared between the send threads of clients with very similar views
+//   Crowds at spawn points and events all start out looking at the same thing, so only the first of them
+//   needs to traverse the tree and prioritize its entities, the others fill their send queue from here.
+//   An entry holds what was visible when its traversal started, anything that changed since is picked up
+//   by the next Repeat traversal of whoever uses it.
+class EntityViewCache {
+public:
+    struct Entry {
+        DiffTraversal::View view;
+        std::vector<PrioritizedEntity> entities;
+    };
+    using EntryPointer = std::shared_ptr<const Entry>;
+
+    // returns the most recent entry for a very similar view, if any
+    EntryPointer find(const DiffTraversal::View& view);
+    void insert(EntryPointer entry);
+
+    int getNumEntries();
+    uint64_t getNumHits() const { return _numHits; }
+    uint64_t getNumMisses() const { return _numMisses; }
+
+private:
+    void pruneExpired(uint64_t now);
+
+    std::mutex _mutex;
+    std::vector<EntryPointer> _entries; // guarded by _mutex, oldest first
+
+    std::atomic<uint64_t> _numHits { 0 };
+    std::atomic<uint64_t> _numMisses { 0 };
+};
+
+#endif // hifi_EntityViewCache_h
@@ -0,0 +1,194 @@
+//
+//  OctreeSendPool.cpp
+//  assignment-client/src/octree
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeSendPool.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QThread>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+#include <ThreadHelpers.h>
+#include <UUID.h>
+
+#include "OctreeSendThread.h"
+#include "OctreeServerConsts.h"
+
+void OctreeSendPool::start(int numThreads) {
+    assert(_workers.empty());
+
+    if (numThreads <= 0) {
+        numThreads = QThread::idealThreadCount();
+        if (numThreads == -1) {
+            // idealThreadCount returns -1 if cores cannot be detected
+            static const int MAX_THREADS_IF_UNKNOWN = 4;
+            numThreads = MAX_THREADS_IF_UNKNOWN;
+        }
+    }
+
+    qDebug("%s: starting %d send threads", __FUNCTION__, numThreads);
+
+    {
+        Lock lock(_mutex);
+        _stopping = false;
+        _statsStart = usecTimestampNow();
+    }
+
+    for (int i = 0; i < numThreads; ++i) {
+        _workers.emplace_back([this] {
+            setThreadName("OctreeSendPoolThread");
+            work();
+        });
+    }
+}
+
+void OctreeSendPool::stop() {
+    {
+        Lock lock(_mutex);
+        _stopping = true;
+    }
+    _condition.notify_all();
+
+    for (auto& worker : _workers) {
+        worker.join();
+    }
+    _workers.clear();
+}
+
+void OctreeSendPool::add(OctreeSendThread* client) {
+    Lock lock(_mutex);
+    auto& state = _clients[client];
+    state.nodeUuid = client->getNodeUuid();
+    schedule(client, state, usecTimestampNow());
+}
+
+void OctreeSendPool::remove(OctreeSendThread* client) {
+    Lock lock(_mutex);
+    auto it = _clients.find(client);
+    if (it == _clients.end()) {
+        return;
+    }
+
+    auto& state = it->second;
+    state.isRemoved = true;
+    if (state.isScheduled) {
+        _schedule.erase(state.scheduled);
+        state.isScheduled = false;
+    }
+
+    if (!state.isRunning) {
+        _clients.erase(it);
+        return;
+    }
+
+    // the worker running it erases it once done
+    _removedCondition.wait(lock, [&] { return _clients.find(client) == _clients.end(); });
+}
+
+void OctreeSendPool::schedule(OctreeSendThread* client, Client& state, quint64 due) {
+    state.scheduled = _schedule.emplace(due, client);
+    state.isScheduled = true;
+
+    // idle workers only ever wait on the head of the schedule
+    if (state.scheduled == _schedule.begin()) {
+        _condition.notify_one();
+    }
+}
+
+void OctreeSendPool::work() {
+    Lock lock(_mutex);
+    while (!_stopping) {
+        if (_schedule.empty()) {
+            _condition.wait(lock);
+            continue;
+        }
+
+        auto next = _schedule.begin();
+        quint64 due = next->first;
+        quint64 now = usecTimestampNow();
+        if (due > now) {
+            _condition.wait_for(lock, std::chrono::microseconds(due - now));
+            continue;
+        }
+
+        OctreeSendThread* client = next->second;
+        auto& state = _clients.at(client);
+        _schedule.erase(next);
+        state.isScheduled = false;
+        state.isRunning = true;
+
+        lock.unlock();
+        quint64 start = usecTimestampNow();
+        bool keepRunning = client->processSlice();
+        if (!keepRunning) {
+            // still marked as running, so the server can't destroy the client before it hears of it
+            emit client->finished();
+        }
+        quint64 end = usecTimestampNow();
+        lock.lock();
+
+        state.isRunning = false;
+        quint64 queueLatency = start - due;
+        state.queueLatency.updateAverage((float)queueLatency);
+        state.maxQueueLatency = std::max(state.maxQueueLatency, queueLatency);
+        state.sliceTime.updateAverage((float)(end - start));
+        _busyTime += end - start;
+        ++_numSlices;
+
+        if (keepRunning && !state.isRemoved) {
+            schedule(client, state, start + OCTREE_SEND_INTERVAL_USECS);
+        } else {
+            _clients.erase(client);
+            _removedCondition.notify_all();
+        }
+    }
+}
+
+QJsonObject OctreeSendPool::getStats() {
+    Lock lock(_mutex);
+
+    quint64 now = usecTimestampNow();
+    quint64 elapsed = std::max<quint64>(now - _statsStart, 1);
+    int numThreads = getNumThreads();
+
+    QJsonObject clientsStats;
+    float totalQueueLatency = 0.0f;
+    quint64 maxQueueLatency = 0;
+    for (auto& it : _clients) {
+        auto& state = it.second;
+
+        QJsonObject clientStats;
+        clientStats["avg_queue_latency_usecs"] = state.queueLatency.getAverage();
+        clientStats["max_queue_latency_usecs"] = (double)state.maxQueueLatency;
+        clientStats["avg_slice_usecs"] = state.sliceTime.getAverage();
+        clientsStats[uuidStringWithoutCurlyBraces(state.nodeUuid)] = clientStats;
+
+        totalQueueLatency += state.queueLatency.getAverage();
+        maxQueueLatency = std::max(maxQueueLatency, state.maxQueueLatency);
+        state.maxQueueLatency = 0;
+    }
+
+    QJsonObject stats;
+    stats["1. threads"] = numThreads;
+    stats["2. clients"] = (int)_clients.size();
+    stats["3. slicesPerSecond"] = (double)_numSlices * USECS_PER_SECOND / elapsed;
+    stats["4. utilization"] = numThreads > 0 ? (double)_busyTime / (elapsed * numThreads) : 0.0;
+    stats["5. avgQueueLatency"] = _clients.empty() ? 0.0f : totalQueueLatency / _clients.size();
+    stats["6. maxQueueLatency"] = (double)maxQueueLatency;
+    stats["7. perClient"] = clientsStats;
+
+    _busyTime = 0;
+    _numSlices = 0;
+    _statsStart = now;
+
+    return stats;
+}
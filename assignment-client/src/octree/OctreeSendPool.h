@@ -0,0 +1,86 @@
+//
+//  OctreeSendPool.h
+//  assignment-client/src/octree
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeSendPool_h
+#define hifi_OctreeSendPool_h
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <QJsonObject>
+#include <QUuid>
+
+#include <SimpleMovingAverage.h>
+
+class OctreeSendThread;
+
+// Fixed set of worker threads sending octree data to every client of a server
+//   Each client is scheduled once per send interval, and workers always run the client that has been due the
+//   longest, so an overloaded pool delays every client evenly instead of starving some of them.
+//   Queue latency is the time a client waited past its due time for a worker to pick it up.
+class OctreeSendPool {
+    using Mutex = std::mutex;
+    using Lock = std::unique_lock<Mutex>;
+    using ConditionVariable = std::condition_variable;
+    using Schedule = std::multimap<quint64, OctreeSendThread*>;
+
+public:
+    OctreeSendPool() = default;
+    ~OctreeSendPool() { stop(); }
+
+    // start the workers, 0 picks one per core
+    void start(int numThreads);
+    void stop();
+    int getNumThreads() const { return (int)_workers.size(); }
+
+    // schedule a client to run right away
+    void add(OctreeSendThread* client);
+
+    // unschedule a client, waiting for any worker currently running it
+    void remove(OctreeSendThread* client);
+
+    // stats since the last call
+    QJsonObject getStats();
+
+private:
+    struct Client {
+        QUuid nodeUuid;
+        Schedule::iterator scheduled;
+        bool isScheduled { false };
+        bool isRunning { false };
+        bool isRemoved { false };
+        SimpleMovingAverage queueLatency { 100 };
+        SimpleMovingAverage sliceTime { 100 };
+        quint64 maxQueueLatency { 0 };
+    };
+
+    void work();
+    void schedule(OctreeSendThread* client, Client& state, quint64 due);
+
+    Mutex _mutex;
+    ConditionVariable _condition;
+    ConditionVariable _removedCondition;
+    Schedule _schedule;
+    std::unordered_map<OctreeSendThread*, Client> _clients;
+    std::vector<std::thread> _workers;
+    bool _stopping { false };
+
+    // guarded by _mutex, reset by getStats
+    quint64 _busyTime { 0 };
+    quint64 _numSlices { 0 };
+    quint64 _statsStart { 0 };
+};
+
+#endif // hifi_OctreeSendPool_h
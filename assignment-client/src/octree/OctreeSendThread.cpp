@@ -67,13 +67,41 @@ void OctreeSendThread::setIsShuttingDown() {
 
 
 bool OctreeSendThread::process() {
+    quint64  start = usecTimestampNow();
+
+    if (!processSlice()) {
+        return false; // exit early if we're shutting down
+    }
+
+    // Only sleep if we're still running and we got the lock last time we tried, otherwise try to get the lock asap
+    if (isStillRunning()) {
+        // dynamically sleep until we need to fire off the next set of octree elements
+        int elapsed = (usecTimestampNow() - start);
+        int usecToSleep =  OCTREE_SEND_INTERVAL_USECS - elapsed;
+
+        if (usecToSleep <= 0) {
+            const int MIN_USEC_TO_SLEEP = 1;
+            usecToSleep = MIN_USEC_TO_SLEEP;
+        }
+
+        {
+            PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
+            std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
+        }
+
+    }
+
+    return isStillRunning();  // keep running till they terminate us
+}
+
+bool OctreeSendThread::processSlice() {
     if (_isShuttingDown) {
         return false; // exit early if we're shutting down
     }
 
     OctreeServer::didProcess(this);
 
-    quint64  start = usecTimestampNow();
+    applyQueuedChanges();
 
     // we'd better have a server at this point, or we're in trouble
     assert(_myServer);
@@ -97,29 +125,7 @@ bool OctreeSendThread::process() {
         }
     }
 
-    if (_isShuttingDown) {
-        return false; // exit early if we're shutting down
-    }
-
-    // Only sleep if we're still running and we got the lock last time we tried, otherwise try to get the lock asap
-    if (isStillRunning()) {
-        // dynamically sleep until we need to fire off the next set of octree elements
-        int elapsed = (usecTimestampNow() - start);
-        int usecToSleep =  OCTREE_SEND_INTERVAL_USECS - elapsed;
-
-        if (usecToSleep <= 0) {
-            const int MIN_USEC_TO_SLEEP = 1;
-            usecToSleep = MIN_USEC_TO_SLEEP;
-        }
-
-        {
-            PerformanceWarning warn(false,"OctreeSendThread... usleep()",false,&_usleepTime,&_usleepCalls);
-            std::this_thread::sleep_for(std::chrono::microseconds(usecToSleep));
-        }
-
-    }
-
-    return isStillRunning();  // keep running till they terminate us
+    return !_isShuttingDown;
 }
 
 AtomicUIntStat OctreeSendThread::_usleepTime { 0 };
@@ -26,7 +26,7 @@ class OctreeServer;
 
 using AtomicUIntStat = std::atomic<uintmax_t>;
 
-/// Threaded processor for sending octree packets to a single client
+/// Processor for sending octree packets to a single client, run on its own thread or in its server's OctreeSendPool
 class OctreeSendThread : public GenericThread {
     Q_OBJECT
 public:
@@ -38,6 +38,9 @@ public:
 
     QUuid getNodeUuid() const { return _nodeUuid; }
 
+    /// Sends one interval's worth of data without sleeping, returns false once this client is done.
+    bool processSlice();
+
     static AtomicUIntStat _totalBytes;
     static AtomicUIntStat _totalWastedBytes;
     static AtomicUIntStat _totalPackets;
@@ -56,6 +59,9 @@ protected:
             bool viewFrustumChanged, bool isFullScene);
     virtual bool traverseTreeAndBuildNextPacketPayload(EncodeBitstreamParams& params, const QJsonObject& jsonFilters) = 0;
 
+    /// Called at the start of each slice, on the thread sending for this client
+    virtual void applyQueuedChanges() { }
+
     OctreePacketData _packetData;
     QWeakPointer<Node> _node;
     OctreeServer* _myServer { nullptr };
@@ -73,7 +79,7 @@ private:
     int _truePacketsSent { 0 }; // available for debug stats
     int _trueBytesSent { 0 }; // available for debug stats
     int _packetsSentThisInterval { 0 }; // used for bandwidth throttle condition
-    bool _isShuttingDown { false };
+    std::atomic<bool> _isShuttingDown { false };
 };
 
 #endif // hifi_OctreeSendThread_h
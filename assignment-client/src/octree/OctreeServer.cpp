@@ -904,18 +904,28 @@ void OctreeServer::parsePayload() {
 OctreeServer::UniqueSendThread OctreeServer::createSendThread(const SharedNodePointer& node) {
     auto sendThread = newSendThread(node);
 
-    // we want to be notified when the thread finishes
-    connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread);
-    sendThread->initialize(true);
+    // we want to be notified when the client is done, the pool emits finished from one of its workers
+    connect(sendThread.get(), &GenericThread::finished, this, &OctreeServer::removeSendThread, Qt::QueuedConnection);
+    sendThread->initialize(false);
+    _sendPool.add(sendThread.get());
 
     return sendThread;
 }
 
+void OctreeServer::eraseSendThread(SendThreads::iterator it) {
+    // make sure no worker is still sending for it before it is destructed
+    _sendPool.remove(it->second.get());
+    _sendThreads.erase(it);
+}
+
 void OctreeServer::removeSendThread() {
     // If the object has been deleted since the event was queued, sender() will return nullptr
     if (auto sendThread = qobject_cast<OctreeSendThread*>(sender())) {
-        // This deletes the unique_ptr, so sendThread is destructed after that line
-        _sendThreads.erase(sendThread->getNodeUuid());
+        auto it = _sendThreads.find(sendThread->getNodeUuid());
+        if (it != _sendThreads.end() && it->second.get() == sendThread) {
+            // This deletes the unique_ptr, so sendThread is destructed after that line
+            eraseSendThread(it);
+        }
     }
 }
 
@@ -930,7 +940,7 @@ void OctreeServer::handleOctreeQueryPacket(QSharedPointer<ReceivedMessage> messa
         if (it == _sendThreads.end()) {
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         } else if (it->second->isShuttingDown()) {
-            _sendThreads.erase(it); // Remove right away and wait on thread to be
+            eraseSendThread(it); // Remove right away and wait on the pool to be done with it
 
             _sendThreads.emplace(senderNode->getUUID(), createSendThread(senderNode));
         }
@@ -1078,6 +1088,15 @@ void OctreeServer::readConfiguration() {
         qDebug() << "persisAbsoluteFilePath=" << _persistAbsoluteFilePath;
 
         _persistAsFileType = "json.gz";
+        QString persistFileType;
+        if (readOptionString("persistFileType", settingsSectionObject, persistFileType) && !persistFileType.isEmpty()) {
+            if (PERSIST_EXTENSIONS.contains(persistFileType)) {
+                _persistAsFileType = persistFileType;
+            } else {
+                qWarning() << "Unknown persist file type" << persistFileType << "- using" << _persistAsFileType;
+            }
+        }
+        qDebug() << "persistFileType=" << _persistAsFileType;
 
         _persistInterval = OctreePersistThread::DEFAULT_PERSIST_INTERVAL;
         int result { -1 };
@@ -1127,6 +1146,9 @@ void OctreeServer::readConfiguration() {
                     packetsPerSecondTotalMax, _packetsTotalPerInterval);
 
 
+    readOptionInt(QString("sendThreads"), settingsSectionObject, _numSendThreads);
+    qDebug("sendThreads=%d", _numSendThreads);
+
     readAdditionalConfiguration(settingsSectionObject);
 }
 
@@ -1160,19 +1182,20 @@ void OctreeServer::domainSettingsRequestComplete() {
 
     readConfiguration();
 
+    _sendPool.start(_numSendThreads);
+
     // if we want Persistence, set up the local file and persist thread
     if (_wantPersist) {
-        static const QString ENTITY_PERSIST_EXTENSION = ".json.gz";
+        // force the persist file to end with the extension of its type, with the right casing
+        _persistAbsoluteFilePath = fileNameWithoutExtension(_persistAbsoluteFilePath, PERSIST_EXTENSIONS) + "." + _persistAsFileType;
 
-        // force the persist file to end with .json.gz
-        if (!_persistAbsoluteFilePath.endsWith(ENTITY_PERSIST_EXTENSION, Qt::CaseInsensitive)) {
-            _persistAbsoluteFilePath += ENTITY_PERSIST_EXTENSION;
-        } else {
-            // make sure the casing of .json.gz is correct
-            _persistAbsoluteFilePath.replace(ENTITY_PERSIST_EXTENSION, ENTITY_PERSIST_EXTENSION, Qt::CaseInsensitive);
+        // a binary snapshot is created from the JSON persist file next to it, so that is the file looked for below
+        QString jsonPersistFilePath = _persistAbsoluteFilePath;
+        if (_persistAsFileType == "bin") {
+            jsonPersistFilePath = fileNameWithoutExtension(_persistAbsoluteFilePath, PERSIST_EXTENSIONS) + ".json.gz";
         }
 
-        if (!QFile::exists(_persistAbsoluteFilePath)) {
+        if (!QFile::exists(_persistAbsoluteFilePath) && !QFile::exists(jsonPersistFilePath)) {
             qDebug() << "Persist file does not exist, checking for existence of persist file next to application";
 
             static const QString OLD_DEFAULT_PERSIST_FILENAME = "resources/models.json.gz";
@@ -1206,9 +1229,9 @@ void OctreeServer::domainSettingsRequestComplete() {
             }
 
             if (shouldCopy) {
-                qDebug() << "Old persist file found, copying from " << pathToCopyFrom << " to " << _persistAbsoluteFilePath;
+                qDebug() << "Old persist file found, copying from " << pathToCopyFrom << " to " << jsonPersistFilePath;
 
-                QFile::copy(pathToCopyFrom, _persistAbsoluteFilePath);
+                QFile::copy(pathToCopyFrom, jsonPersistFilePath);
             } else {
                 qDebug() << "No existing persist file found";
             }
@@ -1330,8 +1353,9 @@ void OctreeServer::aboutToFinish() {
         sendThread.terminate();
     }
 
-    // Clear will destruct all the unique_ptr to OctreeSendThreads which will call the GenericThread's dtor
-    // which waits on the thread to be done before returning
+    // Stopping the pool waits on its workers to be done with their current client,
+    // after which nothing else references the OctreeSendThreads
+    _sendPool.stop();
     _sendThreads.clear(); // Cleans up all the send threads.
 
     if (_persistManager) {
@@ -1464,6 +1488,7 @@ void OctreeServer::sendStatsPacket() {
     statsArray1["4. persistFileLoadTime"] = getFileLoadTime();
     statsArray1["5. clients"] = getCurrentClientCount();
     statsArray1["6. threads"] = threadsStats;
+    statsArray1["7. sendPool"] = _sendPool.getStats();
     statsArray1["uptime_seconds"] = getUptimeSeconds();
     statsArray1["persistFileLoadTime_seconds"] = getFileLoadTimeSeconds();
 
@@ -24,6 +24,7 @@
 #include <ThreadedAssignment.h>
 
 #include "OctreePersistThread.h"
+#include "OctreeSendPool.h"
 #include "OctreeSendThread.h"
 #include "OctreeServerConsts.h"
 #include "OctreeInboundPacketProcessor.h"
@@ -168,6 +169,7 @@ protected:
     void beginRunning();
     
     UniqueSendThread createSendThread(const SharedNodePointer& node);
+    void eraseSendThread(SendThreads::iterator it);
     virtual UniqueSendThread newSendThread(const SharedNodePointer& node) = 0;
 
     int _argc;
@@ -203,7 +205,9 @@ protected:
     time_t _started;
     quint64 _startedUSecs;
     QString _safeServerName;
-    
+
+    int _numSendThreads { 0 };
+    OctreeSendPool _sendPool; // declared before _sendThreads, so it outlives them
     SendThreads _sendThreads;
 
     static int _clientCount;
@@ -105,6 +105,12 @@ EntityScriptServer::EntityScriptServer(ReceivedMessage& message) : ThreadedAssig
     timer->setInterval(LOG_INTERVAL);
     connect(timer, &QTimer::timeout, this, &EntityScriptServer::pushLogs);
     timer->start();
+
+    static const int REBALANCE_INTERVAL = 5 * MSECS_PER_SECOND;
+    auto rebalanceTimer = new QTimer(this);
+    rebalanceTimer->setInterval(REBALANCE_INTERVAL);
+    connect(rebalanceTimer, &QTimer::timeout, this, &EntityScriptServer::rebalanceScriptShards);
+    rebalanceTimer->start();
 }
 
 EntityScriptServer::~EntityScriptServer() {
@@ -134,7 +140,8 @@ void EntityScriptServer::handleEntityScriptGetStatusPacket(QSharedPointer<Receiv
         replyPacketList->writePrimitive(messageID);
 
         EntityScriptDetails details;
-        if (_entitiesScriptManager->getEntityScriptDetails(entityID, details)) {
+        auto manager = _scriptShards ? _scriptShards->find(entityID) : ScriptManagerPointer();
+        if (manager && manager->getEntityScriptDetails(entityID, details)) {
             replyPacketList->writePrimitive(true);
             replyPacketList->writePrimitive(details.status);
             replyPacketList->writeString(details.errorInfo);
@@ -169,6 +176,38 @@ void EntityScriptServer::handleSettings() {
     static const QString MAX_ENTITY_PPS_OPTION = "max_total_entity_pps";
     static const QString ENTITY_PPS_PER_SCRIPT = "entity_pps_per_script";
 
+    static const QString SCRIPT_SHARDS_OPTION = "script_shards";
+    static const QString SCRIPT_SHARD_ASSIGNMENT_OPTION = "script_shard_assignment";
+    static const QString SCRIPT_SHARD_FRAME_BUDGET_OPTION = "script_shard_frame_budget";
+    static const int MAX_SCRIPT_SHARDS = 64;
+
+    int numScriptShards = std::min(std::max(1, entityScriptServerSettings[SCRIPT_SHARDS_OPTION].toInt(1)), MAX_SCRIPT_SHARDS);
+    _assignScriptShardsByHash = entityScriptServerSettings[SCRIPT_SHARD_ASSIGNMENT_OPTION].toString() == "hash";
+    _scriptShardFrameBudget = std::max(1, entityScriptServerSettings[SCRIPT_SHARD_FRAME_BUDGET_OPTION]
+                                          .toInt((int)(DEFAULT_SCRIPT_SHARD_FRAME_BUDGET / USECS_PER_MSEC))) * USECS_PER_MSEC;
+
+    if (numScriptShards != _numScriptShards) {
+        _numScriptShards = numScriptShards;
+        if (_scriptShards && _scriptShards->getNumAssigned() == 0 && !_shuttingDown) {
+            // nothing runs yet, so the engines can be replaced right away
+            for (const auto& manager : _scriptShards->getManagers()) {
+                manager->stop();
+                manager->waitTillDoneRunning();
+            }
+            resetEntitiesScriptEngine();
+        } else {
+            qCInfo(entity_script_server) << "The number of script shards changes to" << _numScriptShards
+                                         << "when the entity scripts are next reset";
+        }
+    }
+    if (_scriptShards) {
+        _scriptShards->setAssignByHash(_assignScriptShardsByHash);
+    }
+
+    qCInfo(entity_script_server) << "Script shards:" << _numScriptShards
+                                 << (_assignScriptShardsByHash ? "assigned by entity ID" : "assigned by load")
+                                 << "frame budget (us):" << _scriptShardFrameBudget;
+
     if (!entityScriptServerSettings.contains(MAX_ENTITY_PPS_OPTION) || !entityScriptServerSettings.contains(ENTITY_PPS_PER_SCRIPT)) {
         qWarning() << "Received settings from the domain-server with no max_total_entity_pps or entity_pps_per_script properties.";
         return;
@@ -182,7 +221,7 @@ void EntityScriptServer::handleSettings() {
 }
 
 void EntityScriptServer::updateEntityPPS() {
-    int numRunningScripts = _entitiesScriptManager->getNumRunningEntityScripts();
+    int numRunningScripts = _scriptShards ? _scriptShards->getNumRunningEntityScripts() : 0;
     int pps;
     if (std::numeric_limits<int>::max() / _entityPPSPerScript < numRunningScripts) {
         qWarning() << QString("Integer multiplication would overflow, clamping to maxint: %1 * %2").arg(numRunningScripts).arg(_entityPPSPerScript);
@@ -243,7 +282,7 @@ void EntityScriptServer::pushLogs() {
 
 void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> receivedMessage, SharedNodePointer senderNode) {
 
-    if (_entitiesScriptManager && _entityViewer.getTree() && !_shuttingDown) {
+    if (_scriptShards && _entityViewer.getTree() && !_shuttingDown) {
         auto entityID = QUuid::fromRfc4122(receivedMessage->read(NUM_BYTES_RFC4122_UUID));
 
         auto method = receivedMessage->readString();
@@ -257,8 +296,33 @@ void EntityScriptServer::handleEntityScriptCallMethodPacket(QSharedPointer<Recei
             params << paramString;
         }
 
-        _entitiesScriptManager->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+        _scriptShards->callEntityScriptMethod(entityID, method, params, senderNode->getUUID());
+    }
+}
+
+void EntityScriptServer::rebalanceScriptShards() {
+    if (!_scriptShards || !_entityViewer.getTree() || _shuttingDown) {
+        return;
+    }
+
+    EntityItemID entityID;
+    ScriptManagerPointer from;
+    ScriptManagerPointer to;
+    if (!_scriptShards->rebalance(_scriptShardFrameBudget, entityID, from, to)) {
+        return;
+    }
+
+    // scripts keep their state in their engine, so a moved script starts over, like on a reload
+    from->unloadEntityScript(entityID, true);
+    EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
+    QString scriptUrl = entity ? entity->getServerScripts() : QString();
+    if (scriptUrl.isEmpty()) {
+        _scriptShards->unassign(entityID);
+        return;
     }
+    qCDebug(entity_script_server) << "Moving the script of" << entityID << "to a less busy script shard";
+    scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
+    to->loadEntityScript(entityID, scriptUrl, false);
 }
 
 
@@ -452,67 +516,93 @@ void EntityScriptServer::selectAudioFormat(const QString& selectedCodecName) {
 }
 
 void EntityScriptServer::resetEntitiesScriptEngine() {
-    auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
-    auto newManager = scriptManagerFactory(ScriptManager::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
-    auto newEngine = newManager->engine();
-
-    auto webSocketServerConstructorValue = newEngine->newFunction(WebSocketServerClass::constructor);
-    newEngine->globalObject().setProperty("WebSocketServer", webSocketServerConstructorValue);
-
-    newEngine->registerGlobalObject("SoundCache", DependencyManager::get<SoundCacheScriptingInterface>().data());
-    newEngine->registerGlobalObject("AvatarList", DependencyManager::get<AvatarHashMap>().data());
-
-    // connect this script engines printedMessage signal to the global ScriptEngines these various messages
-    auto scriptEngines = DependencyManager::get<ScriptEngines>().data();
-    connect(newManager.get(), &ScriptManager::printedMessage, scriptEngines, &ScriptEngines::onPrintedMessage);
-    connect(newManager.get(), &ScriptManager::errorMessage, scriptEngines, &ScriptEngines::onErrorMessage);
-    connect(newManager.get(), &ScriptManager::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
-    connect(newManager.get(), &ScriptManager::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
-
-    connect(newManager.get(), &ScriptManager::update, this, [this] {
-        _entityViewer.queryOctree();
-        _entityViewer.getTree()->preUpdate();
-        _entityViewer.getTree()->update();
-    });
+    if (!_scriptShards) {
+        _scriptShards = std::make_shared<EntityScriptShards>();
+    }
 
-    scriptEngines->runScriptInitializers(newManager);
-    newManager->runInThread();
-    std::shared_ptr<EntitiesScriptEngineProvider> newEngineSP = newManager;
-    // On the entity script server, these are the same
-    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(newEngineSP);
-    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(newEngineSP);
+    std::vector<ScriptManagerPointer> newManagers;
+    for (int shard = 0; shard < _numScriptShards; ++shard) {
+        auto engineName = QString("about:Entities %1").arg(++_entitiesScriptEngineCount);
+        auto newManager = scriptManagerFactory(ScriptManager::ENTITY_SERVER_SCRIPT, NO_SCRIPT, engineName);
+        auto newEngine = newManager->engine();
+
+        auto webSocketServerConstructorValue = newEngine->newFunction(WebSocketServerClass::constructor);
+        newEngine->globalObject().setProperty("WebSocketServer", webSocketServerConstructorValue);
+
+        newEngine->registerGlobalObject("SoundCache", DependencyManager::get<SoundCacheScriptingInterface>().data());
+        newEngine->registerGlobalObject("AvatarList", DependencyManager::get<AvatarHashMap>().data());
+
+        // connect this script engines printedMessage signal to the global ScriptEngines these various messages
+        auto scriptEngines = DependencyManager::get<ScriptEngines>().data();
+        connect(newManager.get(), &ScriptManager::printedMessage, scriptEngines, &ScriptEngines::onPrintedMessage);
+        connect(newManager.get(), &ScriptManager::errorMessage, scriptEngines, &ScriptEngines::onErrorMessage);
+        connect(newManager.get(), &ScriptManager::warningMessage, scriptEngines, &ScriptEngines::onWarningMessage);
+        connect(newManager.get(), &ScriptManager::infoMessage, scriptEngines, &ScriptEngines::onInfoMessage);
+
+        // the entity tree only needs to be updated once per frame, let the first shard drive it
+        if (shard == 0) {
+            connect(newManager.get(), &ScriptManager::update, this, [this] {
+                _entityViewer.queryOctree();
+                _entityViewer.getTree()->preUpdate();
+                _entityViewer.getTree()->update();
+            });
+        }
+
+        // the time a shard's frames spend in script updates and timers, an idle shard records close to zero
+        std::weak_ptr<EntityScriptShards> weakShards = _scriptShards;
+        connect(newManager.get(), &ScriptManager::frameExecuted, newManager.get(),
+                [weakShards, shard](quint64 executionUsecs) {
+            if (auto shards = weakShards.lock()) {
+                shards->recordFrame(shard, executionUsecs);
+            }
+        }, Qt::DirectConnection);
+
+        connect(newManager.get(), &ScriptManager::entityScriptDetailsUpdated, this, &EntityScriptServer::updateEntityPPS);
 
-    if (_entitiesScriptManager) {
-        disconnect(_entitiesScriptManager.get(), &ScriptManager::entityScriptDetailsUpdated,
+        scriptEngines->runScriptInitializers(newManager);
+        newManager->runInThread();
+        newManagers.push_back(newManager);
+    }
+
+    for (const auto& oldManager : _scriptShards->getManagers()) {
+        disconnect(oldManager.get(), &ScriptManager::entityScriptDetailsUpdated,
                    this, &EntityScriptServer::updateEntityPPS);
     }
+    _scriptShards->setManagers(std::move(newManagers));
+    _scriptShards->setAssignByHash(_assignScriptShardsByHash);
 
-    _entitiesScriptManager.swap(newManager);
-    connect(_entitiesScriptManager.get(), &ScriptManager::entityScriptDetailsUpdated,
-            this, &EntityScriptServer::updateEntityPPS);
+    // On the entity script server, these are the same
+    DependencyManager::get<EntityScriptingInterface>()->setPersistentEntitiesScriptEngine(_scriptShards);
+    DependencyManager::get<EntityScriptingInterface>()->setNonPersistentEntitiesScriptEngine(_scriptShards);
 }
 
 
 void EntityScriptServer::clear() {
-    // unload and stop the engine
-    if (_entitiesScriptManager) {
-        // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
-        _entitiesScriptManager->unloadAllEntityScripts();
-        _entitiesScriptManager->stop();
-        _entitiesScriptManager->waitTillDoneRunning();
+    // unload and stop the engines
+    if (_scriptShards) {
+        for (const auto& manager : _scriptShards->getManagers()) {
+            // do this here (instead of in deleter) to avoid marshalling unload signals back to this thread
+            manager->unloadAllEntityScripts();
+            manager->stop();
+        }
+        for (const auto& manager : _scriptShards->getManagers()) {
+            manager->waitTillDoneRunning();
+        }
     }
 
     _entityViewer.clear();
 
-    // reset the engine
+    // reset the engines
     if (!_shuttingDown) {
         resetEntitiesScriptEngine();
     }
 }
 
 void EntityScriptServer::shutdownScriptEngine() {
-    if (_entitiesScriptManager) {
-        _entitiesScriptManager->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+    if (_scriptShards) {
+        for (const auto& manager : _scriptShards->getManagers()) {
+            manager->disconnectNonEssentialSignals(); // disconnect all slots/signals from the script engine, except essential
+        }
     }
     _shuttingDown = true;
 
@@ -521,7 +611,9 @@ void EntityScriptServer::shutdownScriptEngine() {
     auto scriptEngines = DependencyManager::get<ScriptEngines>();
     scriptEngines->shutdownScripting();
 
-    _entitiesScriptManager.reset();
+    if (_scriptShards) {
+        _scriptShards->setManagers({});
+    }
 
     auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
     // our entity tree is going to go away so tell that to the EntityScriptingInterface
@@ -539,8 +631,12 @@ void EntityScriptServer::addingEntity(const EntityItemID& entityID) {
 }
 
 void EntityScriptServer::deletingEntity(const EntityItemID& entityID) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptManager) {
-        _entitiesScriptManager->unloadEntityScript(entityID, true);
+    if (_entityViewer.getTree() && !_shuttingDown && _scriptShards) {
+        auto manager = _scriptShards->find(entityID);
+        if (manager) {
+            manager->unloadEntityScript(entityID, true);
+            _scriptShards->unassign(entityID);
+        }
     }
 }
 
@@ -551,20 +647,23 @@ void EntityScriptServer::entityServerScriptChanging(const EntityItemID& entityID
 }
 
 void EntityScriptServer::checkAndCallPreload(const EntityItemID& entityID, bool forceRedownload) {
-    if (_entityViewer.getTree() && !_shuttingDown && _entitiesScriptManager) {
+    if (_entityViewer.getTree() && !_shuttingDown && _scriptShards) {
 
         EntityItemPointer entity = _entityViewer.getTree()->findEntityByEntityItemID(entityID);
         EntityScriptDetails details;
-        bool isRunning = _entitiesScriptManager->getEntityScriptDetails(entityID, details);
+        auto manager = _scriptShards->find(entityID);
+        bool isRunning = manager && manager->getEntityScriptDetails(entityID, details);
         if (entity && (forceRedownload || !isRunning || details.scriptText != entity->getServerScripts())) {
             if (isRunning) {
-                _entitiesScriptManager->unloadEntityScript(entityID, true);
+                manager->unloadEntityScript(entityID, true);
             }
 
             QString scriptUrl = entity->getServerScripts();
             if (!scriptUrl.isEmpty()) {
                 scriptUrl = DependencyManager::get<ResourceManager>()->normalizeURL(scriptUrl);
-                _entitiesScriptManager->loadEntityScript(entityID, scriptUrl, forceRedownload);
+                _scriptShards->assign(entityID)->loadEntityScript(entityID, scriptUrl, forceRedownload);
+            } else {
+                _scriptShards->unassign(entityID);
             }
         }
     }
@@ -581,9 +680,10 @@ void EntityScriptServer::sendStatsPacket() {
 
     QJsonObject scriptEngineStats;
     int numberRunningScripts = 0;
-    const auto scriptManager = _entitiesScriptManager;
-    if (scriptManager) {
-        numberRunningScripts = scriptManager->getNumRunningEntityScripts();
+    const auto scriptShards = _scriptShards;
+    if (scriptShards) {
+        numberRunningScripts = scriptShards->getNumRunningEntityScripts();
+        scriptEngineStats["shards"] = scriptShards->getStats();
     }
     scriptEngineStats["number_running_scripts"] = numberRunningScripts;
     statsObject["script_engine_stats"] = scriptEngineStats;
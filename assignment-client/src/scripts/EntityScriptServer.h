@@ -23,12 +23,14 @@
 #include <QtCore/QSharedPointer>
 
 #include <EntityEditPacketSender.h>
+#include <NumericalConstants.h>
 #include <plugins/CodecPlugin.h>
 #include <SimpleEntitySimulation.h>
 #include <ThreadedAssignment.h>
 #include <ScriptManager.h>
 
 #include "../entities/EntityTreeHeadlessViewer.h"
+#include "EntityScriptShards.h"
 
 class EntityScriptServer : public ThreadedAssignment {
     Q_OBJECT
@@ -61,6 +63,7 @@ private slots:
 
     void handleEntityScriptCallMethodPacket(QSharedPointer<ReceivedMessage> message, SharedNodePointer senderNode);
 
+    void rebalanceScriptShards();
 
 private:
     void negotiateAudioFormat();
@@ -80,7 +83,11 @@ private:
     bool _shuttingDown { false };
 
     static int _entitiesScriptEngineCount;
-    ScriptManagerPointer _entitiesScriptManager;
+    static const uint64_t DEFAULT_SCRIPT_SHARD_FRAME_BUDGET = 12 * USECS_PER_MSEC;
+    EntityScriptShardsPointer _scriptShards;
+    int _numScriptShards { 1 };
+    bool _assignScriptShardsByHash { false };
+    uint64_t _scriptShardFrameBudget { DEFAULT_SCRIPT_SHARD_FRAME_BUDGET };
     SimpleEntitySimulationPointer _entitySimulation;
     EntityEditPacketSender _entityEditSender;
     EntityTreeHeadlessViewer _entityViewer;
@@ -0,0 +1,224 @@
+//
+//  EntityScriptShards.cpp
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "EntityScriptShards.h"
+
+#include <algorithm>
+
+#include <NumericalConstants.h>
+#include <SharedUtil.h>
+
+// how quickly the average frame time follows the actual frame times
+static const float FRAME_TIME_SMOOTHING = 0.05f;
+// a moved script needs time to load before its old and new shard are measured again
+static const uint64_t MIN_TIME_BETWEEN_MOVES = 10 * USECS_PER_SECOND;
+
+using Lock = std::lock_guard<std::mutex>;
+
+void EntityScriptShards::setManagers(std::vector<ScriptManagerPointer> managers) {
+    Lock lock(_mutex);
+    _shards.clear();
+    _shards.resize(managers.size());
+    for (size_t i = 0; i < managers.size(); ++i) {
+        _shards[i].manager = std::move(managers[i]);
+    }
+    _entityShards.clear();
+}
+
+std::vector<ScriptManagerPointer> EntityScriptShards::getManagers() const {
+    Lock lock(_mutex);
+    std::vector<ScriptManagerPointer> managers;
+    managers.reserve(_shards.size());
+    for (const auto& shard : _shards) {
+        managers.push_back(shard.manager);
+    }
+    return managers;
+}
+
+int EntityScriptShards::getNumShards() const {
+    Lock lock(_mutex);
+    return (int)_shards.size();
+}
+
+void EntityScriptShards::setAssignByHash(bool assignByHash) {
+    Lock lock(_mutex);
+    _assignByHash = assignByHash;
+}
+
+ScriptManagerPointer EntityScriptShards::find(const EntityItemID& entityID) const {
+    Lock lock(_mutex);
+    auto it = _entityShards.constFind(entityID);
+    if (it == _entityShards.constEnd()) {
+        return ScriptManagerPointer();
+    }
+    return _shards[it.value()].manager;
+}
+
+ScriptManagerPointer EntityScriptShards::assign(const EntityItemID& entityID) {
+    Lock lock(_mutex);
+    if (_shards.empty()) {
+        return ScriptManagerPointer();
+    }
+
+    auto it = _entityShards.constFind(entityID);
+    if (it != _entityShards.constEnd()) {
+        return _shards[it.value()].manager;
+    }
+
+    int index = _assignByHash ? (int)(qHash(entityID) % _shards.size()) : leastLoaded();
+    _entityShards.insert(entityID, index);
+    _shards[index].assigned.push_back(entityID);
+    return _shards[index].manager;
+}
+
+void EntityScriptShards::unassign(const EntityItemID& entityID) {
+    Lock lock(_mutex);
+    auto it = _entityShards.find(entityID);
+    if (it == _entityShards.end()) {
+        return;
+    }
+
+    auto& assigned = _shards[it.value()].assigned;
+    assigned.erase(std::remove(assigned.begin(), assigned.end(), entityID), assigned.end());
+    _entityShards.erase(it);
+}
+
+int EntityScriptShards::getNumAssigned() const {
+    Lock lock(_mutex);
+    return (int)_entityShards.size();
+}
+
+void EntityScriptShards::recordFrame(int shard, quint64 executionUsecs) {
+    float frameUsecs = (float)executionUsecs;
+
+    Lock lock(_mutex);
+    if (shard < 0 || shard >= (int)_shards.size()) {
+        return;
+    }
+
+    auto& stats = _shards[shard];
+    if (stats.averageFrameUsecs == 0.0f) {
+        stats.averageFrameUsecs = frameUsecs;
+    } else {
+        stats.averageFrameUsecs += FRAME_TIME_SMOOTHING * (frameUsecs - stats.averageFrameUsecs);
+    }
+    stats.maxFrameUsecs = std::max(stats.maxFrameUsecs, frameUsecs);
+}
+
+bool EntityScriptShards::rebalance(uint64_t frameBudgetUsecs, EntityItemID& movedEntityID,
+                                   ScriptManagerPointer& from, ScriptManagerPointer& to) {
+    Lock lock(_mutex);
+    if (_assignByHash) {
+        return false;
+    }
+    auto now = usecTimestampNow();
+
+    // the busiest shard over budget that has a script to spare and hasn't just given one away
+    int busiest = -1;
+    for (int i = 0; i < (int)_shards.size(); ++i) {
+        const auto& shard = _shards[i];
+        if (shard.averageFrameUsecs > frameBudgetUsecs && shard.assigned.size() > 1 &&
+            now - shard.lastMoveTime > MIN_TIME_BETWEEN_MOVES &&
+            (busiest == -1 || shard.averageFrameUsecs > _shards[busiest].averageFrameUsecs)) {
+            busiest = i;
+        }
+    }
+    if (busiest == -1) {
+        return false;
+    }
+
+    int target = leastLoaded(busiest);
+    if (target == -1 || _shards[target].averageFrameUsecs > frameBudgetUsecs) {
+        return false;
+    }
+
+    // the most recently assigned script has the least state to lose by being reloaded
+    auto& source = _shards[busiest];
+    movedEntityID = source.assigned.back();
+    source.assigned.pop_back();
+    source.lastMoveTime = now;
+    ++source.numMovedOut;
+
+    _shards[target].assigned.push_back(movedEntityID);
+    _shards[target].lastMoveTime = now;
+    _entityShards[movedEntityID] = target;
+
+    from = source.manager;
+    to = _shards[target].manager;
+    return true;
+}
+
+int EntityScriptShards::getNumRunningEntityScripts() const {
+    int numRunning = 0;
+    for (const auto& manager : getManagers()) {
+        if (manager) {
+            numRunning += manager->getNumRunningEntityScripts();
+        }
+    }
+    return numRunning;
+}
+
+QJsonObject EntityScriptShards::getStats() {
+    static const double USECS_PER_MSEC_DOUBLE = (double)USECS_PER_MSEC;
+
+    Lock lock(_mutex);
+    QJsonObject stats;
+    for (int i = 0; i < (int)_shards.size(); ++i) {
+        auto& shard = _shards[i];
+
+        QJsonObject shardStats;
+        shardStats["assigned_scripts"] = (int)shard.assigned.size();
+        shardStats["running_scripts"] = shard.manager ? shard.manager->getNumRunningEntityScripts() : 0;
+        shardStats["avg_frame_ms"] = shard.averageFrameUsecs / USECS_PER_MSEC_DOUBLE;
+        shardStats["max_frame_ms"] = shard.maxFrameUsecs / USECS_PER_MSEC_DOUBLE;
+        shardStats["scripts_moved_out"] = shard.numMovedOut;
+        stats[QString("shard_%1").arg(i)] = shardStats;
+
+        shard.maxFrameUsecs = 0.0f;
+    }
+    return stats;
+}
+
+void EntityScriptShards::callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                                const QStringList& params, const QUuid& remoteCallerID) {
+    auto manager = find(entityID);
+    if (manager) {
+        manager->callEntityScriptMethod(entityID, methodName, params, remoteCallerID);
+    }
+}
+
+QFuture<QVariant> EntityScriptShards::getLocalEntityScriptDetails(const EntityItemID& entityID) {
+    auto manager = find(entityID);
+    if (!manager) {
+        // any manager answers for a script it doesn't run
+        auto managers = getManagers();
+        if (managers.empty()) {
+            return QFuture<QVariant>();
+        }
+        manager = managers.front();
+    }
+    return manager->getLocalEntityScriptDetails(entityID);
+}
+
+int EntityScriptShards::leastLoaded(int excluded) const {
+    int best = -1;
+    for (int i = 0; i < (int)_shards.size(); ++i) {
+        if (i == excluded) {
+            continue;
+        }
+        const auto& shard = _shards[i];
+        if (best == -1 || shard.averageFrameUsecs < _shards[best].averageFrameUsecs ||
+            (shard.averageFrameUsecs == _shards[best].averageFrameUsecs && shard.assigned.size() < _shards[best].assigned.size())) {
+            best = i;
+        }
+    }
+    return best;
+}
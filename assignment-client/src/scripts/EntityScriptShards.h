@@ -0,0 +1,81 @@
+//
+//  EntityScriptShards.h
+//  assignment-client/src/scripts
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef hifi_EntityScriptShards_h
+#define hifi_EntityScriptShards_h
+
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QHash>
+#include <QtCore/QJsonObject>
+
+#include <EntitiesScriptEngineProvider.h>
+#include <EntityItemID.h>
+#include <ScriptManager.h>
+
+// The script managers of the entity script server, each running its own engine on its own thread
+//   Every entity script runs on exactly one shard. By default a new script goes to the shard with the shortest
+//   frames, and when a shard's frames stay over budget its most recently assigned script is moved to a shard that
+//   has time to spare. Assigning by hash instead always runs the script of an entity on the same shard.
+//   Calls into entity scripts from the rest of the server are routed to the owning shard.
+class EntityScriptShards : public EntitiesScriptEngineProvider {
+public:
+    void setManagers(std::vector<ScriptManagerPointer> managers);
+    std::vector<ScriptManagerPointer> getManagers() const;
+    int getNumShards() const;
+
+    void setAssignByHash(bool assignByHash);
+
+    // returns the manager running the script of this entity, if any
+    ScriptManagerPointer find(const EntityItemID& entityID) const;
+    // returns the manager that should run the script of this entity, picking one if it has none yet
+    ScriptManagerPointer assign(const EntityItemID& entityID);
+    void unassign(const EntityItemID& entityID);
+    int getNumAssigned() const;
+
+    // called on the shard's own thread once per script frame, with the time the frame spent running scripts
+    void recordFrame(int shard, quint64 executionUsecs);
+
+    // picks a script to move off a shard whose frames are over budget, and reassigns it,
+    // returns false if no shard is over budget or none has time to spare, or when assigning by hash
+    bool rebalance(uint64_t frameBudgetUsecs, EntityItemID& movedEntityID,
+                   ScriptManagerPointer& from, ScriptManagerPointer& to);
+
+    int getNumRunningEntityScripts() const;
+    QJsonObject getStats();
+
+    // EntitiesScriptEngineProvider
+    void callEntityScriptMethod(const EntityItemID& entityID, const QString& methodName,
+                                const QStringList& params = QStringList(), const QUuid& remoteCallerID = QUuid()) override;
+    QFuture<QVariant> getLocalEntityScriptDetails(const EntityItemID& entityID) override;
+
+private:
+    struct Shard {
+        ScriptManagerPointer manager;
+        std::vector<EntityItemID> assigned; // oldest first
+        float averageFrameUsecs { 0.0f };
+        float maxFrameUsecs { 0.0f }; // since the last stats
+        uint64_t lastMoveTime { 0 };
+        int numMovedOut { 0 };
+    };
+
+    int leastLoaded(int excluded = -1) const;
+
+    mutable std::mutex _mutex;
+    bool _assignByHash { false };
+    std::vector<Shard> _shards;
+    QHash<EntityItemID, int> _entityShards;
+};
+
+using EntityScriptShardsPointer = std::shared_ptr<EntityScriptShards>;
+
+#endif // hifi_EntityScriptShards_h
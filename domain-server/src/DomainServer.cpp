@@ -22,6 +22,7 @@
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QProcess>
+#include <QtConcurrent/QtConcurrentRun>
 #include <QSharedMemory>
 #include <QRegularExpression>
 #include <QStandardPaths>
@@ -905,6 +906,8 @@ void DomainServer::setupNodeListAndAssignments() {
         PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::processOctreeDataRequestMessage));
     packetReceiver.registerListener(PacketType::OctreeDataPersist,
         PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::processOctreeDataPersistMessage));
+    packetReceiver.registerListener(PacketType::OctreeDataPersistJournal,
+        PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::processOctreeDataPersistJournalMessage));
 
     packetReceiver.registerListener(PacketType::OctreeFileReplacement,
         PacketReceiver::makeUnsourcedListenerReference<DomainServer>(this, &DomainServer::handleOctreeFileReplacementRequest));
@@ -1282,15 +1285,22 @@ void DomainServer::processListRequestPacket(QSharedPointer<ReceivedMessage> mess
     }
 
     // update the NodeInterestSet in case there have been any changes
+    if (safeInterestSet != nodeData->getNodeInterestSet()) {
+        nodeData->setNeedsFullDomainList(true);
+    }
     nodeData->setNodeInterestSet(safeInterestSet);
 
+    // let the nodes interested in this one know if it changed, e.g. its sockets or permissions
+    refreshDomainListEntry(sendingNode);
+
     // update the connecting hostname in case it has changed
     nodeData->setPlaceName(nodeRequestData.placeName);
 
     // client-side send time of last connect/domain list request
     nodeData->setLastDomainCheckinTimestamp(nodeRequestData.lastPingTimestamp);
 
-    sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false);
+    sendDomainListToNode(sendingNode, message->getFirstPacketReceiveTime(), message->getSenderSockAddr(), false,
+                         nodeRequestData.domainListVersion);
 }
 
 bool DomainServer::isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
@@ -1355,8 +1365,10 @@ QUrl DomainServer::oauthAuthorizationURL(const QUuid& stateUUID) {
 void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 requestReceiveTime) {
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(newNode->getLinkedData());
 
+    refreshDomainListEntry(newNode);
+
     // reply back to the user with a PacketType::DomainList
-    sendDomainListToNode(newNode, requestReceiveTime, nodeData->getSendingSockAddr(), true);
+    sendDomainListToNode(newNode, requestReceiveTime, nodeData->getSendingSockAddr(), true, 0);
 
     // if this node is a user (unassigned Agent), signal
     if (newNode->getType() == NodeType::Agent && !nodeData->wasAssigned()) {
@@ -1366,13 +1378,73 @@ void DomainServer::handleConnectedNode(SharedNodePointer newNode, quint64 reques
     if (shouldReplicateNode(*newNode)) {
         qDebug() << "Setting node to replicated: " << newNode->getUUID();
         newNode->setIsReplicated(true);
+        refreshDomainListEntry(newNode);
     }
 
     // send out this node to our other connected nodes
     broadcastNewNode(newNode);
 }
 
-void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const SockAddr &senderSockAddr, bool newConnection) {
+void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const SockAddr &senderSockAddr,
+                                        bool newConnection, quint32 acknowledgedListVersion) {
+    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
+
+    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
+    auto& nodeInterestSet = nodeData->getNodeInterestSet();
+
+    // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
+    // if this authenticated node has any interest types, send back those nodes as well
+    bool hasInterests = nodeInterestSet.size() > 0 && nodeData->isAuthenticated();
+
+    // if the node has all of the last list we sent it, only look at the nodes that changed since then
+    auto& listNodes = nodeData->getDomainListNodes();
+    quint32 listVersion = nodeData->getDomainListVersion();
+    QSet<QUuid> changedNodes;
+    bool canSendChanges = !newConnection && !nodeData->needsFullDomainList() && acknowledgedListVersion != 0 &&
+                          acknowledgedListVersion == listVersion &&
+                          _domainListChanges.getChangesSince(nodeData->getDomainListChangesVersion(), changedNodes);
+
+    QList<QUuid> removedNodes;
+    QList<SharedNodePointer> changedEntries;
+    if (canSendChanges) {
+        for (const auto& changedNodeID : changedNodes) {
+            auto otherNode = limitedNodeList->nodeWithUUID(changedNodeID);
+            if (hasInterests && otherNode && otherNode != node && isInInterestSet(node, otherNode)) {
+                changedEntries << otherNode;
+                listNodes.insert(changedNodeID);
+            } else if (listNodes.remove(changedNodeID)) {
+                removedNodes << changedNodeID;
+            }
+        }
+    } else {
+        listNodes.clear();
+        if (hasInterests) {
+            limitedNodeList->eachNode([this, node, &changedEntries, &listNodes](const SharedNodePointer& otherNode) {
+                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
+                    // nodes are serialized once when they connect or change, not for every list they are in
+                    if (static_cast<DomainServerNodeData*>(otherNode->getLinkedData())->getDomainListEntry().isEmpty()) {
+                        refreshDomainListEntry(otherNode);
+                    }
+                    changedEntries << otherNode;
+                    listNodes.insert(otherNode->getUUID());
+                }
+            });
+        }
+        nodeData->setNeedsFullDomainList(false);
+    }
+
+    // nothing changed since the list the node has all of, so send it the same version again, without items
+    quint32 baseListVersion = 0;
+    if (canSendChanges && removedNodes.empty() && changedEntries.empty()) {
+        baseListVersion = listVersion;
+    } else {
+        listVersion = DomainListVersions::next(listVersion);
+        baseListVersion = canSendChanges ? acknowledgedListVersion : 0;
+        nodeData->setDomainListVersion(listVersion);
+    }
+    nodeData->setDomainListChangesVersion(_domainListChanges.getVersion());
+
     const int NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES = NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID +
         NUM_BYTES_RFC4122_UUID + NLPacket::NUM_BYTES_LOCALID + 4;
 
@@ -1380,8 +1452,6 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     // this data is at the beginning of each of the domain list packets
     QByteArray extendedHeader(NUM_DOMAIN_LIST_EXTENDED_HEADER_BYTES, 0);
     QDataStream extendedHeaderStream(&extendedHeader, QIODevice::WriteOnly);
-    DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
-    auto limitedNodeList = DependencyManager::get<LimitedNodeList>();
 
     extendedHeaderStream << limitedNodeList->getSessionUUID();
     extendedHeaderStream << limitedNodeList->getSessionLocalID();
@@ -1393,35 +1463,30 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     extendedHeaderStream << quint64(duration_cast<microseconds>(system_clock::now().time_since_epoch()).count());
     extendedHeaderStream << quint64(duration_cast<microseconds>(p_high_resolution_clock::now().time_since_epoch()).count()) - requestPacketReceiveTime;
     extendedHeaderStream << newConnection;
+    // the list may be spread over several packets, the node has all of it once it has read all of its items
+    extendedHeaderStream << listVersion << baseListVersion << quint32(removedNodes.size() + changedEntries.size());
     auto domainListPackets = NLPacketList::create(PacketType::DomainList, extendedHeader);
 
     // always send the node their own UUID back
     QDataStream domainListStream(domainListPackets.get());
 
-    // store the nodeInterestSet on this DomainServerNodeData, in case it has changed
-    auto& nodeInterestSet = nodeData->getNodeInterestSet();
-
-    if (nodeInterestSet.size() > 0) {
-
-        // DTLSServerSession* dtlsSession = _isUsingDTLS ? _dtlsSessions[senderSockAddr] : NULL;
-        if (nodeData->isAuthenticated()) {
-            // if this authenticated node has any interest types, send back those nodes as well
-            limitedNodeList->eachNode([this, node, &domainListPackets, &domainListStream](const SharedNodePointer& otherNode) {
-                if (otherNode->getUUID() != node->getUUID() && isInInterestSet(node, otherNode)) {
-                    // since we're about to add a node to the packet we start a segment
-                    domainListPackets->startSegment();
-
-                    // don't send avatar nodes to other avatars, that will come from avatar mixer
-                    domainListStream << *otherNode.data();
+    // each item gets a segment of its own so that it is never split across packets,
+    // and starts with whether it is the ID of a removed node or the entry of an added or changed one
+    for (auto& removedNode : removedNodes) {
+        domainListPackets->startSegment();
+        domainListStream << true << removedNode;
+        domainListPackets->endSegment();
+    }
+    for (auto& otherNode : changedEntries) {
+        auto otherNodeData = static_cast<DomainServerNodeData*>(otherNode->getLinkedData());
 
-                    // pack the secret that these two nodes will use to communicate with each other
-                    domainListStream << connectionSecretForNodes(node, otherNode);
+        domainListPackets->startSegment();
+        domainListStream << false;
+        domainListPackets->write(otherNodeData->getDomainListEntry());
 
-                    // we've added the node we wanted so end the segment now
-                    domainListPackets->endSegment();
-                }
-            });
-        }
+        // pack the secret that these two nodes will use to communicate with each other
+        domainListStream << connectionSecretForNodes(node, otherNode);
+        domainListPackets->endSegment();
     }
 
     // send an empty list to the node, in case there were no other nodes
@@ -1431,6 +1496,22 @@ void DomainServer::sendDomainListToNode(const SharedNodePointer& node, quint64 r
     limitedNodeList->sendPacketList(std::move(domainListPackets), *node);
 }
 
+void DomainServer::refreshDomainListEntry(const SharedNodePointer& node) {
+    auto nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
+    if (!nodeData) {
+        return;
+    }
+
+    QByteArray entry;
+    QDataStream entryStream(&entry, QIODevice::WriteOnly);
+    entryStream << *node.data();
+
+    if (entry != nodeData->getDomainListEntry()) {
+        nodeData->setDomainListEntry(entry);
+        _domainListChanges.recordChange(node->getUUID());
+    }
+}
+
 QUuid DomainServer::connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB) {
     DomainServerNodeData* nodeAData = static_cast<DomainServerNodeData*>(nodeA->getLinkedData());
     DomainServerNodeData* nodeBData = static_cast<DomainServerNodeData*>(nodeB->getLinkedData());
@@ -1894,9 +1975,10 @@ void DomainServer::processOctreeDataPersistMessage(QSharedPointer<ReceivedMessag
         dir.mkpath(".");
     }
 
-    QFile f(filePath);
-    if (f.open(QIODevice::WriteOnly)) {
-        f.write(data);
+    // a full persist supersedes whatever was journaled since the last one
+    if (OctreeUtils::writePersistFile(filePath, data)) {
+        _numEntitiesJournalRecords = 0;
+        _isRejectingEntitiesJournal = false;
 #ifdef EXPENSIVE_NETWORK_DIAGNOSTICS
         // These diagnostics take take more than 200ms (depending on content size),
         // causing Socket::readPendingDatagrams to overrun its timebox.
@@ -1912,6 +1994,39 @@ void DomainServer::processOctreeDataPersistMessage(QSharedPointer<ReceivedMessag
     }
 }
 
+void DomainServer::processOctreeDataPersistJournalMessage(QSharedPointer<ReceivedMessage> message) {
+    auto record = message->readAll();
+    auto filePath = getEntitiesFilePath();
+
+    QDir dir(getEntitiesDirPath());
+    if (!dir.exists()) {
+        qCDebug(domain_server) << "Creating entities content directory:" << dir.absolutePath();
+        dir.mkpath(".");
+    }
+
+    // a record only holds the changes since the previous one, so once one is lost the records that follow it can't be
+    // used either, the ES is asked for the whole tree instead
+    if (!_isRejectingEntitiesJournal && !OctreeUtils::appendJournalRecord(filePath, record)) {
+        qCDebug(domain_server) << "Failed to append to entities journal:" << filePath << "- requesting a full persist";
+        _isRejectingEntitiesJournal = true;
+    }
+    if (_isRejectingEntitiesJournal) {
+        auto reply = NLPacket::create(PacketType::OctreeDataPersistJournalRejected, -1, true);
+        DependencyManager::get<LimitedNodeList>()->sendPacket(std::move(reply), message->getSenderSockAddr());
+        return;
+    }
+
+    // fold the journal back into the entities file once in a while, off the main thread
+    const int JOURNAL_RECORDS_PER_COMPACTION = 20;
+    if (++_numEntitiesJournalRecords >= JOURNAL_RECORDS_PER_COMPACTION
+            && !_entitiesCompaction.isRunning()) {
+        _numEntitiesJournalRecords = 0;
+        _entitiesCompaction = QtConcurrent::run([filePath] {
+            return OctreeUtils::compactJournal(filePath);
+        });
+    }
+}
+
 QString DomainServer::getContentBackupDir() {
     return PathUtils::getAppDataFilePath("backups");
 }
@@ -1947,6 +2062,7 @@ void DomainServer::processOctreeDataRequestMessage(QSharedPointer<ReceivedMessag
         qCDebug(domain_server) << "Entity server does not have existing data";
     }
     auto entityFilePath = getEntitiesFilePath();
+    OctreeUtils::compactJournal(entityFilePath);
 
     auto reply = NLPacketList::create(PacketType::OctreeDataFileReply, QByteArray(), true, true);
     OctreeUtils::RawEntityData data;
@@ -3238,6 +3354,7 @@ void DomainServer::updateReplicatedNodes() {
                     << otherNode->getPermissions().getVerifiedUserName() << otherNode->getUUID();
             }
             otherNode->setIsReplicated(shouldReplicate);
+            refreshDomainListEntry(otherNode);
         }
     );
 }
@@ -3273,6 +3390,11 @@ void DomainServer::nodeKilled(SharedNodePointer node) {
     DomainServerNodeData* nodeData = static_cast<DomainServerNodeData*>(node->getLinkedData());
 
     if (nodeData) {
+        // take this node out of the next domain lists of the nodes that had it
+        if (!nodeData->getDomainListEntry().isEmpty()) {
+            _domainListChanges.recordChange(node->getUUID());
+        }
+
         // if this node's UUID matches a static assignment we need to throw it back in the assignment queue
         if (!nodeData->getAssignmentUUID().isNull()) {
             SharedAssignmentPointer matchedAssignment = _allAssignments.take(nodeData->getAssignmentUUID());
@@ -3685,12 +3807,10 @@ void DomainServer::maybeHandleReplacementEntityFile() {
             data.resetIdAndVersion();
             auto gzippedData = data.toGzippedByteArray();
 
-            QFile currentFile(getEntitiesFilePath());
-            if (!currentFile.open(QIODevice::WriteOnly)) {
+            // the journal of the content being replaced is dropped along with it
+            if (!OctreeUtils::writePersistFile(getEntitiesFilePath(), gzippedData)) {
                 qCWarning(domain_server)
-                    << "Failed to update entities data file with replacement file, unable to open entities file for writing";
-            } else {
-                currentFile.write(gzippedData);
+                    << "Failed to update entities data file with replacement file, unable to write entities file";
             }
         }
     }
@@ -14,6 +14,7 @@
 #define hifi_DomainServer_h
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QFuture>
 #include <QtCore/QHash>
 #include <QtCore/QJsonObject>
 #include <QtCore/QQueue>
@@ -25,6 +26,7 @@
 #include <QAbstractNativeEventFilter>
 
 #include <Assignment.h>
+#include <DomainListVersions.h>
 #include <HTTPSConnection.h>
 #include <LimitedNodeList.h>
 #include <shared/WebRTC.h>
@@ -109,6 +111,7 @@ private slots:
 
     void processOctreeDataRequestMessage(QSharedPointer<ReceivedMessage> message);
     void processOctreeDataPersistMessage(QSharedPointer<ReceivedMessage> message);
+    void processOctreeDataPersistJournalMessage(QSharedPointer<ReceivedMessage> message);
 
     void performIPAddressPortUpdate(const SockAddr& newPublicSockAddr);
     void sendHeartbeatToMetaverse() { sendHeartbeatToMetaverse(QString(), int()); }
@@ -194,10 +197,14 @@ private:
     void handleKillNode(SharedNodePointer nodeToKill);
     void broadcastNodeDisconnect(const SharedNodePointer& disconnnectedNode);
 
-    void sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const SockAddr& senderSockAddr, bool newConnection);
+    void sendDomainListToNode(const SharedNodePointer& node, quint64 requestPacketReceiveTime, const SockAddr& senderSockAddr,
+                              bool newConnection, quint32 acknowledgedListVersion);
 
     bool isInInterestSet(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
 
+    // serializes the node as it appears in domain lists, and records a domain list change if it is different
+    void refreshDomainListEntry(const SharedNodePointer& node);
+
     QUuid connectionSecretForNodes(const SharedNodePointer& nodeA, const SharedNodePointer& nodeB);
     void broadcastNewNode(const SharedNodePointer& node);
 
@@ -256,6 +263,8 @@ private:
     std::vector<QString> _replicatedUsernames;
 
     DomainGatekeeper _gatekeeper;
+
+    DomainListChanges _domainListChanges;
     DomainServerExporter _exporter;
 
     HTTPManager _httpManager;
@@ -321,6 +330,10 @@ private:
 
     std::unique_ptr<DomainContentBackupManager> _contentManager { nullptr };
 
+    int _numEntitiesJournalRecords { 0 };
+    bool _isRejectingEntitiesJournal { false }; // a journal record was lost, until the next full persist
+    QFuture<bool> _entitiesCompaction;
+
     QHash<QUuid, QPointer<HTTPSConnection>> _pendingOAuthConnections;
 
     std::unordered_map<int, QByteArray> _pendingUploadedContents;
@@ -17,7 +17,9 @@
 #include <QtCore/QHash>
 #include <QtCore/QUuid>
 #include <QtCore/QJsonObject>
+#include <QtCore/QSet>
 
+#include <DomainListVersions.h>
 #include <SockAddr.h>
 #include <NLPacket.h>
 #include <NodeData.h>
@@ -73,6 +75,22 @@ public:
 
     bool hasCheckedIn() const { return _hasCheckedIn; }
     void setHasCheckedIn(bool hasCheckedIn) { _hasCheckedIn = hasCheckedIn; }
+
+    // the last domain list sent to the node, the domain list changes it includes, and the nodes in it,
+    // so that the next one can only hold what changed since
+    quint32 getDomainListVersion() const { return _domainListVersion; }
+    void setDomainListVersion(quint32 domainListVersion) { _domainListVersion = domainListVersion; }
+    DomainListChanges::Version getDomainListChangesVersion() const { return _domainListChangesVersion; }
+    void setDomainListChangesVersion(DomainListChanges::Version version) { _domainListChangesVersion = version; }
+    QSet<QUuid>& getDomainListNodes() { return _domainListNodes; }
+
+    // the next domain list sent to the node holds all of its nodes, e.g. after its interest set changed
+    bool needsFullDomainList() const { return _needsFullDomainList; }
+    void setNeedsFullDomainList(bool needsFullDomainList) { _needsFullDomainList = needsFullDomainList; }
+
+    // the node as it appears in the domain lists of other nodes, without the connection secret
+    const QByteArray& getDomainListEntry() const { return _domainListEntry; }
+    void setDomainListEntry(const QByteArray& domainListEntry) { _domainListEntry = domainListEntry; }
     
 private:
     QJsonObject overrideValuesIfNeeded(const QJsonObject& newStats);
@@ -99,6 +117,12 @@ private:
     bool _wasAssigned { false };
 
     bool _hasCheckedIn { false };
+
+    quint32 _domainListVersion { 0 };
+    DomainListChanges::Version _domainListChangesVersion { 0 };
+    QSet<QUuid> _domainListNodes;
+    bool _needsFullDomainList { false };
+    QByteArray _domainListEntry;
 };
 
 #endif // hifi_DomainServerNodeData_h
@@ -36,6 +36,9 @@ EntitiesBackupHandler::EntitiesBackupHandler(QString entitiesFilePath, QString e
 static const QString ENTITIES_BACKUP_FILENAME = "models.json.gz";
 
 void EntitiesBackupHandler::createBackup(const QString& backupName, QuaZip& zip) {
+    // back up the journaled changes too
+    OctreeUtils::compactJournal(_entitiesFilePath);
+
     QFile entitiesFile { _entitiesFilePath };
 
     if (entitiesFile.open(QIODevice::ReadOnly)) {
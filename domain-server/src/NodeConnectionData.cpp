@@ -55,6 +55,10 @@ NodeConnectionData NodeConnectionData::fromDataStream(QDataStream& dataStream, c
     dataStream >> newHeader.nodeType
         >> publicSocketType >> newHeader.publicSockAddr >> localSocketType >> newHeader.localSockAddr
         >> newHeader.interestList >> newHeader.placeName;
+
+    if (!isConnectRequest) {
+        dataStream >> newHeader.domainListVersion;
+    }
     newHeader.publicSockAddr.setType(publicSocketType);
     newHeader.localSockAddr.setType(localSocketType);
 
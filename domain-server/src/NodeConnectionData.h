@@ -30,6 +30,7 @@ public:
     SockAddr senderSockAddr;
     QList<NodeType_t> interestList;
     QString placeName;
+    quint32 domainListVersion { 0 }; // last domain list the node has all of, 0 if none
     QString hardwareAddress;
     QUuid machineFingerprint;
     QString SystemInfo;
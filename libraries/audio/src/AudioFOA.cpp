@@ -1058,23 +1058,59 @@ static void scaleMatrix_4x4(float scale, float m[4][4]) {
     }
 }
 
+// convert normalized float ambiX (ACN/SN3D) to deinterleaved float (B-format)
+static void convertFloatInput(const float* src, float *dst[4], float gain, int numFrames) {
+
+    const float scaleW = gain * SQRT1_2; // -3dB
+
+    for (int i = 0; i < numFrames; i++) {
+        dst[0][i] = src[4*i+0] * scaleW; // W
+        dst[2][i] = src[4*i+1] * gain;   // Y
+        dst[3][i] = src[4*i+2] * gain;   // Z
+        dst[1][i] = src[4*i+3] * gain;   // X
+    }
+}
+
 // Ambisonic to binaural render
 void AudioFOA::render(int16_t* input, float* output, int index, float qw, float qx, float qy, float qz, float gain, int numFrames) {
 
-    assert(index >= 0);
-    assert(index < FOA_TABLES);
     assert(numFrames == FOA_BLOCK);
 
-    ALIGN32 float fftBuffer[FOA_NFFT];          // in-place FFT buffer
-    ALIGN32 float accBuffer[2][FOA_NFFT] = {};  // binaural accumulation buffers
     ALIGN32 float inBuffer[4][FOA_BLOCK];       // deinterleaved input buffers
 
     float* in[4] = { inBuffer[0], inBuffer[1], inBuffer[2], inBuffer[3] };
-    float rotation[4][4];
 
     // convert input to deinterleaved float
     convertInput(input, in, FOA_GAIN, FOA_BLOCK);
 
+    renderDeinterleaved(in, output, index, qw, qx, qy, qz, gain);
+}
+
+void AudioFOA::render(const float* input, float* output, int index, float qw, float qx, float qy, float qz, float gain,
+                      int numFrames) {
+
+    assert(numFrames == FOA_BLOCK);
+
+    ALIGN32 float inBuffer[4][FOA_BLOCK];       // deinterleaved input buffers
+
+    float* in[4] = { inBuffer[0], inBuffer[1], inBuffer[2], inBuffer[3] };
+
+    // convert input to deinterleaved float
+    convertFloatInput(input, in, FOA_GAIN, FOA_BLOCK);
+
+    renderDeinterleaved(in, output, index, qw, qx, qy, qz, gain);
+}
+
+void AudioFOA::renderDeinterleaved(float* in[4], float* output, int index, float qw, float qx, float qy, float qz, float gain) {
+
+    assert(index >= 0);
+    assert(index < FOA_TABLES);
+
+    ALIGN32 float fftBuffer[FOA_NFFT];          // in-place FFT buffer
+    ALIGN32 float accBuffer[2][FOA_NFFT] = {};  // binaural accumulation buffers
+
+    float rotation[4][4];
+
     // convert quaternion to 4x4 rotation
     quatToMatrix_4x4(qw, qx, qy, qz, rotation);
 
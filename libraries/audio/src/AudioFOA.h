@@ -13,6 +13,7 @@
 #define hifi_AudioFOA_h
 
 #include <stdint.h>
+#include <string.h>
 
 static const int FOA_TAPS = 273;    // FIR coefs
 static const int FOA_NFFT = 512;    // FFT length
@@ -40,10 +41,27 @@ public:
     //
     void render(int16_t* input, float* output, int index, float qw, float qx, float qy, float qz, float gain, int numFrames);
 
+    //
+    // input: interleaved First-Order Ambisonic source, as normalized float ambiX (ACN/SN3D)
+    //
+    void render(const float* input, float* output, int index, float qw, float qx, float qy, float qz, float gain,
+                int numFrames);
+
+    // clear internal state
+    void reset() {
+        if (!_resetState) {
+            memset(_fftState, 0, sizeof(_fftState));
+            memset(_rotationState, 0, sizeof(_rotationState));
+            _resetState = true;
+        }
+    }
+
 private:
     AudioFOA(const AudioFOA&) = delete;
     AudioFOA& operator=(const AudioFOA&) = delete;
 
+    void renderDeinterleaved(float* in[4], float* output, int index, float qw, float qx, float qy, float qz, float gain);
+
     // For best cache utilization when processing thousands of instances, only
     // the minimum persistant state is stored here. No coefs or work buffers.
 
@@ -308,6 +308,73 @@ static void biquad2_4x4_SSE(float* src, float* dst, float coef[5][8], float stat
     _MM_SET_FLUSH_ZERO_MODE(ftz);
 }
 
+// process 2 cascaded biquads on 4 channels (interleaved), with accumulation
+// used to sum several sources into a shared 4-channel bus
+static void biquad2_4x4_acc_SSE(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames) {
+
+    // enable flush-to-zero mode to prevent denormals
+    unsigned int ftz = _MM_GET_FLUSH_ZERO_MODE();
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+
+    // restore state
+    __m128 y00 = _mm_loadu_ps(&state[0][0]);
+    __m128 w10 = _mm_loadu_ps(&state[1][0]);
+    __m128 w20 = _mm_loadu_ps(&state[2][0]);
+
+    __m128 y01;
+    __m128 w11 = _mm_loadu_ps(&state[1][4]);
+    __m128 w21 = _mm_loadu_ps(&state[2][4]);
+
+    // first biquad coefs
+    __m128 b00 = _mm_loadu_ps(&coef[0][0]);
+    __m128 b10 = _mm_loadu_ps(&coef[1][0]);
+    __m128 b20 = _mm_loadu_ps(&coef[2][0]);
+    __m128 a10 = _mm_loadu_ps(&coef[3][0]);
+    __m128 a20 = _mm_loadu_ps(&coef[4][0]);
+
+    // second biquad coefs
+    __m128 b01 = _mm_loadu_ps(&coef[0][4]);
+    __m128 b11 = _mm_loadu_ps(&coef[1][4]);
+    __m128 b21 = _mm_loadu_ps(&coef[2][4]);
+    __m128 a11 = _mm_loadu_ps(&coef[3][4]);
+    __m128 a21 = _mm_loadu_ps(&coef[4][4]);
+
+    for (int i = 0; i < numFrames; i++) {
+
+        __m128 x00 = _mm_loadu_ps(&src[4*i]);
+        __m128 x01 = y00;   // first biquad output
+
+        // transposed Direct Form II
+        y00 = _mm_add_ps(w10, _mm_mul_ps(x00, b00));
+        y01 = _mm_add_ps(w11, _mm_mul_ps(x01, b01));
+
+        w10 = _mm_add_ps(w20, _mm_mul_ps(x00, b10));
+        w11 = _mm_add_ps(w21, _mm_mul_ps(x01, b11));
+
+        w20 = _mm_mul_ps(x00, b20);
+        w21 = _mm_mul_ps(x01, b21);
+
+        w10 = _mm_sub_ps(w10, _mm_mul_ps(y00, a10));
+        w11 = _mm_sub_ps(w11, _mm_mul_ps(y01, a11));
+
+        w20 = _mm_sub_ps(w20, _mm_mul_ps(y00, a20));
+        w21 = _mm_sub_ps(w21, _mm_mul_ps(y01, a21));
+
+        // accumulate second biquad output
+        _mm_storeu_ps(&dst[4*i], _mm_add_ps(_mm_loadu_ps(&dst[4*i]), y01));
+    }
+
+    // save state
+    _mm_storeu_ps(&state[0][0], y00);
+    _mm_storeu_ps(&state[1][0], w10);
+    _mm_storeu_ps(&state[2][0], w20);
+
+    _mm_storeu_ps(&state[1][4], w11);
+    _mm_storeu_ps(&state[2][4], w21);
+
+    _MM_SET_FLUSH_ZERO_MODE(ftz);
+}
+
 // crossfade 4 inputs into 2 outputs with accumulation (interleaved)
 static void crossfade_4x2_SSE(float* src, float* dst, const float* win, int numFrames) {
 
@@ -384,6 +451,7 @@ void FIR_1x4_AVX2(float* src, float* dst0, float* dst1, float* dst2, float* dst3
 void FIR_1x4_AVX512(float* src, float* dst0, float* dst1, float* dst2, float* dst3, float coef[4][HRTF_TAPS], int numFrames);
 void interleave_4x4_AVX2(float* src0, float* src1, float* src2, float* src3, float* dst, int numFrames);
 void biquad2_4x4_AVX2(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames);
+void biquad2_4x4_acc_AVX2(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames);
 void crossfade_4x2_AVX2(float* src, float* dst, const float* win, int numFrames);
 void interpolate_AVX2(const float* src0, const float* src1, float* dst, float frac, float gain);
 
@@ -407,6 +475,11 @@ static void biquad2_4x4(float* src, float* dst, float coef[5][8], float state[3]
     (*f)(src, dst, coef, state, numFrames); // dispatch
 }
 
+static void biquad2_4x4_acc(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames) {
+    static auto f = cpuSupportsAVX2() ? biquad2_4x4_acc_AVX2 : biquad2_4x4_acc_SSE;
+    (*f)(src, dst, coef, state, numFrames); // dispatch
+}
+
 static void crossfade_4x2(float* src, float* dst, const float* win, int numFrames) {
     static auto f = cpuSupportsAVX2() ? crossfade_4x2_AVX2 : crossfade_4x2_SSE;
     (*f)(src, dst, win, numFrames); // dispatch
@@ -666,6 +739,17 @@ static void biquad2_4x4(float* src, float* dst, float coef[5][8], float state[3]
     state[2][7] = w27;
 }
 
+// process 2 cascaded biquads on 4 channels (interleaved), with accumulation
+static void biquad2_4x4_acc(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames) {
+
+    // process in-place, then accumulate
+    biquad2_4x4(src, src, coef, state, numFrames);
+
+    for (int i = 0; i < 4 * numFrames; i++) {
+        dst[i] += src[i];
+    }
+}
+
 // crossfade 4 inputs into 2 outputs with accumulation (interleaved)
 static void crossfade_4x2(float* src, float* dst, const float* win, int numFrames) {
 
@@ -692,7 +776,7 @@ static void interpolate(const float* src0, const float* src1, float* dst, float
 #endif
 
 // apply gain crossfade with accumulation (interleaved)
-static void gainfade_1x2(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+static void gainfade_1x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
 
     gain0 *= (1/32768.0f);  // int16_t to float
     gain1 *= (1/32768.0f);
@@ -710,7 +794,7 @@ static void gainfade_1x2(int16_t* src, float* dst, const float* win, float gain0
 }
 
 // apply gain crossfade with accumulation (interleaved)
-static void gainfade_2x2(int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
+static void gainfade_2x2(const int16_t* src, float* dst, const float* win, float gain0, float gain1, int numFrames) {
 
     gain0 *= (1/32768.0f);  // int16_t to float
     gain1 *= (1/32768.0f);
@@ -1060,18 +1144,15 @@ static void setFilters(float firCoef[4][HRTF_TAPS], float bqCoef[5][8], int dela
     }
 }
 
-void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
-                       float lpfDistance) {
+void AudioHRTF::prepareBlock(const float* input, float* bqBuffer, float bqCoef[5][8], int index,
+                              float azimuth, float distance, float gain, float lpfDistance) {
 
     assert(index >= 0);
     assert(index < HRTF_TABLES);
-    assert(numFrames == HRTF_BLOCK);
 
     ALIGN32 float in[HRTF_TAPS + HRTF_BLOCK];               // mono
     ALIGN32 float firCoef[4][HRTF_TAPS];                    // 4-channel
     ALIGN32 float firBuffer[4][HRTF_DELAY + HRTF_BLOCK];    // 4-channel
-    ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
-    ALIGN32 float bqBuffer[4 * HRTF_BLOCK];                 // 4-channel (interleaved)
     int delay[4];                                           // 4-channel (interleaved)
 
     // apply global and local gain adjustment
@@ -1101,10 +1182,8 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     _gainState = gain;
     _lpfState = lpf;
 
-    // convert mono input to float
-    for (int i = 0; i < HRTF_BLOCK; i++) {
-        in[HRTF_TAPS+i] = (float)input[i] * (1/32768.0f);
-    }
+    // mono input
+    memcpy(&in[HRTF_TAPS], input, HRTF_BLOCK * sizeof(float));
 
     // FIR state update
     memcpy(in, _firState, HRTF_TAPS * sizeof(float));
@@ -1135,9 +1214,9 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
                    &firBuffer[L1][HRTF_DELAY] - delay[L1],
                    &firBuffer[R1][HRTF_DELAY] - delay[R1],
                    bqBuffer, HRTF_BLOCK);
+}
 
-    // process old/new biquads
-    biquad2_4x4(bqBuffer, bqBuffer, bqCoef, _bqState, HRTF_BLOCK);
+void AudioHRTF::updateBiquadState() {
 
     // new state becomes old
     _bqState[0][L0] = _bqState[0][L1];
@@ -1156,13 +1235,70 @@ void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth,
     _bqState[1][R2] = _bqState[1][R3];
     _bqState[2][R2] = _bqState[2][R3];
 
+    _resetState = false;
+}
+
+void AudioHRTF::render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
+                       float lpfDistance) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    ALIGN32 float in[HRTF_BLOCK];                           // mono
+    ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
+    ALIGN32 float bqBuffer[4 * HRTF_BLOCK];                 // 4-channel (interleaved)
+
+    // convert mono input to float
+    for (int i = 0; i < HRTF_BLOCK; i++) {
+        in[i] = (float)input[i] * (1/32768.0f);
+    }
+
+    // compute filters, process FIR and integer delay
+    prepareBlock(in, bqBuffer, bqCoef, index, azimuth, distance, gain, lpfDistance);
+
+    // process old/new biquads
+    biquad2_4x4(bqBuffer, bqBuffer, bqCoef, _bqState, HRTF_BLOCK);
+
+    updateBiquadState();
+
     // crossfade old/new output and accumulate
     crossfade_4x2(bqBuffer, output, crossfadeTable, HRTF_BLOCK);
+}
 
-    _resetState = false;
+void AudioHRTF::renderBatch(const RenderJob* jobs, int numJobs, float* output, int index, int numFrames) {
+
+    assert(numFrames == HRTF_BLOCK);
+
+    if (numJobs <= 0) {
+        return;
+    }
+
+    ALIGN32 float bqCoef[5][8];                             // 4-channel (interleaved)
+    ALIGN32 float bqBuffer[4 * HRTF_BLOCK];                 // 4-channel (interleaved)
+    ALIGN32 float bqBus[4 * HRTF_BLOCK];                    // 4-channel (interleaved) sum of all sources
+
+    memset(bqBus, 0, sizeof(bqBus));
+
+    for (int i = 0; i < numJobs; i++) {
+        const RenderJob& job = jobs[i];
+        AudioHRTF& hrtf = *job.hrtf;
+
+        // compute filters, process FIR and integer delay
+        hrtf.prepareBlock(job.input, bqBuffer, bqCoef, index, job.azimuth, job.distance, job.gain, job.lpfDistance);
+
+        // process old/new biquads, and sum into the shared bus
+        biquad2_4x4_acc(bqBuffer, bqBus, bqCoef, hrtf._bqState, HRTF_BLOCK);
+
+        hrtf.updateBiquadState();
+    }
+
+    //
+    // The crossfade window is identical for every source, so the old/new crossfade is linear
+    // across sources and is applied only once to the summed bus.
+    //
+    crossfade_4x2(bqBus, output, crossfadeTable, HRTF_BLOCK);
 }
 
-void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames) {
+void AudioHRTF::mixMono(const int16_t* input, float* output, float gain, int numFrames) {
 
     assert(numFrames == HRTF_BLOCK);
 
@@ -1183,7 +1319,7 @@ void AudioHRTF::mixMono(int16_t* input, float* output, float gain, int numFrames
     _resetState = false;
 }
 
-void AudioHRTF::mixStereo(int16_t* input, float* output, float gain, int numFrames) {
+void AudioHRTF::mixStereo(const int16_t* input, float* output, float gain, int numFrames) {
 
     assert(numFrames == HRTF_BLOCK);
 
@@ -58,11 +58,27 @@ public:
     void render(int16_t* input, float* output, int index, float azimuth, float distance, float gain, int numFrames,
                 float lpfDistance = LPF_DISTANCE_REF);
 
+    //
+    // Batched render of many mono sources into one output (accumulates into existing output).
+    // Equivalent to calling render() on each job's instance, but the per-source biquads are summed
+    // into a shared 4-channel bus so that the crossfade and output accumulation run once per batch.
+    // Input is normalized float, so a decoded source block can be shared by every listener.
+    //
+    struct RenderJob {
+        AudioHRTF* hrtf;
+        const float* input;
+        float azimuth;
+        float distance;
+        float gain;
+        float lpfDistance { LPF_DISTANCE_REF };
+    };
+    static void renderBatch(const RenderJob* jobs, int numJobs, float* output, int index, int numFrames);
+
     //
     // Non-spatialized direct mix (accumulates into existing output)
     //
-    void mixMono(int16_t* input, float* output, float gain, int numFrames);
-    void mixStereo(int16_t* input, float* output, float gain, int numFrames);
+    void mixMono(const int16_t* input, float* output, float gain, int numFrames);
+    void mixStereo(const int16_t* input, float* output, float gain, int numFrames);
 
     //
     // Fast path when input is known to be silent and state as been flushed
@@ -119,6 +135,13 @@ private:
         L3, R3
     };
 
+    // compute filters and process the FIR and integer delay into 4-channel interleaved bqBuffer
+    void prepareBlock(const float* input, float* bqBuffer, float bqCoef[5][8], int index,
+                      float azimuth, float distance, float gain, float lpfDistance);
+
+    // new biquad state becomes old, after the biquads have been processed
+    void updateBiquadState();
+
     // For best cache utilization when processing thousands of instances, only
     // the minimum persistant state is stored here. No coefs or work buffers.
 
@@ -73,6 +73,26 @@ void PositionalAudioStream::updateLastPopOutputLoudnessAndTrailingLoudness() {
     }
 }
 
+void PositionalAudioStream::cacheLastPopOutput() {
+    if (_lastPopOutput.isNull()) {
+        return;
+    }
+
+    // readSamples advances the iterator, so read from a copy
+    AudioRingBuffer::ConstIterator lastPopOutput = _lastPopOutput;
+
+    if (_isStereo) {
+        lastPopOutput.readSamples(_lastPopSamples, AudioConstants::NETWORK_FRAME_SAMPLES_STEREO);
+    } else {
+        lastPopOutput.readSamples(_lastPopSamples, AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL);
+
+        const float INT16_TO_FLOAT_SCALE = 1.0f / 32768.0f;
+        for (int i = 0; i < AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL; i++) {
+            _lastPopMonoFloatSamples[i] = (float)_lastPopSamples[i] * INT16_TO_FLOAT_SCALE;
+        }
+    }
+}
+
 int PositionalAudioStream::parsePositionalData(const QByteArray& positionalByteArray) {
     QDataStream packetStream(positionalByteArray);
 
@@ -55,6 +55,14 @@ public:
     virtual AudioStreamStats getAudioStreamStats() const override;
 
     void updateLastPopOutputLoudnessAndTrailingLoudness();
+
+    // decode the last popped frame once, so that every listener mixing this stream shares it
+    // called from single AudioMixerSlave while processing packets for node
+    void cacheLastPopOutput();
+
+    // thread-safe, called from AudioMixerSlave(s) while preparing mixes
+    const int16_t* getLastPopSamples() const { return _lastPopSamples; }
+    const float* getLastPopMonoFloatSamples() const { return _lastPopMonoFloatSamples; }
     float getLastPopOutputTrailingLoudness() const { return _lastPopOutputTrailingLoudness; }
     float getLastPopOutputLoudness() const { return _lastPopOutputLoudness; }
     float getQuietestFrameLoudness() const { return _quietestFrameLoudness; }
@@ -109,6 +117,10 @@ protected:
 
     bool _isIgnoreBoxEnabled { false };
     IgnoreBox _ignoreBox;
+
+    // last popped frame, as int16 (mono or stereo) and as normalized float (mono only)
+    int16_t _lastPopSamples[AudioConstants::NETWORK_FRAME_SAMPLES_STEREO] {};
+    float _lastPopMonoFloatSamples[AudioConstants::NETWORK_FRAME_SAMPLES_PER_CHANNEL] {};
 };
 
 #endif // hifi_PositionalAudioStream_h
@@ -169,6 +169,52 @@ void biquad2_4x4_AVX2(float* src, float* dst, float coef[5][8], float state[3][8
     _mm256_zeroupper();
 }
 
+// process 2 cascaded biquads on 4 channels (interleaved), with accumulation
+// used to sum several sources into a shared 4-channel bus
+void biquad2_4x4_acc_AVX2(float* src, float* dst, float coef[5][8], float state[3][8], int numFrames) {
+
+    // enable flush-to-zero mode to prevent denormals
+    unsigned int ftz = _MM_GET_FLUSH_ZERO_MODE();
+    _MM_SET_FLUSH_ZERO_MODE(_MM_FLUSH_ZERO_ON);
+
+    // restore state
+    __m256 x0 = _mm256_setzero_ps();
+    __m256 y0 = _mm256_loadu_ps(state[0]);
+    __m256 w1 = _mm256_loadu_ps(state[1]);
+    __m256 w2 = _mm256_loadu_ps(state[2]);
+
+    //  biquad coefs
+    __m256 b0 = _mm256_loadu_ps(coef[0]);
+    __m256 b1 = _mm256_loadu_ps(coef[1]);
+    __m256 b2 = _mm256_loadu_ps(coef[2]);
+    __m256 a1 = _mm256_loadu_ps(coef[3]);
+    __m256 a2 = _mm256_loadu_ps(coef[4]);
+
+    for (int i = 0; i < numFrames; i++) {
+
+        // x0 = (first biquad output << 128) | input
+        x0 = _mm256_insertf128_ps(_mm256_permute2f128_ps(y0, y0, 0x01), _mm_loadu_ps(&src[4*i]), 0);
+
+        // transposed Direct Form II
+        y0 = _mm256_fmadd_ps(x0, b0, w1);
+        w1 = _mm256_fmadd_ps(x0, b1, w2);
+        w2 = _mm256_mul_ps(x0, b2);
+        w1 = _mm256_fnmadd_ps(y0, a1, w1);
+        w2 = _mm256_fnmadd_ps(y0, a2, w2);
+
+        // accumulate second biquad output
+        _mm_storeu_ps(&dst[4*i], _mm_add_ps(_mm_loadu_ps(&dst[4*i]), _mm256_extractf128_ps(y0, 1)));
+    }
+
+    // save state
+    _mm256_storeu_ps(state[0], y0);
+    _mm256_storeu_ps(state[1], w1);
+    _mm256_storeu_ps(state[2], w2);
+
+    _MM_SET_FLUSH_ZERO_MODE(ftz);
+    _mm256_zeroupper();
+}
+
 // crossfade 4 inputs into 2 outputs with accumulation (interleaved)
 void crossfade_4x2_AVX2(float* src, float* dst, const float* win, int numFrames) {
 
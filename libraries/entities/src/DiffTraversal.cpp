@@ -275,6 +275,12 @@ void DiffTraversal::getNextVisibleElement(DiffTraversal::VisibleElement& next) {
     }
 }
 
+void DiffTraversal::adoptCompletedView(const View& view) {
+    _path.clear();
+    _currentView = view;
+    _completedView = view;
+}
+
 void DiffTraversal::setScanCallback(std::function<void (DiffTraversal::VisibleElement&)> cb) {
     if (!cb) {
         _scanElementCallback = [](DiffTraversal::VisibleElement& a){};
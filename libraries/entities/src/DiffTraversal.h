@@ -73,6 +73,10 @@ public:
 
     void reset() { _path.clear(); _completedView.startTime = 0; } // resets our state to force a new "First" traversal
 
+    // ends the current traversal as if it had completed for this view, e.g. when its results were found elsewhere;
+    // view.startTime must be when those results were up to date, so the next Repeat traversal catches later changes
+    void adoptCompletedView(const View& view);
+
 private:
     void getNextVisibleElement(VisibleElement& next);
 
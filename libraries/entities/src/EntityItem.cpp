@@ -50,6 +50,10 @@ int entityItemPointernMetaTypeId = qRegisterMetaType<EntityItemPointer>();
 int EntityItem::_maxActionsDataSize = 800;
 quint64 EntityItem::_rememberDeletedActionTime = 20 * USECS_PER_SECOND;
 
+bool EntityItem::_encodeCacheEnabled = false;
+std::atomic<quint64> EntityItem::_encodeCacheHits { 0 };
+std::atomic<quint64> EntityItem::_encodeCacheMisses { 0 };
+
 EntityItem::EntityItem(const EntityItemID& entityItemID) :
     SpatiallyNestable(NestableType::Entity, entityItemID)
 {
@@ -167,6 +171,38 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
 
     OctreeElement::AppendState appendState = OctreeElement::COMPLETED; // assume the best
 
+    // Unless we're continuing a partial encode, an unchanged entity encodes the same for every client,
+    // so try to append our last complete encoding as is
+    bool isContinuation = entityTreeElementExtraEncodeData &&
+        entityTreeElementExtraEncodeData->entities.contains(getEntityItemID());
+    bool useEncodeCache = _encodeCacheEnabled && !isContinuation;
+    EncodedEntityPointer& encodeCacheSlot = _encodeCache[destinationNodeCanGetAndSetPrivateUserData ? 1 : 0];
+    EncodedEntity encodeKey;
+    if (useEncodeCache) {
+        withReadLock([&] {
+            encodeKey.lastEdited = _lastEdited;
+            encodeKey.lastUpdated = _lastUpdated;
+            encodeKey.lastSimulated = _lastSimulated;
+            encodeKey.changedOnServer = _changedOnServer;
+        });
+
+        auto encoded = std::atomic_load(&encodeCacheSlot);
+        if (encoded && encoded->matches(encodeKey)) {
+            LevelDetails encodedLevel = packetData->startLevel();
+            if (packetData->appendRawData((const unsigned char*)encoded->data.constData(), encoded->data.size())) {
+                packetData->endLevel(encodedLevel);
+                ++_encodeCacheHits;
+                params.trackSend(getID(), encodeKey.lastEdited);
+                return appendState;
+            }
+
+            // it didn't fit whole, the regular path below knows how to send part of it
+            packetData->discardLevel(encodedLevel);
+        } else {
+            ++_encodeCacheMisses;
+        }
+    }
+
     // encode our ID as a byte count coded byte stream
     QByteArray encodedID = getID().toRfc4122();
 
@@ -206,6 +242,7 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
 
     EntityPropertyFlags propertiesDidntFit = requestedProperties;
 
+    int entityOffset = packetData->getUncompressedByteOffset();
     LevelDetails entityLevel = packetData->startLevel();
 
     quint64 lastEdited = getLastEdited();
@@ -385,6 +422,14 @@ OctreeElement::AppendState EntityItem::appendEntityData(OctreePacketData* packet
         appendState = OctreeElement::NONE; // if we got here, then we didn't include the item
     }
 
+    // Keep a complete encoding around for the next client that needs this entity
+    if (useEncodeCache && appendState == OctreeElement::COMPLETED) {
+        auto encoded = std::make_shared<EncodedEntity>(encodeKey);
+        encoded->data = QByteArray((const char*)packetData->getUncompressedData(entityOffset),
+                                   packetData->getUncompressedByteOffset() - entityOffset);
+        std::atomic_store(&encodeCacheSlot, EncodedEntityPointer(std::move(encoded)));
+    }
+
     // If any part of the model items didn't fit, then the element is considered partial
     if (appendState != OctreeElement::COMPLETED) {
         // add this item into our list for the next appendElementData() pass
@@ -12,6 +12,7 @@
 #ifndef hifi_EntityItem_h
 #define hifi_EntityItem_h
 
+#include <atomic>
 #include <memory>
 #include <stdint.h>
 
@@ -139,6 +140,11 @@ public:
                                                         EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
                                                         const bool destinationNodeCanGetAndSetPrivateUserData = false) const;
 
+    // Servers sending the same unchanged entities to many clients can keep each entity's last complete encoding
+    static void setEncodeCacheEnabled(bool enabled) { _encodeCacheEnabled = enabled; }
+    static quint64 getEncodeCacheHits() { return _encodeCacheHits; }
+    static quint64 getEncodeCacheMisses() { return _encodeCacheMisses; }
+
     virtual void appendSubclassData(OctreePacketData* packetData, EncodeBitstreamParams& params,
                                     EntityTreeElementExtraEncodeDataPointer entityTreeElementExtraEncodeData,
                                     EntityPropertyFlags& requestedProperties,
@@ -671,6 +677,27 @@ protected:
     void serializeActions(bool& success, QByteArray& result) const;
     QHash<QUuid, EntityDynamicPointer> _objectActions;
 
+    // an encoding is valid for as long as none of the timestamps the send threads watch for changes has moved
+    struct EncodedEntity {
+        bool matches(const EncodedEntity& other) const {
+            return lastEdited == other.lastEdited && lastUpdated == other.lastUpdated &&
+                lastSimulated == other.lastSimulated && changedOnServer == other.changedOnServer;
+        }
+
+        quint64 lastEdited { 0 };
+        quint64 lastUpdated { 0 };
+        quint64 lastSimulated { 0 };
+        quint64 changedOnServer { 0 };
+        QByteArray data;
+    };
+    using EncodedEntityPointer = std::shared_ptr<const EncodedEntity>;
+
+    // indexed by whether the private user data was included, only accessed through std::atomic_load and std::atomic_store
+    mutable EncodedEntityPointer _encodeCache[2];
+    static bool _encodeCacheEnabled;
+    static std::atomic<quint64> _encodeCacheHits;
+    static std::atomic<quint64> _encodeCacheMisses;
+
     static int _maxActionsDataSize;
     mutable QByteArray _allActionsDataCache;
 
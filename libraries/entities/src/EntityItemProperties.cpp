@@ -1555,7 +1555,8 @@ ScriptValue EntityItemProperties::copyToScriptValue(ScriptEngine* engine, bool s
     // (There may be exceptions, but if so, they are bugs.)
     // In all other cases, you are welcome to inspect the code and try to figure out what was intended. I wish you luck. -HRS 1/18/17
     ScriptValue properties = engine->newObject();
-    EntityItemProperties defaultEntityProperties;
+    // constructing all the default properties costs about as much as the conversion of a few of them
+    static thread_local EntityItemProperties defaultEntityProperties;
 
     const bool pseudoPropertyFlagsActive = pseudoPropertyFlags.test(EntityPseudoPropertyFlag::FlagsActive);
     // Fix to skip the default return all mechanism, when pseudoPropertyFlagsActive
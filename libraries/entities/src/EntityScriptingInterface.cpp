@@ -73,6 +73,7 @@ void staticEntityScriptInitializer(ScriptManager* manager) {
 
     scriptEngine->registerGlobalObject("Entities", entityScriptingInterface.data());
     scriptEngine->registerFunction("Entities", "getMultipleEntityProperties", EntityScriptingInterface::getMultipleEntityProperties);
+    scriptEngine->registerFunction("Entities", "getMultipleEntityPropertyColumns", EntityScriptingInterface::getMultipleEntityPropertyColumns);
 
     // "The return value of QObject::sender() is not valid when the slot is called via a Qt::DirectConnection from a thread
     // different from this object's thread. Do not use this function in this type of scenario."
@@ -911,6 +912,29 @@ void EntityScriptingInterface::readExtendedPropertyStringValue(const ScriptValue
     }
 }
 
+void EntityScriptingInterface::multipleEntityWorker(const QVector<QUuid>& entityIDs,
+                                                    std::function<void(const QUuid&, const EntityItemPointer&)> actor) {
+    if (!_entityTree) {
+        return;
+    }
+
+    // the lock is released between batches so that a long list of entities doesn't hold up the tree
+    const int lockAmount = 500;
+    int i = 0;
+    int size = entityIDs.size();
+    while (i < size) {
+        _entityTree->withReadLock([&] {
+            for (int j = 0; j < lockAmount && i < size; ++i, ++j) {
+                const auto& entityID = entityIDs.at(i);
+                const EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(entityID));
+                if (entity) {
+                    actor(entityID, entity);
+                }
+            }
+        });
+    }
+}
+
 ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(ScriptEngine* engine, QVector<QUuid> entityIDs, const ScriptValue& extendedDesiredProperties) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -941,38 +965,27 @@ ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(Script
         desiredProperties.setHasProperty(PROP_PARENT_JOINT_INDEX);
     }
     QVector<EntityPropertiesResult> resultProperties;
-    if (_entityTree) {
+    {
         PROFILE_RANGE(script_entities, "EntityScriptingInterface::getMultipleEntityProperties>Obtaining Properties");
-        int i = 0;
-        const int lockAmount = 500;
-        int size = entityIDs.size();
-        while (i < size) {
-            _entityTree->withReadLock([&] {
-                for (int j = 0; j < lockAmount && i < size; ++i, ++j) {
-                    const auto& entityID = entityIDs.at(i);
-                    const EntityItemPointer entity = _entityTree->findEntityByEntityItemID(EntityItemID(entityID));
-                    if (entity) {
-                        if (pseudoPropertyFlags.none() && desiredProperties.isEmpty()) {
-                            // these are left out of EntityItem::getEntityProperties so that localPosition and localRotation
-                            // don't end up in json saves, etc.  We still want them here, though.
-                            EncodeBitstreamParams params; // unknown
-                            desiredProperties = entity->getEntityProperties(params);
-                            desiredProperties.setHasProperty(PROP_LOCAL_POSITION);
-                            desiredProperties.setHasProperty(PROP_LOCAL_ROTATION);
-                            desiredProperties.setHasProperty(PROP_LOCAL_VELOCITY);
-                            desiredProperties.setHasProperty(PROP_LOCAL_ANGULAR_VELOCITY);
-                            desiredProperties.setHasProperty(PROP_LOCAL_DIMENSIONS);
-                            pseudoPropertyFlags.set();
-                            needsScriptSemantics = true;
-                        }
+        multipleEntityWorker(entityIDs, [&](const QUuid& entityID, const EntityItemPointer& entity) {
+            if (pseudoPropertyFlags.none() && desiredProperties.isEmpty()) {
+                // these are left out of EntityItem::getEntityProperties so that localPosition and localRotation
+                // don't end up in json saves, etc.  We still want them here, though.
+                EncodeBitstreamParams params; // unknown
+                desiredProperties = entity->getEntityProperties(params);
+                desiredProperties.setHasProperty(PROP_LOCAL_POSITION);
+                desiredProperties.setHasProperty(PROP_LOCAL_ROTATION);
+                desiredProperties.setHasProperty(PROP_LOCAL_VELOCITY);
+                desiredProperties.setHasProperty(PROP_LOCAL_ANGULAR_VELOCITY);
+                desiredProperties.setHasProperty(PROP_LOCAL_DIMENSIONS);
+                pseudoPropertyFlags.set();
+                needsScriptSemantics = true;
+            }
 
-                        auto properties = entity->getProperties(desiredProperties, true);
-                        EntityPropertiesResult result(properties, entity->getScalesWithParent());
-                        resultProperties.append(result);
-                    }
-                }
-            });
-        }
+            auto properties = entity->getProperties(desiredProperties, true);
+            EntityPropertiesResult result(properties, entity->getScalesWithParent());
+            resultProperties.append(result);
+        });
     }
     ScriptValue finalResult = engine->newArray(resultProperties.size());
     quint32 i = 0;
@@ -991,6 +1004,195 @@ ScriptValue EntityScriptingInterface::getMultipleEntityPropertiesInternal(Script
     return finalResult;
 }
 
+// A property returned by getMultipleEntityPropertyColumns in a Float32Array, with a fixed number of floats per entity
+struct FloatPropertyColumn {
+    const char* name;
+    EntityPropertyList property;
+    int size;
+    void (*read)(const EntityItemProperties& properties, float* out);
+};
+
+static void writeVec3(const glm::vec3& value, float* out) {
+    out[0] = value.x;
+    out[1] = value.y;
+    out[2] = value.z;
+}
+
+static void writeQuat(const glm::quat& value, float* out) {
+    out[0] = value.x;
+    out[1] = value.y;
+    out[2] = value.z;
+    out[3] = value.w;
+}
+
+static const FloatPropertyColumn FLOAT_PROPERTY_COLUMNS[] = {
+    { "position", PROP_POSITION, 3, [](const EntityItemProperties& p, float* out) { writeVec3(p.getPosition(), out); } },
+    { "rotation", PROP_ROTATION, 4, [](const EntityItemProperties& p, float* out) { writeQuat(p.getRotation(), out); } },
+    { "dimensions", PROP_DIMENSIONS, 3, [](const EntityItemProperties& p, float* out) { writeVec3(p.getDimensions(), out); } },
+    { "registrationPoint", PROP_REGISTRATION_POINT, 3,
+        [](const EntityItemProperties& p, float* out) { writeVec3(p.getRegistrationPoint(), out); } },
+    { "velocity", PROP_VELOCITY, 3, [](const EntityItemProperties& p, float* out) { writeVec3(p.getVelocity(), out); } },
+    { "angularVelocity", PROP_ANGULAR_VELOCITY, 3,
+        [](const EntityItemProperties& p, float* out) { writeVec3(p.getAngularVelocity(), out); } },
+    { "gravity", PROP_GRAVITY, 3, [](const EntityItemProperties& p, float* out) { writeVec3(p.getGravity(), out); } },
+    { "acceleration", PROP_ACCELERATION, 3, [](const EntityItemProperties& p, float* out) { writeVec3(p.getAcceleration(), out); } },
+    { "localPosition", PROP_LOCAL_POSITION, 3, [](const EntityItemProperties& p, float* out) { writeVec3(p.getLocalPosition(), out); } },
+    { "localRotation", PROP_LOCAL_ROTATION, 4, [](const EntityItemProperties& p, float* out) { writeQuat(p.getLocalRotation(), out); } },
+    { "localVelocity", PROP_LOCAL_VELOCITY, 3, [](const EntityItemProperties& p, float* out) { writeVec3(p.getLocalVelocity(), out); } },
+    { "localAngularVelocity", PROP_LOCAL_ANGULAR_VELOCITY, 3,
+        [](const EntityItemProperties& p, float* out) { writeVec3(p.getLocalAngularVelocity(), out); } },
+    { "localDimensions", PROP_LOCAL_DIMENSIONS, 3,
+        [](const EntityItemProperties& p, float* out) { writeVec3(p.getLocalDimensions(), out); } },
+    { "density", PROP_DENSITY, 1, [](const EntityItemProperties& p, float* out) { *out = p.getDensity(); } },
+    { "damping", PROP_DAMPING, 1, [](const EntityItemProperties& p, float* out) { *out = p.getDamping(); } },
+    { "angularDamping", PROP_ANGULAR_DAMPING, 1, [](const EntityItemProperties& p, float* out) { *out = p.getAngularDamping(); } },
+    { "restitution", PROP_RESTITUTION, 1, [](const EntityItemProperties& p, float* out) { *out = p.getRestitution(); } },
+    { "friction", PROP_FRICTION, 1, [](const EntityItemProperties& p, float* out) { *out = p.getFriction(); } },
+    { "lifetime", PROP_LIFETIME, 1, [](const EntityItemProperties& p, float* out) { *out = p.getLifetime(); } }
+};
+
+static const FloatPropertyColumn* findFloatPropertyColumn(const QString& name) {
+    for (const auto& column : FLOAT_PROPERTY_COLUMNS) {
+        if (name == QLatin1String(column.name)) {
+            return &column;
+        }
+    }
+    return nullptr;
+}
+
+// Static method to make sure that we have the right script engine.
+ScriptValue EntityScriptingInterface::getMultipleEntityPropertyColumns(ScriptContext* context, ScriptEngine* engine) {
+    const int ARGUMENT_ENTITY_IDS = 0;
+    const int ARGUMENT_EXTENDED_DESIRED_PROPERTIES = 1;
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    const auto entityIDs = scriptvalue_cast<QVector<QUuid>>(context->argument(ARGUMENT_ENTITY_IDS));
+    return entityScriptingInterface->getMultipleEntityPropertyColumnsInternal(engine, entityIDs, context->argument(ARGUMENT_EXTENDED_DESIRED_PROPERTIES));
+}
+
+ScriptValue EntityScriptingInterface::getMultipleEntityPropertyColumnsInternal(ScriptEngine* engine, QVector<QUuid> entityIDs, const ScriptValue& extendedDesiredProperties) {
+    PROFILE_RANGE(script_entities, __FUNCTION__);
+
+    ScriptValueList propertyNames;
+    if (extendedDesiredProperties.isString()) {
+        propertyNames.append(extendedDesiredProperties);
+    } else if (extendedDesiredProperties.isArray()) {
+        const quint32 length = extendedDesiredProperties.property("length").toInt32();
+        for (quint32 i = 0; i < length; i++) {
+            propertyNames.append(extendedDesiredProperties.property(i));
+        }
+    }
+
+    // properties with a Float32Array column are read straight from the entity properties, all others are taken from a
+    // script object per entity, like getMultipleEntityProperties returns
+    std::vector<const FloatPropertyColumn*> floatColumns;
+    QStringList objectColumnNames;
+    ScriptValue objectDesiredProperties = engine->newArray();
+    EntityPseudoPropertyFlags pseudoPropertyFlags;
+    pseudoPropertyFlags.set(EntityPseudoPropertyFlag::FlagsActive);
+    for (const auto& propertyName : propertyNames) {
+        const auto name = propertyName.toString();
+        auto floatColumn = findFloatPropertyColumn(name);
+        if (floatColumn) {
+            floatColumns.push_back(floatColumn);
+        } else {
+            readExtendedPropertyStringValue(propertyName, pseudoPropertyFlags);
+            objectDesiredProperties.setProperty(objectColumnNames.size(), propertyName);
+            objectColumnNames.append(name);
+        }
+    }
+
+    EntityPropertyFlags objectProperties = scriptvalue_cast<EntityPropertyFlags>(objectDesiredProperties);
+    EntityPropertyFlags desiredProperties = objectProperties;
+    for (const auto& floatColumn : floatColumns) {
+        desiredProperties.setHasProperty(floatColumn->property);
+    }
+    bool needsScriptSemantics = desiredProperties.getHasProperty(PROP_POSITION) ||
+        desiredProperties.getHasProperty(PROP_ROTATION) ||
+        desiredProperties.getHasProperty(PROP_LOCAL_POSITION) ||
+        desiredProperties.getHasProperty(PROP_LOCAL_ROTATION) ||
+        desiredProperties.getHasProperty(PROP_LOCAL_VELOCITY) ||
+        desiredProperties.getHasProperty(PROP_LOCAL_ANGULAR_VELOCITY) ||
+        desiredProperties.getHasProperty(PROP_LOCAL_DIMENSIONS);
+    if (needsScriptSemantics) {
+        // if we are explicitly getting position or rotation, we need parent information to make sense of them.
+        desiredProperties.setHasProperty(PROP_PARENT_ID);
+        desiredProperties.setHasProperty(PROP_PARENT_JOINT_INDEX);
+    }
+
+    // copyToScriptValue converts every property when no property is desired, so when only pseudo-properties are asked
+    // for, the object of each entity desires a placeholder that matches no property instead
+    if (objectProperties.isEmpty()) {
+        objectProperties.setHasProperty(PROP_PAGED_PROPERTY);
+    }
+
+    QVector<QUuid> foundIDs;
+    QVector<EntityPropertiesResult> resultProperties;
+    if (!propertyNames.isEmpty()) {
+        PROFILE_RANGE(script_entities, "EntityScriptingInterface::getMultipleEntityPropertyColumns>Obtaining Properties");
+        foundIDs.reserve(entityIDs.size());
+        resultProperties.reserve(entityIDs.size());
+        multipleEntityWorker(entityIDs, [&](const QUuid& entityID, const EntityItemPointer& entity) {
+            foundIDs.append(entityID);
+            resultProperties.append(EntityPropertiesResult(entity->getProperties(desiredProperties, true),
+                                                           entity->getScalesWithParent()));
+        });
+    }
+
+    const int numFound = resultProperties.size();
+    std::vector<QByteArray> floatColumnData;
+    floatColumnData.reserve(floatColumns.size());
+    for (const auto& floatColumn : floatColumns) {
+        floatColumnData.emplace_back(numFound * floatColumn->size * (int)sizeof(float), Qt::Uninitialized);
+    }
+    std::vector<ScriptValue> objectColumns;
+    objectColumns.reserve(objectColumnNames.size());
+    for (int k = 0; k < objectColumnNames.size(); ++k) {
+        objectColumns.push_back(engine->newArray(numFound));
+    }
+
+    {
+        PROFILE_RANGE(script_entities, "EntityScriptingInterface::getMultipleEntityPropertyColumns>Columns");
+        for (int i = 0; i < numFound; ++i) {
+            const auto& result = resultProperties.at(i);
+            auto properties = needsScriptSemantics ?
+                convertPropertiesToScriptSemantics(result.properties, result.scalesWithParent) : result.properties;
+
+            for (size_t k = 0; k < floatColumns.size(); ++k) {
+                auto out = reinterpret_cast<float*>(floatColumnData[k].data()) + i * floatColumns[k]->size;
+                floatColumns[k]->read(properties, out);
+            }
+
+            if (!objectColumnNames.isEmpty()) {
+                properties.setDesiredProperties(objectProperties);
+                ScriptValue object = properties.copyToScriptValue(engine, false, false, false, pseudoPropertyFlags);
+                for (int k = 0; k < objectColumnNames.size(); ++k) {
+                    // subproperties are asked for in dot notation
+                    ScriptValue value = object;
+                    for (const auto& part : objectColumnNames[k].split('.')) {
+                        value = value.property(part);
+                    }
+                    objectColumns[k].setProperty((quint32)i, value);
+                }
+            }
+        }
+    }
+
+    ScriptValue finalResult = engine->newObject();
+    finalResult.setProperty("entityIDs", engine->toScriptValue(foundIDs));
+    if (!floatColumns.empty()) {
+        ScriptValue float32Array = engine->globalObject().property("Float32Array");
+        for (size_t k = 0; k < floatColumns.size(); ++k) {
+            auto buffer = engine->newArrayBuffer(floatColumnData[k]);
+            finalResult.setProperty(floatColumns[k]->name, float32Array.construct(ScriptValueList{ buffer }));
+        }
+    }
+    for (int k = 0; k < objectColumnNames.size(); ++k) {
+        finalResult.setProperty(objectColumnNames[k], objectColumns[k]);
+    }
+    return finalResult;
+}
+
 QUuid EntityScriptingInterface::editEntity(const QUuid& id, const EntityItemProperties& scriptSideProperties) {
     PROFILE_RANGE(script_entities, __FUNCTION__);
 
@@ -219,6 +219,46 @@ public:
     static ScriptValue getMultipleEntityProperties(ScriptContext* context, ScriptEngine* engine);
     ScriptValue getMultipleEntityPropertiesInternal(ScriptEngine* engine, QVector<QUuid> entityIDs, const ScriptValue& extendedDesiredProperties);
 
+    /*@jsdoc
+     * The properties of multiple entities, one column per property, as returned by
+     * {@link Entities.getMultipleEntityPropertyColumns}. Entry <code>i</code> of each column belongs to the entity
+     * <code>entityIDs[i]</code>.
+     * <p>Vector properties (e.g., <code>position</code>, <code>dimensions</code>, <code>velocity</code>) are returned in a
+     * <code>Float32Array</code> with 3 numbers per entity, rotations (<code>rotation</code>, <code>localRotation</code>) in a
+     * <code>Float32Array</code> with 4 numbers per entity in <code>x, y, z, w</code> order, and numeric physics properties
+     * (e.g., <code>damping</code>, <code>lifetime</code>) in a <code>Float32Array</code> with 1 number per entity. All other
+     * properties are returned in an array with one value per entity.</p>
+     * @typedef {object} Entities.EntityPropertyColumns
+     * @property {Uuid[]} entityIDs - The IDs of the entities that were found, in the order they were requested.
+     * @property {Float32Array|Array} [propertyName] - A column for each property requested.
+     */
+    /*@jsdoc
+     * Gets the properties of multiple entities in columns rather than as an object per entity. This is much quicker than
+     * {@link Entities.getMultipleEntityProperties} for scripts that process the positions or rotations of many entities each
+     * frame, because vector and rotation properties are returned in typed arrays instead of a script object per value.
+     * @function Entities.getMultipleEntityPropertyColumns
+     * @param {Uuid[]} entityIDs - The IDs of the entities to get the properties of.
+     * @param {string[]|string} desiredProperties - The name or names of the properties to get. For properties that are
+     *     objects (e.g., the <code>"keyLight"</code> property), use the property and subproperty names in dot notation (e.g.,
+     *     <code>"keyLight.color"</code>).
+     * @returns {Entities.EntityPropertyColumns} The specified properties of the entities that can be found.
+     * @example <caption>Find the nearby entity that is highest up</caption>
+     * var SEARCH_RADIUS = 50; // meters
+     * var entityIDs = Entities.findEntities(MyAvatar.position, SEARCH_RADIUS);
+     * var columns = Entities.getMultipleEntityPropertyColumns(entityIDs, "position");
+     * var highest = -1;
+     * for (var i = 0; i < columns.entityIDs.length; i++) {
+     *     if (highest === -1 || columns.position[3 * i + 1] > columns.position[3 * highest + 1]) {
+     *         highest = i;
+     *     }
+     * }
+     * if (highest !== -1) {
+     *     print("Highest entity: " + columns.entityIDs[highest]);
+     * }
+    */
+    static ScriptValue getMultipleEntityPropertyColumns(ScriptContext* context, ScriptEngine* engine);
+    ScriptValue getMultipleEntityPropertyColumnsInternal(ScriptEngine* engine, QVector<QUuid> entityIDs, const ScriptValue& extendedDesiredProperties);
+
     QUuid addEntityInternal(const EntityItemProperties& properties, entity::HostType entityHostType);
 
 public slots:
@@ -2504,6 +2544,8 @@ private:
     bool actionWorker(const QUuid& entityID, std::function<bool(EntitySimulationPointer, EntityItemPointer)> actor);
     bool polyVoxWorker(QUuid entityID, std::function<bool(PolyVoxEntityItem&)> actor);
     bool setPoints(QUuid entityID, std::function<bool(LineEntityItem&)> actor);
+    /// calls actor with each of the entities that are found, taking the read lock of the tree once per batch of them
+    void multipleEntityWorker(const QVector<QUuid>& entityIDs, std::function<void(const QUuid&, const EntityItemPointer&)> actor);
     void queueEntityMessage(PacketType packetType, EntityItemID entityID, const EntityItemProperties& properties);
     bool addLocalEntityCopy(EntityItemProperties& propertiesWithSimID, EntityItemID& id, bool isClone = false);
     static void readExtendedPropertyStringValue(const ScriptValue& extendedProperty,
@@ -13,8 +13,13 @@
 //
 
 #include "EntityTree.h"
+
+#include <limits>
+
 #include <QtCore/QDateTime>
 #include <QtCore/QQueue>
+#include <QtCore/QThread>
+#include <QtConcurrent/QtConcurrentRun>
 #include <openssl/err.h>
 #include <openssl/pem.h>
 #include <openssl/x509.h>
@@ -29,6 +34,7 @@
 #include <PerfStat.h>
 #include <Profile.h>
 #include <AddressManager.h>
+#include <OctreeDataUtils.h>
 
 #include "EntitySimulation.h"
 #include "VariantMapToScriptValue.h"
@@ -82,6 +88,7 @@ OctreeElementPointer EntityTree::createNewElement(unsigned char* octalCode) {
 
 void EntityTree::eraseDomainAndNonOwnedEntities() {
     emit clearingEntities();
+    journalNeedsFullWrite();
 
     if (_simulation) {
         // local-entities are not in the simulation, so we clear ALL
@@ -133,6 +140,7 @@ void EntityTree::eraseDomainAndNonOwnedEntities() {
 
 void EntityTree::eraseAllOctreeElements(bool createNewRoot) {
     emit clearingEntities();
+    journalNeedsFullWrite();
 
     if (_simulation) {
         _simulation->clearEntities();
@@ -299,6 +307,7 @@ void EntityTree::postAddEntity(EntityItemPointer entity) {
     }
 
     _isDirty = true;
+    journalEditedEntity(entity->getEntityItemID());
 
     // find and hook up any entities with this entity as a (previously) missing parent
     fixupNeedsParentFixups();
@@ -365,6 +374,7 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
                     emit editingEntityPointer(entity);
                 }
                 _isDirty = true;
+                journalEditedEntity(entity->getEntityItemID());
             }
         }
     } else {
@@ -500,6 +510,7 @@ bool EntityTree::updateEntity(EntityItemPointer entity, const EntityItemProperti
         }
 
         _isDirty = true;
+        journalEditedEntity(entity->getEntityItemID());
 
         uint32_t newFlags = entity->getDirtyFlags() & ~preFlags;
         if (newFlags) {
@@ -738,6 +749,7 @@ void EntityTree::deleteEntitiesByPointer(const std::vector<EntityItemPointer>& e
     for (auto entity : entities) {
         if (entity->getElement()) {
             theOperator.addEntityToDeleteList(entity);
+            journalDeletedEntity(entity->getEntityItemID());
             emit deletingEntity(entity->getID());
             emit deletingEntityPointer(entity.get());
         }
@@ -2892,6 +2904,359 @@ bool EntityTree::writeToJSON(QString& jsonString, const OctreeElementPointer& el
     return true;
 }
 
+void EntityTree::journalEditedEntity(const EntityItemID& id) {
+    if (getIsServer()) {
+        std::lock_guard<std::mutex> lock(_journalLock);
+        _journalDeletedIDs.remove(id);
+        _journalEditedIDs.insert(id);
+    }
+}
+
+void EntityTree::journalDeletedEntity(const EntityItemID& id) {
+    if (getIsServer()) {
+        std::lock_guard<std::mutex> lock(_journalLock);
+        _journalEditedIDs.remove(id);
+        _journalDeletedIDs.insert(id);
+    }
+}
+
+void EntityTree::journalNeedsFullWrite() {
+    std::lock_guard<std::mutex> lock(_journalLock);
+    _journalNeedsFullWrite = true;
+}
+
+void EntityTree::resetJournal() {
+    std::lock_guard<std::mutex> lock(_journalLock);
+    _journalEditedIDs.clear();
+    _journalDeletedIDs.clear();
+    _journalNeedsFullWrite = false;
+}
+
+bool EntityTree::writeJournalRecord(QByteArray& record) {
+    QSet<EntityItemID> editedIDs;
+    QSet<EntityItemID> deletedIDs;
+    {
+        std::lock_guard<std::mutex> lock(_journalLock);
+        if (_journalNeedsFullWrite) {
+            return false;
+        }
+        editedIDs.swap(_journalEditedIDs);
+        deletedIDs.swap(_journalDeletedIDs);
+    }
+
+    record.clear();
+    if (editedIDs.empty() && deletedIDs.empty()) {
+        return true;
+    }
+
+    // same layout as the persist file, plus the IDs of the deleted entities
+    QString jsonString = QString("{\n  \"DataVersion\": %1,\n  \"Entities\": [").arg(_persistDataVersion);
+
+    // records are written on every persist, so keep the engine rather than creating one each time
+    if (!_journalScriptEngine) {
+        _journalScriptEngine = newScriptEngine();
+    }
+    RecurseOctreeToJSONOperator theOperator(nullptr, _journalScriptEngine.get(), jsonString);
+    withReadLock([&] {
+        for (const auto& id : editedIDs) {
+            EntityItemPointer entity = findEntityByEntityItemID(id);
+            if (entity) {
+                theOperator.processEntity(entity);
+            }
+        }
+    });
+    jsonString = theOperator.getJson();
+
+    jsonString += "\n    ],\n  \"Deleted\": [";
+    bool comma = false;
+    for (const auto& id : deletedIDs) {
+        jsonString += QString(comma ? ",\n    \"%1\"" : "\n    \"%1\"").arg(id.toString());
+        comma = true;
+    }
+
+    PacketVersion expectedVersion = versionForPacketType(expectedDataPacketType());
+    jsonString += QString("\n    ],\n  \"Id\": \"%1\",\n  \"Version\": %2\n}\n").arg(_persistID.toString()).arg((int)expectedVersion);
+
+    record = jsonString.toUtf8();
+    return true;
+}
+
+namespace {
+
+// how each entity of a binary snapshot is stored
+enum BinaryEntityEncoding : quint8 {
+    EDIT_PACKET_ENCODING = 0, // as in an EntityAdd packet
+    JSON_ENCODING = 1 // as in the JSON persist file, for the rare entities the edit packet encoding can't hold
+};
+
+// encoding, then size
+const int BINARY_ENTITY_HEADER_SIZE = sizeof(quint8) + sizeof(quint32);
+
+// OctreePacketData prefixes strings with a 16 bit length, so longer ones would be silently truncated
+bool fitsEditPacketEncoding(const EntityItemProperties& properties) {
+    const int MAX_STRING_SIZE = std::numeric_limits<uint16_t>::max();
+    for (const QString* string : { &properties.getUserData(), &properties.getPrivateUserData(), &properties.getScript(),
+                                   &properties.getServerScripts(), &properties.getTextures(), &properties.getText(),
+                                   &properties.getMaterialData() }) {
+        // a UTF-16 code unit takes at most 3 bytes in UTF-8, so most strings don't need converting
+        if (string->size() * 3 > MAX_STRING_SIZE && string->toUtf8().size() > MAX_STRING_SIZE) {
+            return false;
+        }
+    }
+    return properties.getVoxelData().size() <= MAX_STRING_SIZE;
+}
+
+void appendBinaryEntity(QByteArray& data, BinaryEntityEncoding encoding, const QByteArray& bytes) {
+    quint32 size = bytes.size();
+    data.append(reinterpret_cast<const char*>(&encoding), sizeof(encoding));
+    data.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    data.append(bytes);
+}
+
+}
+
+bool EntityTree::writeToBinary(QByteArray& data) {
+    OctreeUtils::BinarySnapshotHeader header;
+    header.contentVersion = versionForPacketType(expectedDataPacketType());
+
+    // the same ceiling as adds sent by EntityEditPacketSender, so anything clients can create fits
+    const int MAX_ENTITY_SIZE = NLPacket::maxPayloadSize(PacketType::EntityAdd) * 10;
+
+    QByteArray entityData;
+    QByteArray buffer;
+    ScriptEnginePointer engine;
+    int numJSONEntities = 0;
+
+    withReadLock([&] {
+        header.id = _persistID;
+        header.dataVersion = _persistDataVersion;
+
+        QList<EntityItemPointer> allEntities;
+        {
+            QReadLocker locker(&_entityMapLock);
+            allEntities = _entityMap.values();
+        }
+
+        for (const auto& entity : allEntities) {
+            if (!entity->isParentIDValid()) {
+                continue; // as for the JSON persist file
+            }
+
+            EntityItemProperties properties = entity->getProperties();
+            if (fitsEditPacketEncoding(properties)) {
+                buffer.resize(MAX_ENTITY_SIZE);
+                EntityPropertyFlags didntFitProperties;
+                auto appendState = EntityItemProperties::encodeEntityEditPacket(PacketType::EntityAdd, entity->getEntityItemID(),
+                    properties, buffer, properties.getDesiredProperties(), didntFitProperties);
+                if (appendState == OctreeElement::COMPLETED) {
+                    appendBinaryEntity(entityData, EDIT_PACKET_ENCODING, buffer);
+                    ++header.numEntities;
+                    continue;
+                }
+            }
+
+            // V8TODO: Creating new script engine each time is very inefficient
+            if (!engine) {
+                engine = newScriptEngine();
+            }
+            RecurseOctreeToJSONOperator theOperator(nullptr, engine.get(), QString());
+            theOperator.processEntity(entity);
+            appendBinaryEntity(entityData, JSON_ENCODING, theOperator.getJson().trimmed().toUtf8());
+            ++header.numEntities;
+            ++numJSONEntities;
+        }
+    });
+
+    data.clear();
+    header.write(data);
+    data.append(entityData);
+
+    if (numJSONEntities > 0) {
+        qCDebug(entities) << "EntityTree::writeToBinary:" << numJSONEntities << "of" << header.numEntities
+                          << "entities are too large for the edit packet encoding, stored them as JSON";
+    }
+    return true;
+}
+
+bool EntityTree::readFromBinary(const char* data, qint64 size) {
+    OctreeUtils::BinarySnapshotHeader header;
+    int headerSize = header.read(data, size);
+    if (headerSize < 0) {
+        qCWarning(entities) << "EntityTree::readFromBinary: not a binary entity snapshot";
+        return false;
+    }
+
+    PacketVersion contentVersion = versionForPacketType(expectedDataPacketType());
+    if (header.contentVersion != contentVersion) {
+        qCWarning(entities) << "EntityTree::readFromBinary: snapshot is for content version" << header.contentVersion
+                            << "- expected" << contentVersion;
+        return false;
+    }
+
+    struct BinaryEntity {
+        BinaryEntityEncoding encoding;
+        const char* data;
+        quint32 size;
+    };
+    std::vector<BinaryEntity> binaryEntities;
+    binaryEntities.reserve(header.numEntities);
+
+    const char* dataAt = data + headerSize;
+    const char* dataEnd = data + size;
+    while (dataEnd - dataAt >= BINARY_ENTITY_HEADER_SIZE) {
+        BinaryEntity binaryEntity;
+        memcpy(&binaryEntity.encoding, dataAt, sizeof(binaryEntity.encoding));
+        memcpy(&binaryEntity.size, dataAt + sizeof(binaryEntity.encoding), sizeof(binaryEntity.size));
+        dataAt += BINARY_ENTITY_HEADER_SIZE;
+        if (binaryEntity.size > (quint64)(dataEnd - dataAt)) {
+            break;
+        }
+        binaryEntity.data = dataAt;
+        dataAt += binaryEntity.size;
+        binaryEntities.push_back(binaryEntity);
+    }
+
+    if (dataAt != dataEnd || binaryEntities.size() != header.numEntities) {
+        qCWarning(entities) << "EntityTree::readFromBinary: snapshot is truncated, found" << binaryEntities.size()
+                            << "of" << header.numEntities << "entities";
+        return false;
+    }
+
+    // decoding doesn't touch the tree, so it is spread over the thread pool, adding to the tree is not
+    int numEntities = (int)binaryEntities.size();
+    std::vector<EntityItemID> entityIDs(numEntities);
+    std::vector<EntityItemProperties> entityProperties(numEntities);
+    std::vector<char> decoded(numEntities, 0);
+
+    int numThreads = std::max(1, QThread::idealThreadCount());
+    int entitiesPerThread = (numEntities + numThreads - 1) / numThreads;
+    std::vector<QFuture<void>> decodes;
+    for (int begin = 0; begin < numEntities; begin += entitiesPerThread) {
+        int end = std::min(begin + entitiesPerThread, numEntities);
+        decodes.push_back(QtConcurrent::run([&, begin, end] {
+            for (int i = begin; i < end; ++i) {
+                const auto& binaryEntity = binaryEntities[i];
+                if (binaryEntity.encoding == EDIT_PACKET_ENCODING) {
+                    int processedBytes = 0;
+                    decoded[i] = EntityItemProperties::decodeEntityEditPacket(
+                        reinterpret_cast<const unsigned char*>(binaryEntity.data), binaryEntity.size, processedBytes,
+                        entityIDs[i], entityProperties[i]);
+                }
+            }
+        }));
+    }
+    for (auto& decode : decodes) {
+        decode.waitForFinished();
+    }
+
+    _persistID = header.id;
+    _persistDataVersion = (int)header.dataVersion;
+
+    bool success = true;
+    QVariantList jsonEntities;
+    for (int i = 0; i < numEntities; ++i) {
+        const auto& binaryEntity = binaryEntities[i];
+        if (binaryEntity.encoding == JSON_ENCODING) {
+            QByteArray json = QByteArray::fromRawData(binaryEntity.data, binaryEntity.size);
+            jsonEntities.push_back(QJsonDocument::fromJson(json).object().toVariantMap());
+            continue;
+        }
+
+        if (!decoded[i]) {
+            qCDebug(entities) << "EntityTree::readFromBinary: can't decode entity" << i;
+            success = false;
+            continue;
+        }
+
+        if (!addEntity(entityIDs[i], entityProperties[i])) {
+            qCDebug(entities) << "adding Entity failed:" << entityIDs[i] << entityProperties[i].getType();
+            success = false;
+        }
+    }
+
+    if (!jsonEntities.empty()) {
+        QVariantMap map;
+        map["Version"] = (int)contentVersion;
+        map["Entities"] = jsonEntities;
+        success = readFromMap(map) && success;
+    }
+
+    // clones can come from either encoding, so their origins are only updated once everything is in
+    QMap<QUuid, QVector<QUuid>> cloneIDs;
+    {
+        QReadLocker locker(&_entityMapLock);
+        for (const auto& entity : _entityMap) {
+            const QUuid& cloneOriginID = entity->getCloneOriginID();
+            if (!cloneOriginID.isNull()) {
+                cloneIDs[cloneOriginID].push_back(entity->getEntityItemID());
+            }
+        }
+    }
+    for (const auto& entityID : cloneIDs.keys()) {
+        auto entity = findEntityByID(entityID);
+        if (entity) {
+            entity->setCloneIDs(cloneIDs.value(entityID));
+        }
+    }
+
+    qCDebug(entities) << "EntityTree::readFromBinary: read" << numEntities << "entities," << jsonEntities.size()
+                      << "of them as JSON, using" << decodes.size() << "threads";
+    return success;
+}
+
+int EntityTree::applyJournalRecords(const QList<QByteArray>& records) {
+    PacketVersion contentVersion = versionForPacketType(expectedDataPacketType());
+
+    int numApplied = 0;
+    for (const auto& record : records) {
+        QJsonObject root = QJsonDocument::fromJson(record).object();
+        if (root.isEmpty() || QUuid(root["Id"].toString()) != _persistID) {
+            continue; // unreadable, or for other content
+        }
+
+        // replaced entities are removed on their own, their children stay
+        std::vector<EntityItemPointer> replacedEntities;
+        QVariantList entityMaps;
+        for (const auto& entityValue : root["Entities"].toArray()) {
+            QVariantMap entityMap = entityValue.toObject().toVariantMap();
+            EntityItemPointer entity = findEntityByEntityItemID(EntityItemID(QUuid(entityMap["id"].toString())));
+            if (entity) {
+                // never replace an entity with an older version of itself
+                if (entityMap["lastEdited"].toULongLong() < entity->getLastEdited()) {
+                    continue;
+                }
+                replacedEntities.push_back(entity);
+            }
+            entityMaps.push_back(entityMap);
+        }
+
+        std::vector<EntityItemID> deletedIDs;
+        for (const auto& deletedValue : root["Deleted"].toArray()) {
+            deletedIDs.push_back(EntityItemID(QUuid(deletedValue.toString())));
+        }
+
+        withWriteLock([&] {
+            if (!replacedEntities.empty()) {
+                deleteEntitiesByPointer(replacedEntities);
+            }
+            if (!entityMaps.empty()) {
+                QVariantMap map;
+                map["Version"] = (int)contentVersion;
+                map["Entities"] = entityMaps;
+                readFromMap(map);
+            }
+        });
+        if (!deletedIDs.empty()) {
+            deleteEntitiesByID(deletedIDs, true);
+        }
+
+        _persistDataVersion = std::max(_persistDataVersion, root["DataVersion"].toInt());
+        ++numApplied;
+    }
+
+    return numApplied;
+}
+
 void EntityTree::resetClientEditStats() {
     _treeResetTime = usecTimestampNow();
     _maxEditDelta = 0;
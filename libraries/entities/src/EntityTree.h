@@ -27,6 +27,8 @@ class EntityTree;
 using EntityTreePointer = std::shared_ptr<EntityTree>;
 
 class EntitySimulation;
+class ScriptEngine;
+using ScriptEnginePointer = std::shared_ptr<ScriptEngine>;
 
 namespace EntityQueryFilterSymbol {
     static const QString NonDefault = "+";
@@ -196,6 +198,13 @@ public:
     virtual bool readFromMap(QVariantMap& entityDescription, const bool isImport = false) override;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) override;
 
+    virtual void resetJournal() override;
+    virtual bool writeJournalRecord(QByteArray& record) override;
+    virtual int applyJournalRecords(const QList<QByteArray>& records) override;
+
+    virtual bool writeToBinary(QByteArray& data) override;
+    virtual bool readFromBinary(const char* data, qint64 size) override;
+
 
     glm::vec3 getContentsDimensions();
     float getContentsLargestDimension();
@@ -320,6 +329,16 @@ protected:
         _deletedEntityItemIDs << id;
     }
 
+    void journalEditedEntity(const EntityItemID& id);
+    void journalDeletedEntity(const EntityItemID& id);
+    void journalNeedsFullWrite();
+
+    std::mutex _journalLock; /// lock of server side changes since the last persist
+    QSet<EntityItemID> _journalEditedIDs;
+    QSet<EntityItemID> _journalDeletedIDs;
+    bool _journalNeedsFullWrite { true };
+    ScriptEnginePointer _journalScriptEngine; // created by the first journal record, only used by the persist thread
+
     mutable QReadWriteLock _entityMapLock;
     QHash<EntityItemID, EntityItemPointer> _entityMap;
 
@@ -26,9 +26,11 @@ public:
 
     QString getJson() const { return _json; }
 
-private:
+    // append a single entity, outside of a tree recursion
     void processEntity(const EntityItemPointer& entity);
 
+private:
+
     ScriptEngine* _engine;
     ScriptValue _toStringMethod;
 
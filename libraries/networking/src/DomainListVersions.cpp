@@ -0,0 +1,60 @@
+//
+//  DomainListVersions.cpp
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "DomainListVersions.h"
+
+quint32 DomainListVersions::next(quint32 version) {
+    ++version;
+    return (version == 0) ? 1 : version;
+}
+
+DomainListChanges::Version DomainListChanges::recordChange(const QUuid& nodeID) {
+    _changes.push_back({ ++_version, nodeID });
+    while ((int)_changes.size() > _maxChanges) {
+        _changes.pop_front();
+    }
+    return _version;
+}
+
+bool DomainListChanges::getChangesSince(Version version, QSet<QUuid>& changedNodes) const {
+    if (version >= _version) {
+        return true;
+    }
+
+    // the change right after the given version must still be in the log
+    if (_changes.empty() || _changes.front().version > version + 1) {
+        return false;
+    }
+
+    for (auto it = _changes.crbegin(); it != _changes.crend() && it->version > version; ++it) {
+        changedNodes.insert(it->nodeID);
+    }
+    return true;
+}
+
+void DomainListTracker::clear() {
+    _version = 0;
+    _pendingVersion = 0;
+    _numPendingItems = 0;
+}
+
+void DomainListTracker::addPacket(quint32 listVersion, quint32 baseListVersion, quint32 numListItems,
+                                  quint32 numPacketItems) {
+    if (listVersion != _pendingVersion) {
+        _pendingVersion = listVersion;
+        _numPendingItems = 0;
+    }
+    _numPendingItems += numPacketItems;
+
+    // a list of changes is only complete on top of the list it holds the changes to
+    if (_numPendingItems == numListItems && (baseListVersion == 0 || baseListVersion == _version)) {
+        _version = listVersion;
+    }
+}
@@ -0,0 +1,79 @@
+//
+//  DomainListVersions.h
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_DomainListVersions_h
+#define hifi_DomainListVersions_h
+
+#include <atomic>
+#include <deque>
+
+#include <QtCore/QSet>
+#include <QtCore/QUuid>
+
+// Domain lists are versioned so that the domain-server only sends a node the changes since the last list the node
+// has all of. Version 0 means no list, and is skipped when the versions wrap around.
+namespace DomainListVersions {
+    quint32 next(quint32 version);
+}
+
+// The domain-server's log of the nodes that were added, changed or removed, so that a check-in only looks at the
+// nodes that changed since the last domain list sent to the checking-in node, not at every node.
+class DomainListChanges {
+public:
+    using Version = quint64;
+
+    DomainListChanges(int maxChanges = DEFAULT_MAX_CHANGES) : _maxChanges(maxChanges) { }
+
+    // the version of the latest change, 0 if there has been none
+    Version getVersion() const { return _version; }
+
+    Version recordChange(const QUuid& nodeID);
+
+    // adds the IDs of the nodes that changed after the given version,
+    // returns false if the oldest of those changes has already been dropped from the log
+    bool getChangesSince(Version version, QSet<QUuid>& changedNodes) const;
+
+private:
+    static const int DEFAULT_MAX_CHANGES = 4096;
+
+    struct Change {
+        Version version;
+        QUuid nodeID;
+    };
+
+    int _maxChanges;
+    Version _version { 0 };
+    std::deque<Change> _changes;
+};
+
+// What a node has of the domain lists it receives. A list can span several unreliable packets, each holding some of
+// its items, so the node only has a list once it has read every item of it, and the list it holds the changes to.
+class DomainListTracker {
+public:
+    // the last list we have all of, 0 if none, which asks the domain-server for a full list
+    quint32 getVersion() const { return _version; }
+
+    // can be called from any thread
+    void reset() { _version = 0; }
+    // also forgets the list being received, called from the thread that adds the packets
+    void clear();
+
+    // called for each domain list packet, with the number of items read from it
+    void addPacket(quint32 listVersion, quint32 baseListVersion, quint32 numListItems, quint32 numPacketItems);
+
+private:
+    std::atomic<quint32> _version { 0 };
+    quint32 _pendingVersion { 0 }; // the list we are receiving the packets of
+    quint32 _numPendingItems { 0 };
+};
+
+#endif // hifi_DomainListVersions_h
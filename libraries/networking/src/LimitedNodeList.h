@@ -313,6 +313,7 @@ public:
     void flagTimeForConnectionStep(ConnectionStep connectionStep);
 
     udt::Socket::StatsVector sampleStatsForAllConnections() { return _nodeSocket.sampleStatsForAllConnections(); }
+    udt::Socket::IOStats sampleSocketIOStats() { return _nodeSocket.sampleIOStats(); }
 
     void setConnectionMaxBandwidth(int maxBandwidth) { _nodeSocket.setConnectionMaxBandwidth(maxBandwidth); }
 
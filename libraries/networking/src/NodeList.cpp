@@ -87,6 +87,14 @@ NodeList::NodeList(char newOwnerType, int socketListenPort, int dtlsListenPort)
     // clear our NodeList when the domain changes
     connect(&_domainHandler, SIGNAL(disconnectedFromDomain()), this, SLOT(resetFromDomainHandler()));
 
+    // the domain-server only sends the changes to the last domain list we have all of,
+    // so ask for a full list once we have lost a node that it may still list
+    connect(this, &LimitedNodeList::nodeKilled, this, [this] {
+        if (QThread::currentThread() != thread() || !_isApplyingDomainList) {
+            _domainListTracker.reset();
+        }
+    }, Qt::DirectConnection);
+
     // send an ICE heartbeat as soon as we get ice server information
     connect(&_domainHandler, &DomainHandler::iceSocketAndIDReceived, this, &NodeList::handleICEConnectionToDomainServer);
 
@@ -319,6 +327,8 @@ void NodeList::reset(QString reason, bool skipDomainHandlerReset) {
         _domainHandler.softReset(reason);
     }
 
+    _domainListTracker.clear();
+
     // refresh the owner UUID to the NULL UUID
     setSessionUUID(QUuid());
     setSessionLocalID(Node::NULL_LOCAL_ID);
@@ -505,6 +515,11 @@ void NodeList::sendDomainServerCheckIn() {
             << localSockAddr << _nodeTypesOfInterest.values();
         packetStream << DependencyManager::get<AddressManager>()->getPlaceName();
 
+        if (domainPacketType == PacketType::DomainListRequest) {
+            // the domain-server only sends us the changes to the last list we have all of
+            packetStream << _domainListTracker.getVersion();
+        }
+
         if (!domainIsConnected) {
 
             // Directory services account.
@@ -766,6 +781,12 @@ void NodeList::processDomainList(QSharedPointer<ReceivedMessage> message) {
     bool newConnection;
     packetStream >> newConnection;
 
+    // the list this packet is a part of, the list it holds the changes to (0 if it is a full list), and its number of items
+    quint32 listVersion;
+    quint32 baseListVersion;
+    quint32 numListItems;
+    packetStream >> listVersion >> baseListVersion >> numListItems;
+
     if (newConnection) {
         _nodeConnectTimestamp = usecTimestampNow();
         _connectReason = Connect;
@@ -862,10 +883,26 @@ void NodeList::processDomainList(QSharedPointer<ReceivedMessage> message) {
     setPermissions(newPermissions);
     setAuthenticatePackets(isAuthenticated);
 
-    // pull each node in the packet
+    // pull each node added, changed or removed in the packet
+    quint32 numItems = 0;
+    _isApplyingDomainList = true;
     while (packetStream.device()->pos() < message->getSize()) {
-        parseNodeFromPacketStream(packetStream);
+        bool isRemoved;
+        packetStream >> isRemoved;
+        if (isRemoved) {
+            QUuid nodeUUID;
+            packetStream >> nodeUUID;
+            killNodeWithUUID(nodeUUID);
+            removeDelayedAdd(nodeUUID);
+        } else {
+            parseNodeFromPacketStream(packetStream);
+        }
+        ++numItems;
     }
+    _isApplyingDomainList = false;
+
+    // once we have all the packets of the list, and the list it holds the changes to, let the domain-server know
+    _domainListTracker.addPacket(listVersion, baseListVersion, numListItems, numItems);
 }
 
 void NodeList::processDomainServerAddedNode(QSharedPointer<ReceivedMessage> message) {
@@ -880,7 +917,9 @@ void NodeList::processDomainServerRemovedNode(QSharedPointer<ReceivedMessage> me
     // read the UUID from the packet, remove it if it exists
     QUuid nodeUUID = QUuid::fromRfc4122(message->readWithoutCopy(NUM_BYTES_RFC4122_UUID));
     qCDebug(networking) << "Received packet from domain-server to remove node with UUID" << uuidStringWithoutCurlyBraces(nodeUUID);
+    _isApplyingDomainList = true;
     killNodeWithUUID(nodeUUID);
+    _isApplyingDomainList = false;
     removeDelayedAdd(nodeUUID);
 }
 
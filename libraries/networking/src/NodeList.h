@@ -34,6 +34,7 @@
 #include <SettingHandle.h>
 
 #include "DomainHandler.h"
+#include "DomainListVersions.h"
 #include "LimitedNodeList.h"
 #include "Node.h"
 
@@ -196,6 +197,9 @@ private:
     std::atomic<float> _avatarGain { 0.0f };    // in dB
     std::atomic<float> _injectorGain { 0.0f };  // in dB
 
+    DomainListTracker _domainListTracker;
+    bool _isApplyingDomainList { false }; // nodes killed meanwhile were removed by the domain-server
+
     void sendIgnoreRadiusStateToNode(const SharedNodePointer& destinationNode);
 #if defined(Q_OS_ANDROID)
     Setting::Handle<bool> _ignoreRadiusEnabled { "IgnoreRadiusEnabled", false };
@@ -0,0 +1,178 @@
+//
+//  PacketInbox.cpp
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketInbox.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include <QtCore/QMetaEnum>
+
+#include <PortableHighResolutionClock.h>
+
+const std::array<quint64, PacketInbox::NUM_LATENCY_BUCKETS - 1> PacketInbox::LATENCY_BUCKET_USECS {
+    { 100, 250, 500, 1000, 2500, 5000, 10000, 25000 }
+};
+
+static size_t roundUpToPowerOfTwo(int value) {
+    size_t powerOfTwo = 1;
+    while (powerOfTwo < (size_t)value) {
+        powerOfTwo <<= 1;
+    }
+    return powerOfTwo;
+}
+
+// The ring buffer is Dmitry Vyukov's bounded queue: the sequence of a slot tells the pushing threads whether it is free
+// on their turn of the ring, and the listener's thread whether it holds a message yet, so that neither has to lock.
+PacketInbox::PacketInbox(int capacity) :
+    _slots(new Slot[roundUpToPowerOfTwo(capacity)]),
+    _mask(roundUpToPowerOfTwo(capacity) - 1)
+{
+    for (size_t i = 0; i <= _mask; ++i) {
+        _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+void PacketInbox::push(const PacketReceiver::ListenerReferencePointer& listener,
+                       const QSharedPointer<ReceivedMessage>& message, const SharedNodePointer& sourceNode) {
+    if (!_isOverflowing.load(std::memory_order_acquire) && tryPush(listener, message, sourceNode)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_overflowMutex);
+    _isOverflowing.store(true, std::memory_order_release);
+    _overflow.push_back({ listener, message, sourceNode });
+    ++_numOverflows;
+}
+
+bool PacketInbox::tryPush(const PacketReceiver::ListenerReferencePointer& listener,
+                          const QSharedPointer<ReceivedMessage>& message, const SharedNodePointer& sourceNode) {
+    Slot* slot;
+    size_t position = _pushPosition.load(std::memory_order_relaxed);
+    while (true) {
+        slot = &_slots[position & _mask];
+        size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto difference = (intptr_t)sequence - (intptr_t)position;
+
+        if (difference == 0) {
+            // the slot is free on this turn, take it unless another thread took it first
+            if (_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // the slot still holds the message of the previous turn, the inbox is full
+            return false;
+        } else {
+            position = _pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->listener = listener;
+    slot->message = message;
+    slot->sourceNode = sourceNode;
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+int PacketInbox::drain() {
+    int numDelivered = 0;
+
+    while (true) {
+        Slot& slot = _slots[_drainPosition & _mask];
+        if (slot.sequence.load(std::memory_order_acquire) != _drainPosition + 1) {
+            // empty, or the next message is still being pushed
+            break;
+        }
+
+        Entry entry { std::move(slot.listener), std::move(slot.message), std::move(slot.sourceNode) };
+
+        // free the slot for the next turn of the ring
+        slot.sequence.store(_drainPosition + _mask + 1, std::memory_order_release);
+        ++_drainPosition;
+
+        deliver(entry);
+        ++numDelivered;
+    }
+
+    // the overflow came in after everything in the ring, and before anything pushed to the ring once it is taken
+    if (_isOverflowing.load(std::memory_order_acquire)) {
+        std::deque<Entry> overflow;
+        {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            overflow.swap(_overflow);
+            _isOverflowing.store(false, std::memory_order_release);
+        }
+
+        for (const auto& entry : overflow) {
+            deliver(entry);
+            ++numDelivered;
+        }
+    }
+
+    return numDelivered;
+}
+
+void PacketInbox::deliver(const Entry& entry) {
+    auto receiveTime = (quint64)entry.message->getFirstPacketReceiveTime();
+    if (receiveTime > 0) {
+        auto now = (quint64)std::chrono::duration_cast<std::chrono::microseconds>(
+            p_high_resolution_clock::now().time_since_epoch()).count();
+        recordLatency(entry.message->getType(), now > receiveTime ? now - receiveTime : 0);
+    }
+
+    entry.listener->invokeDirectly(entry.message, entry.sourceNode);
+}
+
+void PacketInbox::recordLatency(PacketType type, quint64 latencyUsecs) {
+    auto& stats = _typeStats[(uint8_t)type];
+    ++stats.numMessages;
+    stats.totalLatencyUsecs += latencyUsecs;
+    stats.maxLatencyUsecs = std::max(stats.maxLatencyUsecs, latencyUsecs);
+
+    auto bucket = std::upper_bound(LATENCY_BUCKET_USECS.begin(), LATENCY_BUCKET_USECS.end(), latencyUsecs);
+    ++stats.latencyBuckets[bucket - LATENCY_BUCKET_USECS.begin()];
+}
+
+QJsonObject PacketInbox::sampleStats() {
+    QJsonObject statsObject;
+    statsObject["overflows"] = (qint64)_numOverflows.exchange(0);
+
+    QMetaObject metaObject = PacketTypeEnum::staticMetaObject;
+    QMetaEnum metaEnum = metaObject.enumerator(metaObject.enumeratorOffset());
+
+    QJsonObject typesObject;
+    for (auto& typeStats : _typeStats) {
+        auto& stats = typeStats.second;
+        if (stats.numMessages == 0) {
+            continue;
+        }
+
+        QJsonObject typeObject;
+        typeObject["messages"] = (qint64)stats.numMessages;
+        typeObject["avg_latency_us"] = (qint64)(stats.totalLatencyUsecs / stats.numMessages);
+        typeObject["max_latency_us"] = (qint64)stats.maxLatencyUsecs;
+
+        QJsonObject histogramObject;
+        for (int i = 0; i < NUM_LATENCY_BUCKETS; ++i) {
+            // name the buckets so that they sort in order
+            QString bucketName = i < NUM_LATENCY_BUCKETS - 1
+                ? QString("%1_under_%2_us").arg(i).arg(LATENCY_BUCKET_USECS[i])
+                : QString("%1_over_%2_us").arg(i).arg(LATENCY_BUCKET_USECS[i - 1]);
+            histogramObject[bucketName] = (qint64)stats.latencyBuckets[i];
+        }
+        typeObject["latency_histogram"] = histogramObject;
+
+        typesObject[metaEnum.valueToKey(typeStats.first)] = typeObject;
+        stats = TypeStats();
+    }
+    statsObject["types"] = typesObject;
+
+    return statsObject;
+}
@@ -0,0 +1,101 @@
+//
+//  PacketInbox.h
+//  libraries/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_PacketInbox_h
+#define hifi_PacketInbox_h
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QSharedPointer>
+
+#include "Node.h"
+#include "PacketReceiver.h"
+#include "ReceivedMessage.h"
+
+// Messages for a listener that runs a loop of its own, handed over without going through the Qt event queue of its
+// thread. The PacketReceiver pushes the messages in a lock-free ring buffer, and the listener's thread calls the
+// listeners of the messages when it drains the inbox, for instance at the start of each frame of a mixer.
+// Register the listeners with PacketReceiver::registerInboxListenerForTypes.
+//
+// When the ring is full, messages go to an overflow queue behind a mutex, and keep going there until the next drain
+// has delivered it, so that a message never overtakes one that was pushed before it.
+class PacketInbox {
+public:
+    PacketInbox(int capacity = DEFAULT_CAPACITY);
+    PacketInbox(const PacketInbox&) = delete;
+    PacketInbox& operator=(const PacketInbox&) = delete;
+
+    // Can be called from any thread.
+    void push(const PacketReceiver::ListenerReferencePointer& listener, const QSharedPointer<ReceivedMessage>& message,
+              const SharedNodePointer& sourceNode);
+
+    // Called from the listener's thread, calls the listener of each message in the order they came in.
+    // Returns the number of messages delivered.
+    int drain();
+
+    // Called from the listener's thread. Returns, for each packet type, the number of messages delivered and a
+    // histogram of the time between their receipt and their delivery, since the previous call.
+    QJsonObject sampleStats();
+
+private:
+    static const int DEFAULT_CAPACITY = 4096;
+
+    struct Slot {
+        std::atomic<size_t> sequence { 0 }; // tells whether the slot holds a message and from which turn of the ring
+        PacketReceiver::ListenerReferencePointer listener;
+        QSharedPointer<ReceivedMessage> message;
+        SharedNodePointer sourceNode;
+    };
+
+    // upper bounds of the latency buckets, the last bucket takes the rest
+    static const int NUM_LATENCY_BUCKETS = 9;
+    static const std::array<quint64, NUM_LATENCY_BUCKETS - 1> LATENCY_BUCKET_USECS;
+
+    struct TypeStats {
+        quint64 numMessages { 0 };
+        quint64 totalLatencyUsecs { 0 };
+        quint64 maxLatencyUsecs { 0 };
+        std::array<quint64, NUM_LATENCY_BUCKETS> latencyBuckets {};
+    };
+
+    struct Entry {
+        PacketReceiver::ListenerReferencePointer listener;
+        QSharedPointer<ReceivedMessage> message;
+        SharedNodePointer sourceNode;
+    };
+
+    bool tryPush(const PacketReceiver::ListenerReferencePointer& listener, const QSharedPointer<ReceivedMessage>& message,
+                 const SharedNodePointer& sourceNode);
+    void deliver(const Entry& entry);
+    void recordLatency(PacketType type, quint64 latencyUsecs);
+
+    std::unique_ptr<Slot[]> _slots;
+    const size_t _mask;
+
+    std::atomic<size_t> _pushPosition { 0 }; // shared by the pushing threads
+    size_t _drainPosition { 0 }; // only used by the listener's thread
+
+    std::mutex _overflowMutex;
+    std::deque<Entry> _overflow; // guarded by _overflowMutex
+    std::atomic<bool> _isOverflowing { false }; // set while _overflow has messages the ring must not overtake
+
+    std::atomic<quint64> _numOverflows { 0 };
+    std::unordered_map<uint8_t, TypeStats> _typeStats; // only used by the listener's thread
+};
+
+#endif // hifi_PacketInbox_h
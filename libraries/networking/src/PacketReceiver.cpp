@@ -19,6 +19,7 @@
 #include "DependencyManager.h"
 #include "NetworkLogging.h"
 #include "NodeList.h"
+#include "PacketInbox.h"
 #include "SharedUtil.h"
 
 PacketReceiver::PacketReceiver(QObject* parent) : QObject(parent) {
@@ -45,6 +46,24 @@ bool PacketReceiver::registerListenerForTypes(PacketTypeList types, const Listen
     return true;
 }
 
+bool PacketReceiver::registerInboxListenerForTypes(PacketTypeList types, const ListenerReferencePointer& listener,
+                                                   const std::shared_ptr<PacketInbox>& inbox) {
+    Q_ASSERT_X(!types.empty(), "PacketReceiver::registerInboxListenerForTypes", "No types to register");
+    Q_ASSERT_X(listener, "PacketReceiver::registerInboxListenerForTypes", "No listener to register");
+    Q_ASSERT_X(inbox, "PacketReceiver::registerInboxListenerForTypes", "No inbox to deliver to");
+
+    bool success = true;
+    for (auto type : types) {
+        if (matchingMethodForListener(type, listener)) {
+            registerVerifiedListener(type, listener, false, inbox);
+        } else {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
 void PacketReceiver::registerDirectListener(PacketType type, const ListenerReferencePointer& listener) {
     Q_ASSERT_X(listener, "PacketReceiver::registerDirectListener", "No listener to register");
     
@@ -100,7 +119,8 @@ bool PacketReceiver::matchingMethodForListener(PacketType type, const ListenerRe
     return true;
 }
 
-void PacketReceiver::registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending) {
+void PacketReceiver::registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending,
+                                              const std::shared_ptr<PacketInbox>& inbox) {
     Q_ASSERT_X(listener, "PacketReceiver::registerVerifiedListener", "No listener to register");
     QMutexLocker locker(&_packetListenerLock);
 
@@ -110,7 +130,7 @@ void PacketReceiver::registerVerifiedListener(PacketType type, const ListenerRef
     }
     
     // add the mapping
-    _messageListenerMap[type] = { listener, deliverPending };
+    _messageListenerMap[type] = { listener, deliverPending, inbox };
 }
 
 void PacketReceiver::unregisterListener(QObject* listener) {
@@ -215,6 +235,9 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
         if (listener.listener->getObject()) {
             if (isDirectConnect) {
                 success = listener.listener->invokeDirectly(receivedMessage, matchingNode);
+            } else if (listener.inbox) {
+                listener.inbox->push(listener.listener, receivedMessage, matchingNode);
+                success = true;
             } else {
                 success = listener.listener->invokeWithQt(receivedMessage, matchingNode);
             }
@@ -239,6 +262,6 @@ void PacketReceiver::handleVerifiedMessage(QSharedPointer<ReceivedMessage> recei
         qCWarning(networking) << "No listener found for packet type" << receivedMessage->getType();
         
         // insert a dummy listener so we don't print this again
-        _messageListenerMap.insert(receivedMessage->getType(), { ListenerReferencePointer(), false });
+        _messageListenerMap.insert(receivedMessage->getType(), { ListenerReferencePointer(), false, nullptr });
     }
 }
@@ -14,6 +14,7 @@
 #ifndef hifi_PacketReceiver_h
 #define hifi_PacketReceiver_h
 
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -32,6 +33,7 @@
 class EntityEditPacketSender;
 class Node;
 class OctreePacketProcessor;
+class PacketInbox;
 
 namespace std {
     template <>
@@ -75,6 +77,10 @@ public:
     // for the message is received.
     bool registerListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending = false);
     bool registerListenerForTypes(PacketTypeList types, const ListenerReferencePointer& listener);
+    // Messages of these types are pushed in the inbox instead of being posted to the thread of the listener,
+    // which calls the listener when it drains the inbox.
+    bool registerInboxListenerForTypes(PacketTypeList types, const ListenerReferencePointer& listener,
+                                       const std::shared_ptr<PacketInbox>& inbox);
     void unregisterListener(QObject* listener);
     
     void handleVerifiedPacket(std::unique_ptr<udt::Packet> packet);
@@ -111,6 +117,7 @@ private:
     struct Listener {
         ListenerReferencePointer listener;
         bool deliverPending;
+        std::shared_ptr<PacketInbox> inbox;
     };
 
     void handleVerifiedMessage(QSharedPointer<ReceivedMessage> message, bool justReceived);
@@ -121,7 +128,8 @@ private:
     void registerDirectListener(PacketType type, const ListenerReferencePointer& listener);
 
     bool matchingMethodForListener(PacketType type, const ListenerReferencePointer& listener) const;
-    void registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending = false);
+    void registerVerifiedListener(PacketType type, const ListenerReferencePointer& listener, bool deliverPending = false,
+                                  const std::shared_ptr<PacketInbox>& inbox = nullptr);
 
     QMutex _packetListenerLock;
     QHash<PacketType, Listener> _messageListenerMap;
@@ -22,6 +22,7 @@
 
 #include <platform/Platform.h>
 #include "NetworkLogging.h"
+#include "udt/PacketBufferPool.h"
 
 ThreadedAssignment::ThreadedAssignment(ReceivedMessage& message) :
     Assignment(message),
@@ -119,6 +120,18 @@ void ThreadedAssignment::addPacketStatsAndSendStatsPacket(QJsonObject statsObjec
     ioStats["outbound_kbps"] = nodeList->getOutboundKbps();
     ioStats["outbound_pps"] = nodeList->getOutboundPPS();
 
+    auto socketStats = nodeList->sampleSocketIOStats();
+    ioStats["receive_batches"] = (double)socketStats.receiveBatches;
+    ioStats["avg_receive_batch_size"] = socketStats.receiveBatches > 0 ?
+        (double)socketStats.datagramsReceivedInBatches / socketStats.receiveBatches : 0.0;
+    ioStats["send_batches"] = (double)socketStats.sendBatches;
+    ioStats["avg_send_batch_size"] = socketStats.sendBatches > 0 ?
+        (double)socketStats.datagramsSentInBatches / socketStats.sendBatches : 0.0;
+
+    auto poolStats = udt::PacketBufferPool::getInstance().sampleStats();
+    auto poolRequests = poolStats.hits + poolStats.misses;
+    ioStats["packet_pool_hit_rate"] = poolRequests > 0 ? (double)poolStats.hits / poolRequests : 0.0;
+
     statsObject["io_stats"] = ioStats;
 
     QJsonObject assignmentStats;
@@ -13,6 +13,7 @@
 #include "BasePacket.h"
 
 #include "../NetworkLogging.h"
+#include "PacketBufferPool.h"
 
 using namespace udt;
 
@@ -61,7 +62,8 @@ BasePacket::BasePacket(qint64 size) {
     Q_ASSERT(size >= 0 && size <= maxPayload);
     
     _packetSize = size;
-    _packet.reset(new char[_packetSize]());
+    allocateData();
+    memset(_packet.get(), 0, _packetSize);
     _payloadCapacity = _packetSize;
     _payloadSize = 0;
     _payloadStart = _packet.get();
@@ -78,9 +80,31 @@ BasePacket::BasePacket(std::unique_ptr<char[]> data, qint64 size, const SockAddr
     
 }
 
+BasePacket::~BasePacket() {
+    releaseData();
+}
+
+void BasePacket::allocateData() {
+    releaseData();
+    if (_packetSize <= PacketBufferPool::BUFFER_SIZE) {
+        _packet = PacketBufferPool::getInstance().take();
+        _hasPooledData = true;
+    } else {
+        _packet.reset(new char[_packetSize]);
+    }
+}
+
+void BasePacket::releaseData() {
+    if (_hasPooledData) {
+        PacketBufferPool::getInstance().recycle(std::move(_packet));
+        _hasPooledData = false;
+    }
+    _packet.reset();
+}
+
 BasePacket& BasePacket::operator=(const BasePacket& other) {
     _packetSize = other._packetSize;
-    _packet = std::unique_ptr<char[]>(new char[_packetSize]);
+    allocateData();
     memcpy(_packet.get(), other._packet.get(), _packetSize);
     
     _payloadStart = _packet.get() + (other._payloadStart - other._packet.get());
@@ -104,8 +128,11 @@ BasePacket::BasePacket(BasePacket&& other) {
 }
 
 BasePacket& BasePacket::operator=(BasePacket&& other) {
+    releaseData();
     _packetSize = other._packetSize;
     _packet = std::move(other._packet);
+    _hasPooledData = other._hasPooledData;
+    other._hasPooledData = false;
     
     _payloadStart = other._payloadStart;
     _payloadCapacity = other._payloadCapacity;
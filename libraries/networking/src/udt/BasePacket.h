@@ -85,6 +85,11 @@ public:
 
     void setReceiveTime(p_high_resolution_clock::time_point receiveTime) { _receiveTime = receiveTime; }
     p_high_resolution_clock::time_point getReceiveTime() const { return _receiveTime; }
+
+    // For received packets whose data was taken from the PacketBufferPool, gives the data back to it with the packet
+    void setDataIsPooled() { _hasPooledData = true; }
+
+    virtual ~BasePacket();
     
 protected:
     BasePacket(qint64 size);
@@ -99,9 +104,14 @@ protected:
     virtual qint64 readData(char* data, qint64 maxSize) override;
     
     void adjustPayloadStartAndCapacity(qint64 headerSize, bool shouldDecreasePayloadSize = false);
+
+    // allocates _packetSize bytes of packet data, from the PacketBufferPool when they fit in its buffers
+    void allocateData();
+    void releaseData();
     
     qint64 _packetSize = 0;        // Total size of the allocated memory
     std::unique_ptr<char[]> _packet; // Allocated memory
+    bool _hasPooledData { false };   // whether _packet goes back to the PacketBufferPool
     
     char* _payloadStart = nullptr; // Start of the payload
     qint64 _payloadCapacity = 0;          // Total capacity of the payload
@@ -14,7 +14,6 @@
 
 #include <random>
 
-#include <QtCore/QThread>
 
 #include <NumericalConstants.h>
 
@@ -68,21 +67,15 @@ Connection::~Connection() {
 }
 
 void Connection::stopSendQueue() {
-    if (auto sendQueue = _sendQueue.release()) {
-        // grab the send queue thread so we can wait on it
-        QThread* sendQueueThread = sendQueue->thread();
-        
+    if (_sendQueue) {
         // tell the send queue to stop and be deleted
         
-        sendQueue->stop();
+        _sendQueue->stop();
 
-        _lastMessageNumber = sendQueue->getCurrentMessageNumber();
+        _lastMessageNumber = _sendQueue->getCurrentMessageNumber();
 
-        sendQueue->deleteLater();
-        
-        // wait on the send queue thread so we know the send queue is gone
-        sendQueueThread->quit();
-        sendQueueThread->wait();
+        // its destructor waits for the scheduler to be done with it, so we know the send queue is gone
+        _sendQueue.reset();
     }
 }
 
@@ -115,7 +108,8 @@ SendQueue& Connection::getSendQueue() {
         QObject::connect(_sendQueue.get(), &SendQueue::packetRetransmitted, this, &Connection::recordRetransmission);
         QObject::connect(_sendQueue.get(), &SendQueue::queueInactive, this, &Connection::queueInactive);
         QObject::connect(_sendQueue.get(), &SendQueue::timeout, this, &Connection::queueTimeout);
-        QObject::connect(this, &Connection::destinationAddressChange, _sendQueue.get(), &SendQueue::updateDestinationAddress);
+        QObject::connect(this, &Connection::destinationAddressChange, _sendQueue.get(), &SendQueue::updateDestinationAddress,
+                         Qt::DirectConnection);
 
         
         // set defaults on the send queue from our congestion control object and estimatedTimeout()
@@ -0,0 +1,109 @@
+//
+//  MPSCQueue.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_MPSCQueue_h
+#define hifi_MPSCQueue_h
+
+#include <atomic>
+
+namespace udt {
+
+// Link of an object in an MPSCQueue, objects that can be queued derive from it.
+class MPSCQueueNode {
+public:
+    MPSCQueueNode() = default;
+
+    // a copy is not in the queue of the original
+    MPSCQueueNode(const MPSCQueueNode&) { }
+    MPSCQueueNode& operator=(const MPSCQueueNode&) { return *this; }
+
+private:
+    template <typename T> friend class MPSCQueue;
+
+    std::atomic<MPSCQueueNode*> _nextInQueue { nullptr };
+};
+
+// An intrusive lock-free multi-producer single-consumer FIFO queue, after Dmitry Vyukov's.
+// Any number of threads can push at once without ever waiting on each other, only one thread at a time may pop.
+// The queue doesn't own what is in it.
+template <typename T>
+class MPSCQueue {
+public:
+    MPSCQueue() : _head(&_stub), _tail(&_stub) { }
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    // can be called from any thread
+    void push(T* object) { pushNode(object); }
+
+    // Returns the oldest object, nullptr when the queue is empty.
+    // Also returns nullptr for the short while a producer is in the middle of pushing onto an otherwise empty queue,
+    // the object is popped once the push is done.
+    T* pop() {
+        MPSCQueueNode* tail = _tail;
+        MPSCQueueNode* next = tail->_nextInQueue.load(std::memory_order_acquire);
+
+        if (tail == &_stub) {
+            if (!next) {
+                return nullptr;
+            }
+            // skip the stub
+            _tail = next;
+            tail = next;
+            next = next->_nextInQueue.load(std::memory_order_acquire);
+        }
+
+        if (next) {
+            _tail = next;
+            return static_cast<T*>(tail);
+        }
+
+        if (tail != _head.load(std::memory_order_acquire)) {
+            // a producer has taken the head but hasn't linked it yet
+            return nullptr;
+        }
+
+        // the tail is the last object, put the stub back behind it so that it can be unlinked
+        pushNode(&_stub);
+
+        next = tail->_nextInQueue.load(std::memory_order_acquire);
+        if (next) {
+            _tail = next;
+            return static_cast<T*>(tail);
+        }
+        return nullptr;
+    }
+
+    // only exact on the consumer thread, a push in progress counts as an object
+    bool isEmpty() const {
+        return _tail == &_stub && _head.load(std::memory_order_acquire) == &_stub;
+    }
+
+private:
+    void pushNode(MPSCQueueNode* node) {
+        node->_nextInQueue.store(nullptr, std::memory_order_relaxed);
+        MPSCQueueNode* previous = _head.exchange(node, std::memory_order_acq_rel);
+        previous->_nextInQueue.store(node, std::memory_order_release);
+    }
+
+    static const int CACHE_LINE_SIZE = 64;
+
+    std::atomic<MPSCQueueNode*> _head; // last pushed, written by the producers
+    // keep the producers from invalidating the cache line of the consumer on every push
+    char _headPadding[CACHE_LINE_SIZE - sizeof(std::atomic<MPSCQueueNode*>)];
+    MPSCQueueNode* _tail; // next to pop, only used by the consumer
+    MPSCQueueNode _stub;
+};
+
+} // namespace udt
+
+#endif // hifi_MPSCQueue_h
@@ -8,6 +8,14 @@
 
 #include "NetworkSocket.h"
 
+#include <algorithm>
+#include <cstring>
+
+#if defined(Q_OS_LINUX)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#endif
+
 #include "../NetworkLogging.h"
 
 
@@ -222,6 +230,77 @@ qint64 NetworkSocket::readDatagram(char* data, qint64 maxSize, SockAddr* sockAdd
 #endif
 }
 
+#if defined(Q_OS_LINUX)
+int NetworkSocket::readUDPDatagrams(char* const* buffers, qint64 bufferSize, int count, qint64* sizes,
+                                    SockAddr* sockAddrs) {
+    auto sd = _udpSocket.socketDescriptor();
+    if (sd == -1 || count <= 0) {
+        return 0;
+    }
+    count = std::min(count, MAX_DATAGRAM_BATCH);
+
+    mmsghdr messages[MAX_DATAGRAM_BATCH];
+    iovec vectors[MAX_DATAGRAM_BATCH];
+    sockaddr_storage addresses[MAX_DATAGRAM_BATCH];
+    memset(messages, 0, count * sizeof(mmsghdr));
+    for (int i = 0; i < count; ++i) {
+        vectors[i].iov_base = buffers[i];
+        vectors[i].iov_len = bufferSize;
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_hdr.msg_name = &addresses[i];
+        messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    }
+
+    int numRead = recvmmsg(sd, messages, count, MSG_DONTWAIT, nullptr);
+    if (numRead <= 0) {
+        return 0;
+    }
+
+    for (int i = 0; i < numRead; ++i) {
+        bool isTruncated = messages[i].msg_hdr.msg_flags & MSG_TRUNC;
+        sizes[i] = isTruncated ? -1 : (qint64)messages[i].msg_len;
+
+        auto address = reinterpret_cast<const sockaddr*>(&addresses[i]);
+        sockAddrs[i].setType(SocketType::UDP);
+        *sockAddrs[i].getAddressPointer() = QHostAddress(address);
+        if (address->sa_family == AF_INET) {
+            *sockAddrs[i].getPortPointer() = ntohs(reinterpret_cast<const sockaddr_in*>(address)->sin_port);
+        } else if (address->sa_family == AF_INET6) {
+            *sockAddrs[i].getPortPointer() = ntohs(reinterpret_cast<const sockaddr_in6*>(address)->sin6_port);
+        }
+    }
+    return numRead;
+}
+
+int NetworkSocket::writeUDPDatagrams(const QByteArray* datagrams, int count, const SockAddr& sockAddr) {
+    auto sd = _udpSocket.socketDescriptor();
+    if (sd == -1 || count <= 0 || count > MAX_DATAGRAM_BATCH
+        || sockAddr.getAddress().protocol() != QAbstractSocket::IPv4Protocol) {
+        return -1;
+    }
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(sockAddr.getPort());
+    address.sin_addr.s_addr = htonl(sockAddr.getAddress().toIPv4Address());
+
+    mmsghdr messages[MAX_DATAGRAM_BATCH];
+    iovec vectors[MAX_DATAGRAM_BATCH];
+    memset(messages, 0, count * sizeof(mmsghdr));
+    for (int i = 0; i < count; ++i) {
+        vectors[i].iov_base = const_cast<char*>(datagrams[i].constData());
+        vectors[i].iov_len = datagrams[i].size();
+        messages[i].msg_hdr.msg_iov = &vectors[i];
+        messages[i].msg_hdr.msg_iovlen = 1;
+        messages[i].msg_hdr.msg_name = &address;
+        messages[i].msg_hdr.msg_namelen = sizeof(address);
+    }
+
+    return sendmmsg(sd, messages, count, 0);
+}
+#endif
 
 QAbstractSocket::SocketState NetworkSocket::state(SocketType socketType) const {
     switch (socketType) {
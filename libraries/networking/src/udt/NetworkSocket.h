@@ -102,6 +102,28 @@ public:
     /// @return The number of bytes if successfully read, otherwise <code>-1</code>.
     qint64 readDatagram(char* data, qint64 maxSize, SockAddr* sockAddr = nullptr);
 
+#if defined(Q_OS_LINUX)
+    /// @brief The most datagrams read or written by one call of readUDPDatagrams or writeUDPDatagrams.
+    static const int MAX_DATAGRAM_BATCH = 32;
+
+    /// @brief Reads pending UDP datagrams with a single system call.
+    /// @details Datagrams that don't fit in their buffer are dropped, their size is returned as <code>-1</code>.
+    /// @param buffers The buffers to read the datagrams into, each <code>bufferSize</code> bytes.
+    /// @param bufferSize The size of each buffer.
+    /// @param count The most datagrams to read, at most <code>MAX_DATAGRAM_BATCH</code>.
+    /// @param sizes The destination to write the size of each datagram read into.
+    /// @param sockAddrs The destination to write the source network address of each datagram read into.
+    /// @return The number of datagrams read, <code>0</code> if none were pending or the socket could not be read.
+    int readUDPDatagrams(char* const* buffers, qint64 bufferSize, int count, qint64* sizes, SockAddr* sockAddrs);
+
+    /// @brief Sends UDP datagrams to an IPv4 address with a single system call.
+    /// @param datagrams The datagrams to send.
+    /// @param count The number of datagrams, at most <code>MAX_DATAGRAM_BATCH</code>.
+    /// @param sockAddr The address to send to.
+    /// @return The number of datagrams sent, <code>-1</code> if none could be sent this way.
+    int writeUDPDatagrams(const QByteArray* datagrams, int count, const SockAddr& sockAddr);
+#endif
+
     
     /// @brief Gets the state of the UDP or WebRTC socket.
     /// @param socketType The type of socket for which to get the state.
@@ -115,7 +115,7 @@ Packet::Packet(std::unique_ptr<char[]> data, qint64 size, const SockAddr& sender
     }
 }
 
-Packet::Packet(const Packet& other) : BasePacket(other) {
+Packet::Packet(const Packet& other) : BasePacket(other), MPSCQueueNode() {
     copyMembers(other);
 }
 
@@ -18,12 +18,14 @@
 #include <QtCore/QIODevice>
 
 #include "BasePacket.h"
+#include "MPSCQueue.h"
 #include "PacketHeaders.h"
 #include "SequenceNumber.h"
 
 namespace udt {
 
-class Packet : public BasePacket {
+// Packets derive from MPSCQueueNode so that the PacketQueue of a connection can queue them without allocating
+class Packet : public BasePacket, public MPSCQueueNode {
     Q_OBJECT
 public:
     //                         Packet Header Format
@@ -0,0 +1,53 @@
+//
+//  PacketBufferPool.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "PacketBufferPool.h"
+
+using namespace udt;
+
+// enough for the bursts of a busy mixer, about 6 MB when full
+static const size_t MAX_POOLED_BUFFERS = 4096;
+
+PacketBufferPool& PacketBufferPool::getInstance() {
+    // never destroyed, packets are still being destroyed while static objects are
+    static PacketBufferPool* instance = new PacketBufferPool();
+    return *instance;
+}
+
+std::unique_ptr<char[]> PacketBufferPool::take() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_buffers.empty()) {
+            char* buffer = _buffers.back();
+            _buffers.pop_back();
+            ++_hits;
+            return std::unique_ptr<char[]>(buffer);
+        }
+    }
+    ++_misses;
+    return std::unique_ptr<char[]>(new char[BUFFER_SIZE]);
+}
+
+void PacketBufferPool::recycle(std::unique_ptr<char[]> buffer) {
+    if (!buffer) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_buffers.size() < MAX_POOLED_BUFFERS) {
+        _buffers.push_back(buffer.release());
+    }
+}
+
+PacketBufferPool::Stats PacketBufferPool::sampleStats() {
+    Stats stats;
+    stats.hits = _hits.exchange(0);
+    stats.misses = _misses.exchange(0);
+    return stats;
+}
@@ -0,0 +1,59 @@
+//
+//  PacketBufferPool.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_PacketBufferPool_h
+#define hifi_PacketBufferPool_h
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <QtCore/QtGlobal>
+
+#include "Constants.h"
+
+namespace udt {
+
+// Keeps the data buffers of destroyed packets to give to new ones, so that a busy server doesn't allocate and free a
+// buffer for every packet it receives or creates. All pooled buffers hold MAX_PACKET_SIZE bytes.
+// Buffers taken from the pool are ordinary heap arrays, dropping one instead of recycling it is safe.
+class PacketBufferPool {
+public:
+    static const qint64 BUFFER_SIZE = MAX_PACKET_SIZE;
+
+    struct Stats {
+        quint64 hits { 0 };     // buffers that were taken from the pool
+        quint64 misses { 0 };   // buffers that had to be allocated because the pool was empty
+    };
+
+    static PacketBufferPool& getInstance();
+
+    std::unique_ptr<char[]> take();
+    void recycle(std::unique_ptr<char[]> buffer);
+
+    // returns the counts since the previous call
+    Stats sampleStats();
+
+private:
+    PacketBufferPool() = default;
+
+    std::mutex _mutex;
+    std::vector<char*> _buffers;
+
+    std::atomic<quint64> _hits { 0 };
+    std::atomic<quint64> _misses { 0 };
+};
+
+} // namespace udt
+
+#endif // hifi_PacketBufferPool_h
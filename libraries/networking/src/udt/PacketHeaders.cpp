@@ -27,7 +27,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::DomainConnectRequestPending: // keeping the old version to maintain the protocol hash
             return 17;
         case PacketType::DomainList:
-            return static_cast<PacketVersion>(DomainListVersion::SocketTypes);
+            return static_cast<PacketVersion>(DomainListVersion::ListDeltas);
         case PacketType::EntityAdd:
         case PacketType::EntityClone:
         case PacketType::EntityEdit:
@@ -74,7 +74,7 @@ PacketVersion versionForPacketType(PacketType packetType) {
         case PacketType::DomainConnectRequest:
             return static_cast<PacketVersion>(DomainConnectRequestVersion::SocketTypes);
         case PacketType::DomainListRequest:
-            return static_cast<PacketVersion>(DomainListRequestVersion::SocketTypes);
+            return static_cast<PacketVersion>(DomainListRequestVersion::ListDeltas);
 
         case PacketType::DomainServerAddedNode:
             return static_cast<PacketVersion>(DomainServerAddedNodeVersion::SocketTypes);
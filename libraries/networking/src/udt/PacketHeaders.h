@@ -140,6 +140,8 @@ public:
         StopInjector,
         AvatarZonePresence,
         WebRTCSignaling,
+        OctreeDataPersistJournal,
+        OctreeDataPersistJournalRejected,
         NUM_PACKET_TYPE
     };
 
@@ -191,7 +193,8 @@ public:
             << PacketTypeEnum::Value::ReplicatedMicrophoneAudioWithEcho << PacketTypeEnum::Value::ReplicatedInjectAudio
             << PacketTypeEnum::Value::ReplicatedSilentAudioFrame << PacketTypeEnum::Value::ReplicatedAvatarIdentity
             << PacketTypeEnum::Value::ReplicatedKillAvatar << PacketTypeEnum::Value::ReplicatedBulkAvatarData
-            << PacketTypeEnum::Value::AvatarZonePresence << PacketTypeEnum::Value::WebRTCSignaling;
+            << PacketTypeEnum::Value::AvatarZonePresence << PacketTypeEnum::Value::WebRTCSignaling
+            << PacketTypeEnum::Value::OctreeDataPersistJournal << PacketTypeEnum::Value::OctreeDataPersistJournalRejected;
         return NON_SOURCED_PACKETS;
     }
 
@@ -374,7 +377,8 @@ enum class DomainConnectRequestVersion : PacketVersion {
 
 enum class DomainListRequestVersion : PacketVersion {
     PreSocketTypes = 22,
-    SocketTypes
+    SocketTypes,
+    ListDeltas
 };
 
 enum class DomainConnectionDeniedVersion : PacketVersion {
@@ -397,7 +401,8 @@ enum class DomainListVersion : PacketVersion {
     AuthenticationOptional,
     HasTimestamp,
     HasConnectReason,
-    SocketTypes
+    SocketTypes,
+    ListDeltas
 };
 
 enum class AudioVersion : PacketVersion {
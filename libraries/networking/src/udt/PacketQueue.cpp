@@ -16,52 +16,71 @@
 using namespace udt;
 
 PacketQueue::PacketQueue(MessageNumber messageNumber) : _currentMessageNumber(messageNumber) {
-    _channels.emplace_front(new std::list<PacketPointer>());
-    _currentChannel = _channels.begin();
+    _currentChannel = _channels.end();
+}
+
+PacketQueue::~PacketQueue() {
+    // the queue owns the packets and packet lists it holds
+    while (auto packet = _mainChannel.pop()) {
+        delete packet;
+    }
+    while (auto channel = _newChannels.pop()) {
+        delete channel;
+    }
 }
 
 MessageNumber PacketQueue::getNextMessageNumber() {
     static const MessageNumber MAX_MESSAGE_NUMBER = MessageNumber(1) << MESSAGE_NUMBER_SIZE;
-    _currentMessageNumber = (_currentMessageNumber + 1) % MAX_MESSAGE_NUMBER;
-    return _currentMessageNumber;
+
+    // packet lists can be queued from several threads at once
+    MessageNumber currentMessageNumber = _currentMessageNumber;
+    MessageNumber nextMessageNumber;
+    do {
+        nextMessageNumber = (currentMessageNumber + 1) % MAX_MESSAGE_NUMBER;
+    } while (!_currentMessageNumber.compare_exchange_weak(currentMessageNumber, nextMessageNumber));
+
+    return nextMessageNumber;
 }
 
 bool PacketQueue::isEmpty() const {
-    LockGuard locker(_packetsLock);
-
-    // Only the main channel and it is empty
-    return _channels.size() == 1 && _channels.front()->empty();
+    return _mainChannel.isEmpty() && _newChannels.isEmpty() && _channels.empty();
 }
 
 PacketQueue::PacketPointer PacketQueue::takePacket() {
-    LockGuard locker(_packetsLock);
-
-    if (isEmpty()) {
-        return PacketPointer();
+    // pick up the packet lists queued since the last packet was taken
+    while (auto channel = _newChannels.pop()) {
+        _channels.emplace_back(channel);
     }
 
-    // handle the case where we are looking at the first channel and it is empty
-    if (_currentChannel == _channels.begin() && (*_currentChannel)->empty()) {
-        ++_currentChannel;
-    }
-
-    // at this point the current channel should always not be at the end and should also not be empty
-    Q_ASSERT(_currentChannel != _channels.end());
+    PacketPointer packet;
 
-    auto& channel = *_currentChannel;
+    if (_isAtMainChannel) {
+        packet = PacketPointer(_mainChannel.pop());
 
-    Q_ASSERT(!channel->empty());
-
-    // Take front packet
-    auto packet = std::move(channel->front());
-    channel->pop_front();
+        // the main channel takes its turn first, or is skipped if it is empty
+        _isAtMainChannel = false;
+        _currentChannel = _channels.begin();
+    }
 
-    // Remove now empty channel (Don't remove the main channel)
-    if (channel->empty() && _currentChannel != _channels.begin()) {
-        // erase the current channel and slide the iterator to the next channel
-        _currentChannel = _channels.erase(_currentChannel);
-    } else {
-        ++_currentChannel;
+    if (!packet) {
+        if (_currentChannel == _channels.end()) {
+            // nothing is queued, or a packet is being queued right now
+            _isAtMainChannel = true;
+            return PacketPointer();
+        }
+
+        // Take front packet
+        auto& channel = (*_currentChannel)->packets;
+        packet = std::move(channel.front());
+        channel.pop_front();
+
+        // Remove now empty channel (the main channel is never removed)
+        if (channel.empty()) {
+            // erase the current channel and slide the iterator to the next channel
+            _currentChannel = _channels.erase(_currentChannel);
+        } else {
+            ++_currentChannel;
+        }
     }
 
     // push forward our number of channels taken from
@@ -69,27 +88,30 @@ PacketQueue::PacketPointer PacketQueue::takePacket() {
 
     // check if we need to restart back at the front channel (main)
     // to respect our capped number of channels considered concurrently
-    static const int MAX_CHANNELS_SENT_CONCURRENTLY = 16;
+    static const unsigned int MAX_CHANNELS_SENT_CONCURRENTLY = 16;
 
     if (_currentChannel == _channels.end() || _channelsVisitedCount >= MAX_CHANNELS_SENT_CONCURRENTLY) {
         _channelsVisitedCount = 0;
-        _currentChannel = _channels.begin();
+        _isAtMainChannel = true;
     }
 
     return packet;
 }
 
 void PacketQueue::queuePacket(PacketPointer packet) {
-    LockGuard locker(_packetsLock);
-    _channels.front()->push_back(std::move(packet));
+    _mainChannel.push(packet.release());
 }
 
 void PacketQueue::queuePacketList(PacketListPointer packetList) {
+    if (packetList->_packets.empty()) {
+        return;
+    }
+
     if (packetList->isOrdered()) {
         packetList->preparePackets(getNextMessageNumber());
     }
 
-    LockGuard locker(_packetsLock);
-    _channels.emplace_back(new std::list<PacketPointer>());
-    _channels.back()->swap(packetList->_packets);
+    auto channel = new Channel();
+    channel->packets.swap(packetList->_packets);
+    _newChannels.push(channel);
 }
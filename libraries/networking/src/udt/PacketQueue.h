@@ -12,11 +12,11 @@
 #ifndef hifi_PacketQueue_h
 #define hifi_PacketQueue_h
 
+#include <atomic>
 #include <list>
-#include <vector>
 #include <memory>
-#include <mutex>
 
+#include "MPSCQueue.h"
 #include "Packet.h"
 
 namespace udt {
@@ -24,36 +24,44 @@ namespace udt {
 class PacketList;
     
 using MessageNumber = uint32_t;
-    
+
+// Packets waiting to be sent on a connection: the packets queued on their own go in the main channel, each packet list
+// in a channel of its own, and packets are taken from the channels in turn.
+// Any number of threads can queue packets at once without locking, only the thread sending them may take them.
 class PacketQueue {
-    using Mutex = std::recursive_mutex;
-    using LockGuard = std::lock_guard<Mutex>;
     using PacketPointer = std::unique_ptr<Packet>;
     using PacketListPointer = std::unique_ptr<PacketList>;
-    using RawChannel = std::list<PacketPointer>;
-    using Channel = std::unique_ptr<RawChannel>;
-    using Channels = std::list<Channel>;
+
+    struct Channel : public MPSCQueueNode {
+        std::list<PacketPointer> packets;
+    };
+    using ChannelPointer = std::unique_ptr<Channel>;
+    using Channels = std::list<ChannelPointer>;
     
 public:
     PacketQueue(MessageNumber messageNumber = 0);
+    ~PacketQueue();
+
     void queuePacket(PacketPointer packet);
     void queuePacketList(PacketListPointer packetList);
     
+    // only called by the sending thread
     bool isEmpty() const;
     PacketPointer takePacket();
-    
-    Mutex& getLock() { return _packetsLock; }
 
     MessageNumber getCurrentMessageNumber() const { return _currentMessageNumber; }
     
 private:
     MessageNumber getNextMessageNumber();
 
-    MessageNumber _currentMessageNumber { 0 };
+    std::atomic<MessageNumber> _currentMessageNumber { 0 };
     
-    mutable Mutex _packetsLock; // Protects the packets to be sent.
-    Channels _channels; // One channel per packet list + Main channel
+    MPSCQueue<Packet> _mainChannel; // Packets queued on their own
+    MPSCQueue<Channel> _newChannels; // Packet lists the sending thread hasn't picked up yet
 
+    // Only used by the sending thread
+    Channels _channels; // One channel per packet list
+    bool _isAtMainChannel { true };
     Channels::iterator _currentChannel;
     unsigned int _channelsVisitedCount { 0 };
 };
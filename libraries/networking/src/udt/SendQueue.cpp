@@ -13,12 +13,9 @@
 #include "SendQueue.h"
 
 #include <algorithm>
-#include <thread>
 
-#include <QtCore/QCoreApplication>
 #include <QtCore/QDateTime>
 #include <QtCore/QJsonObject>
-#include <QtCore/QThread>
 
 #include <LogHandler.h>
 #include <NumericalConstants.h>
@@ -32,37 +29,12 @@
 #include "Socket.h"
 #include <Trace.h>
 #include <Profile.h>
-#include <ThreadHelpers.h>
 
 #include "../NetworkLogging.h"
 
 using namespace udt;
 using namespace std::chrono;
 
-template <typename Mutex1, typename Mutex2>
-class DoubleLock {
-public:
-    using Lock = std::unique_lock<DoubleLock<Mutex1, Mutex2>>;
-    
-    DoubleLock(Mutex1& mutex1, Mutex2& mutex2) : _mutex1(mutex1), _mutex2(mutex2) { }
-    
-    DoubleLock(const DoubleLock&) = delete;
-    DoubleLock& operator=(const DoubleLock&) = delete;
-    
-    // Either locks all the mutexes or none of them
-    bool try_lock() { return (std::try_lock(_mutex1, _mutex2) == -1); }
-    
-    // Locks all the mutexes
-    void lock() { std::lock(_mutex1, _mutex2); }
-    
-     // Undefined behavior if not locked
-    void unlock() { _mutex1.unlock(); _mutex2.unlock(); }
-    
-private:
-    Mutex1& _mutex1;
-    Mutex2& _mutex2;
-};
-
 const microseconds SendQueue::MAXIMUM_ESTIMATED_TIMEOUT = seconds(5);
 const microseconds SendQueue::MINIMUM_ESTIMATED_TIMEOUT = milliseconds(10);
 
@@ -73,21 +45,8 @@ std::unique_ptr<SendQueue> SendQueue::create(Socket* socket, SockAddr destinatio
     auto queue = std::unique_ptr<SendQueue>(new SendQueue(socket, destination, currentSequenceNumber,
                                                           currentMessageNumber, hasReceivedHandshakeACK));
 
-    // Setup queue private thread
-    QThread* thread = new QThread();
-    QString name = "Networking: SendQueue " + destination.objectName();
-    thread->setObjectName(name); // Name thread for easier debug
-
-    connect(thread, &QThread::started, [name] { setThreadName(name.toStdString()); });
-    connect(thread, &QThread::started, queue.get(), &SendQueue::run);
-
-    connect(queue.get(), &QObject::destroyed, thread, &QThread::quit); // Thread auto cleanup
-    connect(thread, &QThread::finished, thread, &QThread::deleteLater); // Thread auto cleanup
-
-    // Move queue to private thread and start it
-    queue->moveToThread(thread);
-
-    thread->start();
+    // hand the queue to a thread of the scheduler, which starts running it right away
+    queue->_worker = SendQueueScheduler::getInstance().add(queue.get());
 
     return queue;
 }
@@ -107,37 +66,34 @@ SendQueue::SendQueue(Socket* socket, SockAddr dest, SequenceNumber currentSequen
 }
 
 SendQueue::~SendQueue() {
+    // wait for the scheduler to be done with the queue if it is running it
+    _worker->remove(this);
+}
+
+void SendQueue::wake() {
+    _worker->wake(this);
 }
 
 void SendQueue::queuePacket(std::unique_ptr<Packet> packet) {
     _packets.queuePacket(std::move(packet));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
-    
-    if (!thread()->isRunning() && _state == State::NotStarted) {
-        thread()->start();
-    }
+    // wake the queue in case it is waiting for packets
+    wake();
 }
 
 void SendQueue::queuePacketList(std::unique_ptr<PacketList> packetList) {
     _packets.queuePacketList(std::move(packetList));
     
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for packets
-    _emptyCondition.notify_one();
-    
-    if (!thread()->isRunning() && _state == State::NotStarted) {
-        thread()->start();
-    }
+    // wake the queue in case it is waiting for packets
+    wake();
 }
 
 void SendQueue::stop() {
     
     _state = State::Stopped;
     
-    // Notify all conditions in case we're waiting somewhere
-    _handshakeACKCondition.notify_one();
-    _emptyCondition.notify_one();
+    // wake the queue so that the scheduler lets go of it
+    wake();
 }
     
 int SendQueue::sendPacket(const Packet& packet) {
@@ -168,8 +124,8 @@ void SendQueue::ack(SequenceNumber ack) {
     
     _lastACKSequenceNumber = (uint32_t) ack;
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping with a full congestion window
-    _emptyCondition.notify_one();
+    // wake the queue in case it is waiting with a full congestion window
+    wake();
 }
 
 void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
@@ -178,35 +134,25 @@ void SendQueue::fastRetransmit(udt::SequenceNumber ack) {
         _naks.insert(ack, ack);
     }
 
-    // call notify_one on the condition_variable_any in case the send thread is sleeping waiting for losses to re-send
-    _emptyCondition.notify_one();
+    // wake the queue in case it is waiting for losses to re-send
+    wake();
 }
 
 void SendQueue::sendHandshake() {
-    std::unique_lock<std::mutex> handshakeLock { _handshakeMutex };
-    if (!_hasReceivedHandshakeACK) {
-        // we haven't received a handshake ACK from the client, send another now
-        // if the handshake hasn't been completed, then the initial sequence number
-        // should be the current sequence number + 1
-        SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
-        auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
-        handshakePacket->writePrimitive(initialSequenceNumber);
-        _socket->writeBasePacket(*handshakePacket, _destination);
-        
-        // we wait for the ACK or the re-send interval to expire
-        static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
-        _handshakeACKCondition.wait_for(handshakeLock, HANDSHAKE_RESEND_INTERVAL);
-    }
+    // we haven't received a handshake ACK from the client, send another now
+    // if the handshake hasn't been completed, then the initial sequence number
+    // should be the current sequence number + 1
+    SequenceNumber initialSequenceNumber = _currentSequenceNumber + 1;
+    auto handshakePacket = ControlPacket::create(ControlPacket::Handshake, sizeof(SequenceNumber));
+    handshakePacket->writePrimitive(initialSequenceNumber);
+    _socket->writeBasePacket(*handshakePacket, _destination);
 }
 
 void SendQueue::handshakeACK() {
-    {
-        std::lock_guard<std::mutex> locker { _handshakeMutex };
-        _hasReceivedHandshakeACK = true;
-    }
+    _hasReceivedHandshakeACK = true;
 
-    // Notify on the handshake ACK condition
-    _handshakeACKCondition.notify_one();
+    // wake the queue so that it starts sending without waiting for the handshake re-send interval
+    wake();
 }
 
 SequenceNumber SendQueue::getNextSequenceNumber() {
@@ -250,40 +196,46 @@ bool SendQueue::sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket,
     }
 }
 
-void SendQueue::run() {
-    if (_state == State::Stopped) {
-        // we've already been asked to stop before we even got a chance to start
-        // don't start now
-#ifdef UDT_CONNECTION_DEBUG
-        qCDebug(networking) << "SendQueue asked to run after being told to stop. Will not run.";
-#endif
-        return;
-    } else if (_state == State::Running) {
-#ifdef UDT_CONNECTION_DEBUG
-        qCDebug(networking) << "SendQueue asked to run but is already running (according to state). Will not re-run.";
-#endif
-        return;
+SendQueue::TimePoint SendQueue::step(TimePoint now) {
+    auto notStarted = State::NotStarted;
+    _state.compare_exchange_strong(notStarted, State::Running);
+    if (_state != State::Running) {
+        // we've been asked to stop, the scheduler doesn't run us again
+        return TimePoint::max();
     }
-    
-    _state = State::Running;
-    
-    // Wait for handshake to be complete
-    while (_state == State::Running && !_hasReceivedHandshakeACK) {
-        sendHandshake();
 
-        // Keep processing events
-        QCoreApplication::sendPostedEvents(this);
-        
-        // Once we're here we've either received the handshake ACK or it's going to be time to re-send a handshake.
-        // Either way let's continue processing - no packets will be sent if no handshake ACK has been received.
+    if (_hasPendingDestination) {
+        std::lock_guard<std::mutex> locker(_pendingDestinationLock);
+        _destination = _pendingDestination;
+        _hasPendingDestination = false;
+    }
+
+    // Wait for handshake to be complete, no packets are sent until then
+    if (!_hasReceivedHandshakeACK) {
+        if (now >= _nextHandshakeTimestamp) {
+            sendHandshake();
+
+            // re-send it if the ACK doesn't come before the re-send interval expires
+            static const auto HANDSHAKE_RESEND_INTERVAL = std::chrono::milliseconds(100);
+            _nextHandshakeTimestamp = now + HANDSHAKE_RESEND_INTERVAL;
+        }
+
+        // the first packet goes out as soon as the handshake is ACKed
+        _nextPacketTimestamp = now;
+        return _nextHandshakeTimestamp;
     }
 
-    // Keep an HRC to know when the next packet should have been
-    auto nextPacketTimestamp = p_high_resolution_clock::now();
+    // a queue that fell behind catches up over several runs, so that the other queues of its thread aren't held up
+    static const int MAX_PACKETS_PER_STEP = 64;
+
+    for (int i = 0; i < MAX_PACKETS_PER_STEP && _state == State::Running; ++i) {
+        int packetSendPeriod = _packetSendPeriod;
+        if (packetSendPeriod > 0 && now < _nextPacketTimestamp) {
+            return _nextPacketTimestamp;
+        }
 
-    while (_state == State::Running) {
         bool attemptedToSendPacket = maybeResendPacket();
-        
+
         // if we didn't find a packet to re-send AND we think we can fit a new packet on the wire
         // (this is according to the current flow window size) then we send out a new packet
         auto newPacketCount = 0;
@@ -291,85 +243,78 @@ void SendQueue::run() {
             newPacketCount = maybeSendNewPacket();
             attemptedToSendPacket = (newPacketCount > 0);
         }
-        
-        // since we're a while loop, give the thread a chance to process events
-        QCoreApplication::sendPostedEvents(this);
-        
-        // we just processed events so check now if we were just told to stop
-        // If the send queue has been innactive, skip the sleep for
-        // Either _isRunning will have been set to false and we'll break
-        // Or something happened and we'll keep going
-        if (_state != State::Running || isInactive(attemptedToSendPacket)) {
-            return;
+
+        if (!attemptedToSendPacket) {
+            // the time we had nothing to send isn't saved up for a burst once packets come in
+            _nextPacketTimestamp = std::max(_nextPacketTimestamp, now);
+            return checkInactivity(now);
         }
+        _idleState = IdleState::Sending;
 
-        if (_packetSendPeriod > 0) {
+        if (packetSendPeriod > 0) {
             // push the next packet timestamp forwards by the current packet send period
-            auto nextPacketDelta = (newPacketCount == 2 ? 2 : 1) * _packetSendPeriod;
-            nextPacketTimestamp += std::chrono::microseconds(nextPacketDelta);
-
-            // sleep as long as we need for next packet send, if we can
-            auto now = p_high_resolution_clock::now();
+            auto nextPacketDelta = (newPacketCount == 2 ? 2 : 1) * packetSendPeriod;
+            _nextPacketTimestamp += std::chrono::microseconds(nextPacketDelta);
 
-            auto timeToSleep = duration_cast<microseconds>(nextPacketTimestamp - now);
+            auto timeToWait = duration_cast<microseconds>(_nextPacketTimestamp - now);
 
-            // we use nextPacketTimestamp so that we don't fall behind, not to force long sleeps
-            // we'll never allow nextPacketTimestamp to force us to sleep for more than nextPacketDelta
+            // we use _nextPacketTimestamp so that we don't fall behind, not to force long waits
+            // we'll never allow _nextPacketTimestamp to force us to wait for more than nextPacketDelta
             // so cap it to that value
-            if (timeToSleep > std::chrono::microseconds(nextPacketDelta)) {
-                // reset the nextPacketTimestamp so that it is correct next time we come around
-                nextPacketTimestamp = now + std::chrono::microseconds(nextPacketDelta);
+            if (timeToWait > std::chrono::microseconds(nextPacketDelta)) {
+                // reset the _nextPacketTimestamp so that it is correct next time we come around
+                _nextPacketTimestamp = now + std::chrono::microseconds(nextPacketDelta);
 
-                timeToSleep = std::chrono::microseconds(nextPacketDelta);
+                timeToWait = std::chrono::microseconds(nextPacketDelta);
             }
 
-            // we're seeing SendQueues sleep for a long period of time here,
-            // which can lock the NodeList if it's attempting to clear connections
-            // for now we guard this by capping the time this thread and sleep for
+            // we've seen SendQueues wait for a long period of time here, which holds up their packets
+            // for now we guard this by capping the time a queue can wait for
 
             const microseconds MAX_SEND_QUEUE_SLEEP_USECS { 2000000 };
-            if (timeToSleep > MAX_SEND_QUEUE_SLEEP_USECS) {
-                qWarning() << "udt::SendQueue wanted to sleep for" << timeToSleep.count() << "microseconds";
+            if (timeToWait > MAX_SEND_QUEUE_SLEEP_USECS) {
+                qWarning() << "udt::SendQueue wanted to sleep for" << timeToWait.count() << "microseconds";
                 qWarning() << "Capping sleep to" << MAX_SEND_QUEUE_SLEEP_USECS.count();
-                qWarning() << "PSP:" << _packetSendPeriod << "NPD:" << nextPacketDelta
-                << "NPT:" << nextPacketTimestamp.time_since_epoch().count()
+                qWarning() << "PSP:" << packetSendPeriod << "NPD:" << nextPacketDelta
+                << "NPT:" << _nextPacketTimestamp.time_since_epoch().count()
                 << "NOW:" << now.time_since_epoch().count();
 
                 // alright, we're in a weird state
                 // we want to know why this is happening so we can implement a better fix than this guard
-                // send some details up to the API (if the user allows us) that indicate how we could such a large timeToSleep
+                // send some details up to the API (if the user allows us) that indicate how we could such a large timeToWait
                 static const QString SEND_QUEUE_LONG_SLEEP_ACTION = "sendqueue-sleep";
 
                 // setup a json object with the details we want
                 QJsonObject longSleepObject;
-                longSleepObject["timeToSleep"] = qint64(timeToSleep.count());
-                longSleepObject["packetSendPeriod"] = _packetSendPeriod.load();
+                longSleepObject["timeToSleep"] = qint64(timeToWait.count());
+                longSleepObject["packetSendPeriod"] = packetSendPeriod;
                 longSleepObject["nextPacketDelta"] = nextPacketDelta;
-                longSleepObject["nextPacketTimestamp"] = qint64(nextPacketTimestamp.time_since_epoch().count());
+                longSleepObject["nextPacketTimestamp"] = qint64(_nextPacketTimestamp.time_since_epoch().count());
                 longSleepObject["then"] = qint64(now.time_since_epoch().count());
 
                 // hopefully send this event using the user activity logger
                 UserActivityLogger::getInstance().logAction(SEND_QUEUE_LONG_SLEEP_ACTION, longSleepObject);
-                
-                timeToSleep = MAX_SEND_QUEUE_SLEEP_USECS;
+
+                _nextPacketTimestamp = now + MAX_SEND_QUEUE_SLEEP_USECS;
             }
-            
-            std::this_thread::sleep_for(timeToSleep);
         }
+
+        now = p_high_resolution_clock::now();
     }
+
+    return _state == State::Running ? now : TimePoint::max();
 }
 
 int SendQueue::maybeSendNewPacket() {
     if (!isFlowWindowFull()) {
         // we didn't re-send a packet, so time to send a new one
         
-        if (!_packets.isEmpty()) {
-            SequenceNumber nextNumber = getNextSequenceNumber();
-            
-            // grab the first packet we will send
-            std::unique_ptr<Packet> packet = _packets.takePacket();
-            Q_ASSERT(packet);
+        // grab the first packet we will send, there may be none even if the queue isn't empty
+        // while another thread is in the middle of queuing one
+        std::unique_ptr<Packet> packet = _packets.takePacket();
 
+        if (packet) {
+            SequenceNumber nextNumber = getNextSequenceNumber();
 
             // attempt to send the packet
             sendNewPacketAndAddToSentList(move(packet), nextNumber);
@@ -467,88 +412,85 @@ bool SendQueue::maybeResendPacket() {
     return false;
 }
 
-bool SendQueue::isInactive(bool attemptedToSendPacket) {
-    // check for connection timeout first
+SendQueue::TimePoint SendQueue::checkInactivity(TimePoint now) {
+    // packets queued from now on wake us up again, the NAKs are locked so that the timeout can add to them
+    std::unique_lock<std::mutex> locker(_naksLock);
 
-    if (!attemptedToSendPacket) {
-        // During our processing above we didn't send any packets
-        
-        // If that is still the case we should use a condition_variable_any to sleep until we have data to handle.
-        // To confirm that the queue of packets and the NAKs list are still both empty we'll need to use the DoubleLock
-        using DoubleLock = DoubleLock<std::recursive_mutex, std::mutex>;
-        DoubleLock doubleLock(_packets.getLock(), _naksLock);
-        DoubleLock::Lock locker(doubleLock, std::try_to_lock);
-        
-        if (locker.owns_lock() && (_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty()) {
-            // The packets queue and loss list mutexes are now both locked and they're both empty
-            
-            if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
-                // we've sent the client as much data as we have (and they've ACKed it)
-                // either wait for new data to send or 5 seconds before cleaning up the queue
-                static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
-                
-                // use our condition_variable_any to wait
-                auto cvStatus = _emptyCondition.wait_for(locker, EMPTY_QUEUES_INACTIVE_TIMEOUT);
-                
-                if (cvStatus == std::cv_status::timeout && (_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty()) {
+    if (!((_packets.isEmpty() || isFlowWindowFull()) && _naks.isEmpty())) {
+        // packets or losses came in since we looked, go again
+        _idleState = IdleState::Sending;
+        return now;
+    }
+
+    // The packets queue and loss list are both empty
+
+    if (uint32_t(_lastACKSequenceNumber) == uint32_t(_currentSequenceNumber)) {
+        // we've sent the client as much data as we have (and they've ACKed it)
+        // either wait for new data to send or 5 seconds before cleaning up the queue
+        static const auto EMPTY_QUEUES_INACTIVE_TIMEOUT = std::chrono::seconds(5);
+
+        if (_idleState != IdleState::WaitingForPackets) {
+            _idleState = IdleState::WaitingForPackets;
+            _idleDeadline = now + EMPTY_QUEUES_INACTIVE_TIMEOUT;
+        }
+
+        if (now < _idleDeadline) {
+            // new packets wake us up before then
+            return _idleDeadline;
+        }
 
 #ifdef UDT_CONNECTION_DEBUG
-                    qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
-                        << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
-                        << "seconds and receiver has ACKed all packets."
-                        << "The queue is now inactive and will be stopped.";
+        qCDebug(networking) << "SendQueue to" << _destination << "has been empty for"
+            << EMPTY_QUEUES_INACTIVE_TIMEOUT.count()
+            << "seconds and receiver has ACKed all packets."
+            << "The queue is now inactive and will be stopped.";
 #endif
 
-                    // we have the lock again - Make sure to unlock it
-                    locker.unlock();
-                    
-                    // Deactivate queue
-                    deactivate();
-                    return true;
-                }
+        // we have the lock - Make sure to unlock it
+        locker.unlock();
 
-            } else {
-                // We think the client is still waiting for data (based on the sequence number gap)
-                // Let's wait either for a response from the client or until the estimated timeout
-                // (plus the sync interval to allow the client to respond) has elapsed
-
-                auto estimatedTimeout = std::chrono::microseconds(_estimatedTimeout);
-
-                // Clamp timeout beween 10 ms and 5 s
-                estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
-
-                // use our condition_variable_any to wait
-                auto cvStatus = _emptyCondition.wait_for(locker, estimatedTimeout);
-
-                // when we wake-up check if we're "stuck" either if we've slept for the estimated timeout
-                // or it has been that long since the last time we sent a packet
-
-                // we are stuck if all of the following are true
-                // - there are no new packets to send or the flow window is full and we can't send any new packets
-                // - there are no packets to resend
-                // - the client has yet to ACK some sent packets
-                auto now = std::chrono::high_resolution_clock::now();
-
-                if ((cvStatus == std::cv_status::timeout || (now - _lastPacketSentAt > estimatedTimeout))
-                    && (_packets.isEmpty() || isFlowWindowFull())
-                    && _naks.isEmpty()
-                    && SequenceNumber(_lastACKSequenceNumber) < _currentSequenceNumber) {
-                    // after a timeout if we still have sent packets that the client hasn't ACKed we
-                    // add them to the loss list
-                    
-                    // Note that thanks to the DoubleLock we have the _naksLock right now
-                    _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
-
-                    // we have the lock again - time to unlock it
-                    locker.unlock();
-                    
-                    emit timeout();
-                }
-            }
-        }
+        // Deactivate queue
+        deactivate();
+        return TimePoint::max();
     }
-    
-    return false;
+
+    // We think the client is still waiting for data (based on the sequence number gap)
+    // Let's wait either for a response from the client or until the estimated timeout
+    // (plus the sync interval to allow the client to respond) has elapsed
+
+    auto estimatedTimeout = std::chrono::microseconds(_estimatedTimeout);
+
+    // Clamp timeout beween 10 ms and 5 s
+    estimatedTimeout = std::min(MAXIMUM_ESTIMATED_TIMEOUT, std::max(MINIMUM_ESTIMATED_TIMEOUT, estimatedTimeout));
+
+    if (_idleState != IdleState::WaitingForACK) {
+        _idleState = IdleState::WaitingForACK;
+        _idleDeadline = now + estimatedTimeout;
+        return _idleDeadline;
+    }
+
+    // we've been woken up or waited for the estimated timeout, check if we're "stuck" either if we've waited for the
+    // estimated timeout or it has been that long since the last time we sent a packet
+    // the packets queue and loss list were checked above, the client has yet to ACK some sent packets
+    if (now >= _idleDeadline || (std::chrono::high_resolution_clock::now() - _lastPacketSentAt > estimatedTimeout)) {
+        // after a timeout if we still have sent packets that the client hasn't ACKed we
+        // add them to the loss list
+
+        // Note that we have the _naksLock right now
+        _naks.append(SequenceNumber(_lastACKSequenceNumber) + 1, _currentSequenceNumber);
+
+        // we have the lock - time to unlock it
+        locker.unlock();
+
+        _idleState = IdleState::Sending;
+
+        emit timeout();
+
+        // re-send them right away
+        return now;
+    }
+
+    return _idleDeadline;
 }
 
 void SendQueue::deactivate() {
@@ -563,5 +505,10 @@ bool SendQueue::isFlowWindowFull() const {
 }
 
 void SendQueue::updateDestinationAddress(SockAddr newAddress) {
-    _destination = newAddress;
+    {
+        std::lock_guard<std::mutex> locker(_pendingDestinationLock);
+        _pendingDestination = newAddress;
+        _hasPendingDestination = true;
+    }
+    wake();
 }
@@ -14,7 +14,6 @@
 #define hifi_SendQueue_h
 
 #include <atomic>
-#include <condition_variable>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -31,6 +30,7 @@
 #include "Constants.h"
 #include "PacketQueue.h"
 #include "SequenceNumber.h"
+#include "SendQueueScheduler.h"
 #include "LossList.h"
 
 namespace udt {
@@ -41,10 +41,14 @@ class Packet;
 class PacketList;
 class Socket;
     
+// Sends the packets of a connection, paced by its congestion control.
+// Queues don't have threads of their own, the SendQueueScheduler runs them on its threads.
 class SendQueue : public QObject {
     Q_OBJECT
     
 public:
+    using TimePoint = SendQueueScheduler::TimePoint;
+
     enum class State {
         NotStarted,
         Running,
@@ -69,6 +73,10 @@ public:
     void setPacketSendPeriod(int newPeriod) { _packetSendPeriod = newPeriod; }
     
     void setEstimatedTimeout(int estimatedTimeout) { _estimatedTimeout = estimatedTimeout; }
+
+    // Sends what the queue can send by now, called by the SendQueueScheduler.
+    // Returns when the queue wants to run again, or TimePoint::max() once it has stopped.
+    TimePoint step(TimePoint now);
     
 public slots:
     void stop();
@@ -86,15 +94,13 @@ signals:
 
     void timeout();
     
-private slots:
-    void run();
-    
 private:
     Q_DISABLE_COPY_MOVE(SendQueue)
     SendQueue(Socket* socket, SockAddr dest, SequenceNumber currentSequenceNumber,
               MessageNumber currentMessageNumber, bool hasReceivedHandshakeACK);
     
     void sendHandshake();
+    void wake(); // has the scheduler run the queue as soon as possible
     
     int sendPacket(const Packet& packet);
     bool sendNewPacketAndAddToSentList(std::unique_ptr<Packet> newPacket, SequenceNumber sequenceNumber);
@@ -102,7 +108,8 @@ private:
     int maybeSendNewPacket(); // Figures out what packet to send next
     bool maybeResendPacket(); // Determines whether to resend a packet and which one
     
-    bool isInactive(bool attemptedToSendPacket);
+    // Called when there was nothing to send, returns when to look again
+    TimePoint checkInactivity(TimePoint now);
     void deactivate(); // makes the queue inactive and cleans it up
 
     bool isFlowWindowFull() const;
@@ -114,6 +121,12 @@ private:
     
     Socket* _socket { nullptr }; // Socket to send packet on
     SockAddr _destination; // Destination addr
+
+    std::mutex _pendingDestinationLock; // Protects the pending destination
+    SockAddr _pendingDestination; // Destination set from another thread, used from the next step on
+    std::atomic<bool> _hasPendingDestination { false };
+
+    std::shared_ptr<SendQueueScheduler::Worker> _worker; // Thread of the scheduler running this queue
     
     std::atomic<uint32_t> _lastACKSequenceNumber { 0 }; // Last ACKed sequence number
     
@@ -134,11 +147,18 @@ private:
     using PacketResendPair = std::pair<uint8_t, std::unique_ptr<Packet>>; // Number of resend + packet ptr
     std::unordered_map<SequenceNumber, PacketResendPair> _sentPackets; // Packets waiting for ACK.
     
-    std::mutex _handshakeMutex; // Protects the handshake ACK condition_variable
     std::atomic<bool> _hasReceivedHandshakeACK { false }; // flag for receipt of handshake ACK from client
-    std::condition_variable _handshakeACKCondition;
-    
-    std::condition_variable_any _emptyCondition;
+    TimePoint _nextHandshakeTimestamp; // When to re-send the handshake if it isn't ACKed
+
+    TimePoint _nextPacketTimestamp; // When the next packet should be sent according to the packet send period
+
+    enum class IdleState {
+        Sending,
+        WaitingForPackets, // everything sent was ACKed, the queue deactivates if nothing new comes in time
+        WaitingForACK // the receiver hasn't ACKed everything, the rest is re-sent if it doesn't in time
+    };
+    IdleState _idleState { IdleState::Sending };
+    TimePoint _idleDeadline;
 
     std::chrono::high_resolution_clock::time_point _lastPacketSentAt;
 
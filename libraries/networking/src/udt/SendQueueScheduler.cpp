@@ -0,0 +1,181 @@
+//
+//  SendQueueScheduler.cpp
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "SendQueueScheduler.h"
+
+#include <algorithm>
+
+#include <ThreadHelpers.h>
+
+#include "SendQueue.h"
+
+using namespace udt;
+
+using TimePoint = SendQueueScheduler::TimePoint;
+
+SendQueueScheduler& SendQueueScheduler::getInstance() {
+    // never destroyed, its threads may still be running queues while static objects are destroyed
+    static SendQueueScheduler* instance = new SendQueueScheduler();
+    return *instance;
+}
+
+SendQueueScheduler::SendQueueScheduler() {
+    // a thread can pace hundreds of queues, a few spread the cost of writing datagrams on busy servers
+    const int MAX_DEFAULT_THREADS = 4;
+    int numCores = (int)std::thread::hardware_concurrency();
+    setNumThreads(std::max(1, std::min(MAX_DEFAULT_THREADS, numCores / 4)));
+}
+
+void SendQueueScheduler::setNumThreads(int numThreads) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _numThreads = std::max(0, numThreads);
+
+    // the current workers keep running the queues they have, and stop once those are gone
+    _workers.clear();
+    for (int i = 0; i < _numThreads; ++i) {
+        _workers.push_back(std::make_shared<Worker>("Networking: SendQueues " + std::to_string(i)));
+    }
+}
+
+int SendQueueScheduler::getNumThreads() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _numThreads;
+}
+
+std::shared_ptr<SendQueueScheduler::Worker> SendQueueScheduler::add(SendQueue* queue) {
+    std::shared_ptr<Worker> worker;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_workers.empty()) {
+            worker = std::make_shared<Worker>("Networking: SendQueue");
+        } else {
+            worker = *std::min_element(_workers.begin(), _workers.end(), [](const auto& a, const auto& b) {
+                return a->getNumQueues() < b->getNumQueues();
+            });
+        }
+    }
+    worker->add(queue);
+    return worker;
+}
+
+SendQueueScheduler::Worker::Worker(const std::string& name) :
+    _wheel(new TimerWheel<SendQueue*>(p_high_resolution_clock::now()))
+{
+    _thread = std::thread([this, name] { run(name); });
+}
+
+SendQueueScheduler::Worker::~Worker() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _isStopping = true;
+    }
+    _condition.notify_one();
+    _thread.join();
+}
+
+void SendQueueScheduler::Worker::add(SendQueue* queue) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        scheduleLocked(queue, _queues[queue], p_high_resolution_clock::now());
+    }
+    _condition.notify_one();
+}
+
+void SendQueueScheduler::Worker::remove(SendQueue* queue) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    // its timer is left in the wheel, it is dropped when it comes due
+    _queues.erase(queue);
+    _wheel->cancel(queue);
+    _idleCondition.wait(lock, [this, queue] { return _runningQueue != queue; });
+}
+
+void SendQueueScheduler::Worker::wake(SendQueue* queue) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (queue == _runningQueue) {
+            // the queue is looked at again as soon as it is done running
+            _wokenWhileRunning = true;
+            return;
+        }
+        auto it = _queues.find(queue);
+        if (it == _queues.end()) {
+            return;
+        }
+        auto now = p_high_resolution_clock::now();
+        if (it->second.isScheduled && it->second.due <= now) {
+            // already due, the thread will get to it
+            return;
+        }
+        scheduleLocked(queue, it->second, now);
+    }
+    _condition.notify_one();
+}
+
+int SendQueueScheduler::Worker::getNumQueues() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return (int)_queues.size();
+}
+
+void SendQueueScheduler::Worker::scheduleLocked(SendQueue* queue, QueueState& state, TimePoint due) {
+    state.isScheduled = true;
+    state.due = due;
+    _wheel->schedule(queue, due);
+}
+
+void SendQueueScheduler::Worker::run(const std::string& name) {
+    setThreadName(name);
+
+    std::vector<SendQueue*> dueQueues;
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    while (!_isStopping) {
+        auto now = p_high_resolution_clock::now();
+        _wheel->collectDue(now, dueQueues);
+
+        if (dueQueues.empty()) {
+            auto nextDue = _wheel->nextDue();
+            if (nextDue == TimePoint::max()) {
+                _condition.wait(lock);
+            } else {
+                _condition.wait_for(lock, nextDue - now);
+            }
+            continue;
+        }
+
+        for (auto queue : dueQueues) {
+            auto it = _queues.find(queue);
+            if (it == _queues.end()) {
+                // the queue was removed since
+                continue;
+            }
+            it->second.isScheduled = false;
+            _runningQueue = queue;
+            _wokenWhileRunning = false;
+
+            lock.unlock();
+            auto nextRun = queue->step(p_high_resolution_clock::now());
+            lock.lock();
+
+            _runningQueue = nullptr;
+            // look the queue up again, it may have been removed while it was running
+            it = _queues.find(queue);
+            if (it != _queues.end()) {
+                if (_wokenWhileRunning) {
+                    nextRun = std::min(nextRun, p_high_resolution_clock::now());
+                }
+                if (nextRun != TimePoint::max()) {
+                    scheduleLocked(queue, it->second, nextRun);
+                }
+            }
+            _idleCondition.notify_all();
+        }
+        dueQueues.clear();
+    }
+}
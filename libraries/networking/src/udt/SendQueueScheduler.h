@@ -0,0 +1,101 @@
+//
+//  SendQueueScheduler.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_SendQueueScheduler_h
+#define hifi_SendQueueScheduler_h
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <PortableHighResolutionClock.h>
+
+#include "TimerWheel.h"
+
+namespace udt {
+
+class SendQueue;
+
+// Runs the SendQueues of all connections on a few shared threads instead of a thread per queue.
+// Each queue is run by a single thread, so its packets still go out in order. A thread keeps the time at which each of
+// its queues wants to run again in a timer wheel, and runs a queue when its congestion control lets it send its next
+// packet, or as soon as it is woken by new packets, ACKs or losses.
+class SendQueueScheduler {
+public:
+    using TimePoint = p_high_resolution_clock::time_point;
+
+    // Runs a set of queues on one thread
+    class Worker;
+
+    static SendQueueScheduler& getInstance();
+
+    // 0 runs each queue on a thread of its own, as before the queues were shared.
+    // Takes effect for the queues added afterwards.
+    void setNumThreads(int numThreads);
+    int getNumThreads() const;
+
+    // Gives the queue to the least loaded thread and runs it as soon as possible.
+    // The queue must remove itself from the returned worker before it is destroyed.
+    std::shared_ptr<Worker> add(SendQueue* queue);
+
+private:
+    SendQueueScheduler();
+
+    mutable std::mutex _mutex;
+    int _numThreads { 0 };
+    std::vector<std::shared_ptr<Worker>> _workers;
+};
+
+class SendQueueScheduler::Worker {
+public:
+    Worker(const std::string& name);
+    ~Worker();
+
+    void add(SendQueue* queue);
+    // returns once the queue is no longer being run, it is never run again afterwards
+    void remove(SendQueue* queue);
+    // runs the queue as soon as possible
+    void wake(SendQueue* queue);
+
+    int getNumQueues() const;
+
+private:
+    struct QueueState {
+        bool isScheduled { false };
+        TimePoint due;
+    };
+
+    void run(const std::string& name);
+    void scheduleLocked(SendQueue* queue, QueueState& state, TimePoint due);
+
+    mutable std::mutex _mutex;
+    std::condition_variable _condition; // wakes the thread when a queue is due sooner than it is sleeping for
+    std::condition_variable _idleCondition; // wakes the threads waiting in remove() when a queue is done running
+
+    std::unique_ptr<TimerWheel<SendQueue*>> _wheel;
+    std::unordered_map<SendQueue*, QueueState> _queues;
+
+    SendQueue* _runningQueue { nullptr };
+    bool _wokenWhileRunning { false };
+    bool _isStopping { false };
+
+    std::thread _thread;
+};
+
+} // namespace udt
+
+#endif // hifi_SendQueueScheduler_h
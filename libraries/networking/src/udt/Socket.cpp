@@ -12,6 +12,8 @@
 
 #include "Socket.h"
 
+#include <algorithm>
+
 #ifdef Q_OS_ANDROID
 #include <sys/socket.h>
 #endif
@@ -28,6 +30,7 @@
 #include "../NLPacket.h"
 #include "../NLPacketList.h"
 #include "PacketList.h"
+#include "PacketBufferPool.h"
 #include <Trace.h>
 
 using namespace udt;
@@ -146,6 +149,12 @@ qint64 Socket::writeBasePacket(const udt::BasePacket& packet, const SockAddr &so
 qint64 Socket::writePacket(const Packet& packet, const SockAddr& sockAddr) {
     Q_ASSERT_X(!packet.isReliable(), "Socket::writePacket", "Cannot send a reliable packet unreliably");
 
+    prepareUnreliablePacket(packet, sockAddr);
+
+    return writeDatagram(packet.getData(), packet.getDataSize(), sockAddr);
+}
+
+void Socket::prepareUnreliablePacket(const Packet& packet, const SockAddr& sockAddr) {
     SequenceNumber sequenceNumber;
     {
         Lock lock(_unreliableSequenceNumbersMutex);
@@ -160,8 +169,6 @@ qint64 Socket::writePacket(const Packet& packet, const SockAddr& sockAddr) {
 
     // write the correct sequence number to the Packet here
     packet.writeSequenceNumber(sequenceNumber);
-
-    return writeDatagram(packet.getData(), packet.getDataSize(), sockAddr);
 }
 
 qint64 Socket::writePacket(std::unique_ptr<Packet> packet, const SockAddr& sockAddr) {
@@ -209,12 +216,55 @@ qint64 Socket::writePacketList(std::unique_ptr<PacketList> packetList, const Soc
 
     // Unreliable and Unordered
     qint64 totalBytesSent = 0;
+#if defined(Q_OS_LINUX)
+    if (sockAddr.getType() == SocketType::UDP) {
+        while (packetList->_packets.size() > 1) {
+            totalBytesSent += writeUnreliablePacketBatch(packetList->_packets, sockAddr);
+        }
+    }
+#endif
     while (!packetList->_packets.empty()) {
         totalBytesSent += writePacket(packetList->takeFront<Packet>(), sockAddr);
     }
     return totalBytesSent;
 }
 
+#if defined(Q_OS_LINUX)
+qint64 Socket::writeUnreliablePacketBatch(std::list<std::unique_ptr<Packet>>& packets, const SockAddr& sockAddr) {
+    QByteArray datagrams[NetworkSocket::MAX_DATAGRAM_BATCH];
+    int count = 0;
+    for (auto it = packets.begin(); it != packets.end() && count < NetworkSocket::MAX_DATAGRAM_BATCH; ++it, ++count) {
+        const auto& packet = **it;
+        Q_ASSERT_X(!packet.isReliable(), "Socket::writeUnreliablePacketBatch", "Cannot send a reliable packet unreliably");
+        prepareUnreliablePacket(packet, sockAddr);
+        datagrams[count] = QByteArray::fromRawData(packet.getData(), packet.getDataSize());
+    }
+
+    int numSent = 0;
+    if (_networkSocket.state(SocketType::UDP) == QAbstractSocket::BoundState) {
+        numSent = std::max(_networkSocket.writeUDPDatagrams(datagrams, count, sockAddr), 0);
+    }
+
+    qint64 bytesSent = 0;
+    if (numSent > 0) {
+        ++_sendBatches;
+        _datagramsSentInBatches += numSent;
+        for (int i = 0; i < numSent; ++i) {
+            bytesSent += datagrams[i].size();
+        }
+    }
+    // what the batch didn't send goes one by one, which also reports the error
+    for (int i = numSent; i < count; ++i) {
+        bytesSent += writeDatagram(datagrams[i], sockAddr);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        packets.pop_front();
+    }
+    return bytesSent;
+}
+#endif
+
 void Socket::writeReliablePacket(Packet* packet, const SockAddr& sockAddr) {
     auto connection = findOrCreateConnection(sockAddr);
     if (connection) {
@@ -406,7 +456,9 @@ void Socket::readPendingDatagrams() {
         SockAddr senderSockAddr;
 
         // setup a buffer to read the packet into
-        auto buffer = std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
+        bool isPooled = packetSizeWithHeader <= PacketBufferPool::BUFFER_SIZE;
+        auto buffer = isPooled ? PacketBufferPool::getInstance().take()
+                               : std::unique_ptr<char[]>(new char[packetSizeWithHeader]);
 
         // pull the datagram
         auto sizeRead = _networkSocket.readDatagram(buffer.get(), packetSizeWithHeader, &senderSockAddr);
@@ -421,73 +473,135 @@ void Socket::readPendingDatagrams() {
             continue;
         }
 
-        auto it = _unfilteredHandlers.find(senderSockAddr);
+        processDatagram(std::move(buffer), packetSizeWithHeader, isPooled, senderSockAddr, receiveTime);
 
-        if (it != _unfilteredHandlers.end()) {
-            // we have a registered unfiltered handler for this SockAddr - call that and return
-            if (it->second) {
-                auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-                basePacket->setReceiveTime(receiveTime);
-                it->second(std::move(basePacket));
-            }
+#if defined(Q_OS_LINUX)
+        if (senderSockAddr.getType() == SocketType::UDP) {
+            // reading a datagram through the QUdpSocket re-enables its read notifications, the datagrams queued behind
+            // it can be read many at a time
+            readDatagramBatch();
+        }
+#endif
+    }
+}
 
-            continue;
+#if defined(Q_OS_LINUX)
+int Socket::readDatagramBatch() {
+    const int BATCH_SIZE = NetworkSocket::MAX_DATAGRAM_BATCH;
+    auto& pool = PacketBufferPool::getInstance();
+
+    _batchBuffers.resize(BATCH_SIZE);
+    char* buffers[BATCH_SIZE];
+    for (int i = 0; i < BATCH_SIZE; ++i) {
+        if (!_batchBuffers[i]) {
+            _batchBuffers[i] = pool.take();
         }
+        buffers[i] = _batchBuffers[i].get();
+    }
+
+    qint64 sizes[BATCH_SIZE];
+    SockAddr senderSockAddrs[BATCH_SIZE];
+    int numRead = _networkSocket.readUDPDatagrams(buffers, PacketBufferPool::BUFFER_SIZE, BATCH_SIZE, sizes,
+                                                  senderSockAddrs);
+    if (numRead == 0) {
+        return 0;
+    }
 
-        // check if this was a control packet or a data packet
-        bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
+    ++_receiveBatches;
+    _datagramsReceivedInBatches += numRead;
+    auto receiveTime = p_high_resolution_clock::now();
 
-        if (isControlPacket) {
-            // setup a control packet from the data we just read
-            auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            controlPacket->setReceiveTime(receiveTime);
+    for (int i = 0; i < numRead; ++i) {
+        _lastPacketSizeRead = sizes[i];
+        _lastPacketSockAddr = senderSockAddrs[i];
 
-            // move this control packet to the matching connection, if there is one
-            auto connection = findOrCreateConnection(senderSockAddr, true);
+        // no udt packet is larger than a pooled buffer, the datagrams that were cut off are dropped
+        if (sizes[i] <= 0) {
+            continue;
+        }
+        processDatagram(std::move(_batchBuffers[i]), sizes[i], true, senderSockAddrs[i], receiveTime);
+    }
+    return numRead;
+}
+#endif
+
+void Socket::processDatagram(std::unique_ptr<char[]> buffer, qint64 size, bool isPooled, const SockAddr& senderSockAddr,
+                             p_high_resolution_clock::time_point receiveTime) {
+    auto it = _unfilteredHandlers.find(senderSockAddr);
 
-            if (connection) {
-                connection->processControl(move(controlPacket));
+    if (it != _unfilteredHandlers.end()) {
+        // we have a registered unfiltered handler for this SockAddr - call that and return
+        if (it->second) {
+            auto basePacket = BasePacket::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+            if (isPooled) {
+                basePacket->setDataIsPooled();
             }
+            basePacket->setReceiveTime(receiveTime);
+            it->second(std::move(basePacket));
+        }
 
-        } else {
-            // setup a Packet from the data we just read
-            auto packet = Packet::fromReceivedPacket(std::move(buffer), packetSizeWithHeader, senderSockAddr);
-            packet->setReceiveTime(receiveTime);
+        return;
+    }
 
-            // save the sequence number in case this is the packet that sticks readyRead
-            _lastReceivedSequenceNumber = packet->getSequenceNumber();
+    // check if this was a control packet or a data packet
+    bool isControlPacket = *reinterpret_cast<uint32_t*>(buffer.get()) & CONTROL_BIT_MASK;
 
-            // call our verification operator to see if this packet is verified
-            if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
-                auto connection = findOrCreateConnection(senderSockAddr, true);
+    if (isControlPacket) {
+        // setup a control packet from the data we just read
+        auto controlPacket = ControlPacket::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+        if (isPooled) {
+            controlPacket->setDataIsPooled();
+        }
+        controlPacket->setReceiveTime(receiveTime);
+
+        // move this control packet to the matching connection, if there is one
+        auto connection = findOrCreateConnection(senderSockAddr, true);
+
+        if (connection) {
+            connection->processControl(move(controlPacket));
+        }
+
+    } else {
+        // setup a Packet from the data we just read
+        auto packet = Packet::fromReceivedPacket(std::move(buffer), size, senderSockAddr);
+        if (isPooled) {
+            packet->setDataIsPooled();
+        }
+        packet->setReceiveTime(receiveTime);
 
-                if (packet->isReliable()) {
-                    // if this was a reliable packet then signal the matching connection with the sequence number
+        // save the sequence number in case this is the packet that sticks readyRead
+        _lastReceivedSequenceNumber = packet->getSequenceNumber();
 
-                    if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
-                                                                                  packet->getDataSize(),
-                                                                                  packet->getPayloadSize())) {
-                        // the connection could not be created or indicated that we should not continue processing this packet
+        // call our verification operator to see if this packet is verified
+        if (!_packetFilterOperator || _packetFilterOperator(*packet)) {
+            auto connection = findOrCreateConnection(senderSockAddr, true);
+
+            if (packet->isReliable()) {
+                // if this was a reliable packet then signal the matching connection with the sequence number
+
+                if (!connection || !connection->processReceivedSequenceNumber(packet->getSequenceNumber(),
+                                                                              packet->getDataSize(),
+                                                                              packet->getPayloadSize())) {
+                    // the connection could not be created or indicated that we should not continue processing this packet
 #ifdef UDT_CONNECTION_DEBUG
-                        qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
-                            << ", type" << NLPacket::typeInHeader(*packet);
+                    qCDebug(networking) << "Can't process packet: version" << (unsigned int)NLPacket::versionInHeader(*packet)
+                        << ", type" << NLPacket::typeInHeader(*packet);
 #endif
-                        continue;
-                    }
-                } else if (connection) {
-                    connection->recordReceivedUnreliablePackets(packet->getWireSize(),
-                                                                packet->getPayloadSize());
+                    return;
                 }
+            } else if (connection) {
+                connection->recordReceivedUnreliablePackets(packet->getWireSize(),
+                                                            packet->getPayloadSize());
+            }
 
-                if (packet->isPartOfMessage()) {
-                    auto connection = findOrCreateConnection(senderSockAddr, true);
-                    if (connection) {
-                        connection->queueReceivedMessagePacket(std::move(packet));
-                    }
-                } else if (_packetHandler) {
-                    // call the verified packet callback to let it handle this packet
-                    _packetHandler(std::move(packet));
+            if (packet->isPartOfMessage()) {
+                auto connection = findOrCreateConnection(senderSockAddr, true);
+                if (connection) {
+                    connection->queueReceivedMessagePacket(std::move(packet));
                 }
+            } else if (_packetHandler) {
+                // call the verified packet callback to let it handle this packet
+                _packetHandler(std::move(packet));
             }
         }
     }
@@ -527,6 +641,15 @@ ConnectionStats::Stats Socket::sampleStatsForConnection(const SockAddr& destinat
     }
 }
 
+Socket::IOStats Socket::sampleIOStats() {
+    IOStats stats;
+    stats.receiveBatches = _receiveBatches.exchange(0);
+    stats.datagramsReceivedInBatches = _datagramsReceivedInBatches.exchange(0);
+    stats.sendBatches = _sendBatches.exchange(0);
+    stats.datagramsSentInBatches = _datagramsSentInBatches.exchange(0);
+    return stats;
+}
+
 Socket::StatsVector Socket::sampleStatsForAllConnections() {
     StatsVector result;
     Lock connectionsLock(_connectionsHashMutex);
@@ -15,6 +15,7 @@
 #ifndef hifi_Socket_h
 #define hifi_Socket_h
 
+#include <atomic>
 #include <functional>
 #include <unordered_map>
 #include <mutex>
@@ -55,6 +56,14 @@ class Socket : public QObject {
 
 public:
     using StatsVector = std::vector<std::pair<SockAddr, ConnectionStats::Stats>>;
+
+    // datagrams read and written with one system call for many, where the platform allows it
+    struct IOStats {
+        quint64 receiveBatches { 0 };
+        quint64 datagramsReceivedInBatches { 0 };
+        quint64 sendBatches { 0 };
+        quint64 datagramsSentInBatches { 0 };
+    };
  
     Socket(QObject* object = 0, bool shouldChangeSocketOptions = true);
     
@@ -89,6 +98,8 @@ public:
     void messageFailed(Connection* connection, Packet::MessageNumber messageNumber);
     
     StatsVector sampleStatsForAllConnections();
+    // returns the counts since the previous call
+    IOStats sampleIOStats();
 
 #if defined(WEBRTC_DATA_CHANNELS)
     const WebRTCSocket* getWebRTCSocket();
@@ -115,6 +126,13 @@ private slots:
 
 private:
     void setSystemBufferSizes(SocketType socketType);
+    void processDatagram(std::unique_ptr<char[]> buffer, qint64 size, bool isPooled, const SockAddr& senderSockAddr,
+                         p_high_resolution_clock::time_point receiveTime);
+    void prepareUnreliablePacket(const Packet& packet, const SockAddr& sockAddr);
+#if defined(Q_OS_LINUX)
+    int readDatagramBatch();
+    qint64 writeUnreliablePacketBatch(std::list<std::unique_ptr<Packet>>& packets, const SockAddr& sockAddr);
+#endif
     Connection* findOrCreateConnection(const SockAddr& sockAddr, bool filterCreation = false);
    
     // privatized methods used by UDTTest - they are private since they must be called on the Socket thread
@@ -148,6 +166,14 @@ private:
 
     bool _shouldChangeSocketOptions { true };
 
+#if defined(Q_OS_LINUX)
+    std::vector<std::unique_ptr<char[]>> _batchBuffers; // pooled buffers waiting for the next batched read
+#endif
+    std::atomic<quint64> _receiveBatches { 0 };
+    std::atomic<quint64> _datagramsReceivedInBatches { 0 };
+    std::atomic<quint64> _sendBatches { 0 };
+    std::atomic<quint64> _datagramsSentInBatches { 0 };
+
     int _lastPacketSizeRead { 0 };
     SequenceNumber _lastReceivedSequenceNumber;
     SockAddr _lastPacketSockAddr;
@@ -0,0 +1,132 @@
+//
+//  TimerWheel.h
+//  libraries/networking/src/udt
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_TimerWheel_h
+#define hifi_TimerWheel_h
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <PortableHighResolutionClock.h>
+
+namespace udt {
+
+// A hashed timer wheel: a timer goes in the slot of the tick it is due on, whatever the number of turns of the wheel
+// until then, so that scheduling is constant time and collecting the due timers only looks at the slots of the ticks
+// that passed. Each key has at most one timer, scheduling it again or cancelling it leaves its earlier timer in the
+// wheel as a stale one, which is dropped when it comes due.
+template <typename Key>
+class TimerWheel {
+public:
+    using TimePoint = p_high_resolution_clock::time_point;
+
+    // with 100 us ticks a turn of the wheel is 51.2 ms, which covers the send periods and timeouts of most queues
+    static const int64_t NUM_SLOTS = 512;
+    static const int64_t TICK_USECS = 100;
+
+    TimerWheel(TimePoint now) : _currentTick(tickOf(now)) { }
+
+    void schedule(const Key& key, TimePoint due) {
+        auto generation = ++_nextGeneration;
+        _generations[key] = generation;
+
+        // a timer that is already due goes in the slot that is looked at next
+        auto tick = std::max(tickOf(due), _currentTick);
+        _slots[tick % NUM_SLOTS].push_back({ key, generation, due });
+        ++_size;
+    }
+
+    void cancel(const Key& key) { _generations.erase(key); }
+
+    bool isScheduled(const Key& key) const { return _generations.find(key) != _generations.end(); }
+
+    // moves the keys due at or before now to dueKeys, in no particular order
+    void collectDue(TimePoint now, std::vector<Key>& dueKeys) {
+        auto nowTick = tickOf(now);
+        // past a full turn every slot has been looked at
+        auto lastTick = std::min(nowTick, _currentTick + NUM_SLOTS - 1);
+        for (auto tick = _currentTick; tick <= lastTick && _size > 0; ++tick) {
+            auto& slot = _slots[tick % NUM_SLOTS];
+            for (size_t i = 0; i < slot.size();) {
+                if (slot[i].due <= now) {
+                    if (isCurrent(slot[i])) {
+                        dueKeys.push_back(slot[i].key);
+                        _generations.erase(slot[i].key);
+                    }
+                    slot[i] = slot.back();
+                    slot.pop_back();
+                    --_size;
+                } else {
+                    ++i;
+                }
+            }
+        }
+        // the current tick may still hold timers due later in it, or a turn away, so it is looked at again
+        _currentTick = std::max(_currentTick, nowTick);
+    }
+
+    // returns the time of the earliest timer within a turn of the wheel, a turn from now if there is none within it,
+    // or TimePoint::max() if there is no timer at all
+    TimePoint nextDue() const {
+        if (_generations.empty()) {
+            return TimePoint::max();
+        }
+        for (int64_t tick = _currentTick; tick < _currentTick + NUM_SLOTS; ++tick) {
+            auto& slot = _slots[tick % NUM_SLOTS];
+            auto nextDue = TimePoint::max();
+            for (auto& timer : slot) {
+                if (tickOf(timer.due) <= tick && isCurrent(timer)) {
+                    nextDue = std::min(nextDue, timer.due);
+                }
+            }
+            if (nextDue != TimePoint::max()) {
+                return nextDue;
+            }
+        }
+        return timeOfTick(_currentTick + NUM_SLOTS);
+    }
+
+private:
+    struct Timer {
+        Key key;
+        uint64_t generation; // the timer is stale if its key was scheduled again or cancelled since
+        TimePoint due;
+    };
+
+    static int64_t tickOf(TimePoint time) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count() / TICK_USECS;
+    }
+    static TimePoint timeOfTick(int64_t tick) {
+        return TimePoint(std::chrono::duration_cast<TimePoint::duration>(std::chrono::microseconds(tick * TICK_USECS)));
+    }
+
+    bool isCurrent(const Timer& timer) const {
+        auto it = _generations.find(timer.key);
+        return it != _generations.end() && it->second == timer.generation;
+    }
+
+    std::array<std::vector<Timer>, NUM_SLOTS> _slots;
+    std::unordered_map<Key, uint64_t> _generations; // of the current timer of each scheduled key
+    uint64_t _nextGeneration { 0 };
+    int64_t _currentTick;
+    size_t _size { 0 }; // timers in the slots, stale ones included
+};
+
+template <typename Key> const int64_t TimerWheel<Key>::NUM_SLOTS;
+template <typename Key> const int64_t TimerWheel<Key>::TICK_USECS;
+
+} // namespace udt
+
+#endif // hifi_TimerWheel_h
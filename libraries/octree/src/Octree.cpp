@@ -52,7 +52,7 @@
 #include "OctreeUtils.h"
 #include "OctreeEntitiesFileParser.h"
 
-QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz"};
+QVector<QString> PERSIST_EXTENSIONS = {"json", "json.gz", "bin"};
 
 Octree::Octree(bool shouldReaverage) :
     _rootElement(NULL),
@@ -675,6 +675,9 @@ bool Octree::readFromFile(const char* fileName) {
     if (qFileName.endsWith(".json.gz")) {
         return readJSONFromGzippedFile(qFileName);
     }
+    if (qFileName.endsWith(".bin")) {
+        return readFromBinaryFile(qFileName);
+    }
 
     QFile file(qFileName);
 
@@ -714,6 +717,26 @@ bool Octree::readJSONFromGzippedFile(QString qFileName) {
     return readJSONFromStream(-1, jsonStream, false, relativeURL);
 }
 
+bool Octree::readFromBinaryFile(const QString& fileName) {
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qCritical() << "Cannot open binary snapshot for reading: " << fileName;
+        return false;
+    }
+
+    // map the snapshot rather than copying it, entities are decoded straight from the file
+    qint64 size = file.size();
+    uchar* mapped = file.map(0, size);
+    if (mapped) {
+        bool success = readFromBinary(reinterpret_cast<const char*>(mapped), size);
+        file.unmap(mapped);
+        return success;
+    }
+
+    QByteArray data = file.readAll();
+    return readFromBinary(data.constData(), data.size());
+}
+
 bool Octree::readFromURL(
     const QString& urlString,
     const bool isObservable,
@@ -848,12 +871,30 @@ bool Octree::writeToFile(const char* fileName, const OctreeElementPointer& eleme
         success = writeToJSONFile(cFileName, element);
     } else if (persistAsFileType == "json.gz") {
         success = writeToJSONFile(cFileName, element, true);
+    } else if (persistAsFileType == "bin" && !element) {
+        success = writeToBinaryFile(cFileName);
     } else {
         qCDebug(octree) << "unable to write octree to file of type" << persistAsFileType;
     }
     return success;
 }
 
+bool Octree::writeToBinaryFile(const char* fileName) {
+    qCDebug(octree, "Saving binary snapshot to file %s...", fileName);
+
+    QByteArray data;
+    if (!writeToBinary(data)) {
+        return false;
+    }
+
+    QSaveFile persistFile(fileName);
+    if (!persistFile.open(QIODevice::WriteOnly) || persistFile.write(data) != data.size() || !persistFile.commit()) {
+        qCritical() << "Failed to write binary snapshot:" << persistFile.errorString();
+        return false;
+    }
+    return true;
+}
+
 bool Octree::toJSONDocument(QJsonDocument* doc, const OctreeElementPointer& element) {
     QVariantMap entityDescription;
 
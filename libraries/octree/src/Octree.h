@@ -211,6 +211,17 @@ public:
                             bool skipThoseWithBadParents) = 0;
     virtual bool writeToJSON(QString& jsonString, const OctreeElementPointer& element) = 0;
 
+    // Binary snapshots of the whole tree, see OctreeUtils::BinarySnapshotHeader. Not every tree supports them.
+    bool writeToBinaryFile(const char* filename);
+    virtual bool writeToBinary(QByteArray& data) { return false; }
+
+    // Incremental persistence. writeJournalRecord takes what changed since the last record or reset, and
+    // leaves the record empty if nothing did. It returns false if only a full write can capture the changes.
+    virtual void resetJournal() { }
+    virtual bool writeJournalRecord(QByteArray& record) { return false; }
+    // replay records on top of a tree read from a binary snapshot, returns how many applied
+    virtual int applyJournalRecords(const QList<QByteArray>& records) { return 0; }
+
     // Octree importers
     bool readFromFile(const char* filename);
     bool readFromURL(const QString& url, const bool isObservable = true, const qint64 callerId = -1, const bool isImport = false); // will support file urls as well...
@@ -219,6 +230,8 @@ public:
     bool readJSONFromStream(uint64_t streamLength, QDataStream& inputStream, const bool isImport = false, const QUrl& urlString = QUrl());
     bool readJSONFromGzippedFile(QString qFileName);
     virtual bool readFromMap(QVariantMap& entityDescription, const bool isImport = false) = 0;
+    bool readFromBinaryFile(const QString& fileName);
+    virtual bool readFromBinary(const char* data, qint64 size) { return false; }
 
     uint64_t getOctreeElementsCount();
 
@@ -11,13 +11,22 @@
 #include "OctreeDataUtils.h"
 #include "OctreeEntitiesFileParser.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
 #include <Gzip.h>
 #include <udt/PacketHeaders.h>
 
+#include <QDataStream>
 #include <QDebug>
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QSaveFile>
 
 bool OctreeUtils::RawOctreeData::readOctreeDataInfoFromMap(const QVariantMap& map) {
     if (map.contains("Id") && map.contains("DataVersion") && map.contains("Version")) {
@@ -114,3 +123,257 @@ void OctreeUtils::RawEntityData::writeSubclassData(QByteArray& root) const {
 }
 
 PacketType OctreeUtils::RawEntityData::dataPacketType() const { return PacketType::EntityData; }
+
+int OctreeUtils::RawEntityData::applyJournalRecords(const QList<QByteArray>& records) {
+    QHash<QUuid, int> indices;
+    for (int i = 0; i < variantEntityData.size(); ++i) {
+        indices[QUuid(variantEntityData[i].toMap()["id"].toString())] = i;
+    }
+
+    int numApplied = 0;
+    bool hasDeletes = false;
+    for (const auto& record : records) {
+        QJsonParseError error;
+        QJsonObject root = QJsonDocument::fromJson(record, &error).object();
+        if (root.isEmpty()) {
+            qCritical() << "Can't parse journal record:" << error.errorString();
+            continue;
+        }
+
+        // skip records written against other content, i.e. from before a content replacement
+        QUuid recordID(root["Id"].toString());
+        if (recordID != id) {
+            qWarning() << "Skipping journal record for" << recordID << "- current data is" << id;
+            continue;
+        }
+
+        for (const auto& entityValue : root["Entities"].toArray()) {
+            QVariantMap entity = entityValue.toObject().toVariantMap();
+            QUuid entityID(entity["id"].toString());
+
+            auto index = indices.find(entityID);
+            if (index == indices.end()) {
+                indices[entityID] = variantEntityData.size();
+                variantEntityData.push_back(entity);
+            } else {
+                // never replace an entity with an older version of itself
+                QVariantMap current = variantEntityData[*index].toMap();
+                if (!current.contains("lastEdited") || !entity.contains("lastEdited") ||
+                    entity["lastEdited"].toULongLong() >= current["lastEdited"].toULongLong()) {
+                    variantEntityData[*index] = entity;
+                }
+            }
+        }
+
+        for (const auto& deletedValue : root["Deleted"].toArray()) {
+            auto index = indices.find(QUuid(deletedValue.toString()));
+            if (index != indices.end()) {
+                variantEntityData[*index] = QVariant();
+                indices.erase(index);
+                hasDeletes = true;
+            }
+        }
+
+        dataVersion = std::max(dataVersion, (Version)root["DataVersion"].toVariant().toLongLong());
+        ++numApplied;
+    }
+
+    if (hasDeletes) {
+        variantEntityData.erase(std::remove_if(variantEntityData.begin(), variantEntityData.end(), [](const QVariant& entity) {
+            return !entity.isValid();
+        }), variantEntityData.end());
+    }
+
+    return numApplied;
+}
+
+namespace {
+
+// held while a journal is folded into its persist file, or while the persist file is replaced
+std::mutex compactionMutex;
+// held while a journal is appended to or moved aside
+std::mutex journalMutex;
+
+const QString JOURNAL_EXTENSION = ".journal";
+const QString COMPACTING_EXTENSION = ".compacting";
+
+QString compactingFilePath(const QString& persistFilePath) {
+    return OctreeUtils::journalFilePath(persistFilePath) + COMPACTING_EXTENSION;
+}
+
+// stops at the first record that can't be read, e.g. one cut short by a crash
+QList<QByteArray> readJournalRecords(const QString& path) {
+    QList<QByteArray> records;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return records;
+    }
+
+    QDataStream stream(&file);
+    while (!stream.atEnd()) {
+        QByteArray compressedRecord;
+        stream >> compressedRecord;
+
+        QByteArray record;
+        if (stream.status() != QDataStream::Ok || !gunzip(compressedRecord, record)) {
+            qWarning() << "Ignoring truncated journal record in" << path;
+            break;
+        }
+        records.push_back(record);
+    }
+
+    return records;
+}
+
+}
+
+QString OctreeUtils::journalFilePath(const QString& persistFilePath) {
+    return persistFilePath + JOURNAL_EXTENSION;
+}
+
+bool OctreeUtils::appendJournalRecord(const QString& persistFilePath, const QByteArray& record) {
+    QByteArray compressedRecord;
+    if (!gzip(record, compressedRecord)) {
+        qCritical() << "Unable to gzip journal record";
+        return false;
+    }
+
+    std::lock_guard<std::mutex> journalLock(journalMutex);
+
+    QFile file(journalFilePath(persistFilePath));
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qCritical() << "Cannot open journal for writing:" << file.fileName() << file.errorString();
+        return false;
+    }
+
+    qint64 previousSize = file.size();
+    QDataStream stream(&file);
+    stream << compressedRecord;
+
+    if (stream.status() != QDataStream::Ok || !file.flush()) {
+        // don't leave a partial record in front of the next one
+        qCritical() << "Failed to append journal record to" << file.fileName();
+        file.resize(previousSize);
+        return false;
+    }
+
+    return true;
+}
+
+qint64 OctreeUtils::getJournalSize(const QString& persistFilePath) {
+    std::lock_guard<std::mutex> journalLock(journalMutex);
+    return QFileInfo(journalFilePath(persistFilePath)).size() + QFileInfo(compactingFilePath(persistFilePath)).size();
+}
+
+QList<QByteArray> OctreeUtils::readJournal(const QString& persistFilePath) {
+    std::lock_guard<std::mutex> compactionLock(compactionMutex);
+    return readJournalRecords(compactingFilePath(persistFilePath)) + readJournalRecords(journalFilePath(persistFilePath));
+}
+
+bool OctreeUtils::compactJournal(const QString& persistFilePath) {
+    std::lock_guard<std::mutex> compactionLock(compactionMutex);
+
+    BinarySnapshotHeader header;
+    if (header.readFromFile(persistFilePath)) {
+        qCritical() << "Unable to compact journal," << persistFilePath << "is a binary snapshot";
+        return false;
+    }
+
+    QString journalPath = journalFilePath(persistFilePath);
+    QString compactingPath = compactingFilePath(persistFilePath);
+
+    // move the journal aside so that records can keep being appended while it is folded in
+    {
+        std::lock_guard<std::mutex> journalLock(journalMutex);
+
+        QFile journal(journalPath);
+        if (journal.exists()) {
+            QFile compacting(compactingPath);
+            if (!compacting.exists()) {
+                journal.rename(compactingPath);
+            } else if (journal.open(QIODevice::ReadOnly) && compacting.open(QIODevice::WriteOnly | QIODevice::Append)) {
+                // an earlier compaction was interrupted, fold both at once
+                compacting.write(journal.readAll());
+                compacting.close();
+                journal.remove();
+            }
+        }
+    }
+
+    if (!QFile::exists(compactingPath)) {
+        return true;
+    }
+
+    RawEntityData data;
+    if (!data.readOctreeDataInfoFromFile(persistFilePath)) {
+        qCritical() << "Unable to compact journal, can't read" << persistFilePath;
+        return false;
+    }
+
+    int numRecords = data.applyJournalRecords(readJournalRecords(compactingPath));
+
+    QByteArray contents = persistFilePath.endsWith(".gz") ? data.toGzippedByteArray() : data.toByteArray();
+    QSaveFile file(persistFilePath);
+    if (contents.isEmpty() || !file.open(QIODevice::WriteOnly) || file.write(contents) != contents.size() || !file.commit()) {
+        qCritical() << "Unable to compact journal, can't write" << persistFilePath;
+        return false;
+    }
+
+    QFile::remove(compactingPath);
+    qDebug() << "Compacted" << numRecords << "journal records into" << persistFilePath << "DataVersion" << data.dataVersion;
+    return true;
+}
+
+bool OctreeUtils::writePersistFile(const QString& persistFilePath, const QByteArray& data) {
+    std::lock_guard<std::mutex> compactionLock(compactionMutex);
+
+    QSaveFile file(persistFilePath);
+    if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() || !file.commit()) {
+        qCritical() << "Failed to write" << persistFilePath;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> journalLock(journalMutex);
+    QFile::remove(journalFilePath(persistFilePath));
+    QFile::remove(compactingFilePath(persistFilePath));
+    return true;
+}
+
+const QByteArray OctreeUtils::BinarySnapshotHeader::MAGIC { "OVES" };
+const quint32 OctreeUtils::BinarySnapshotHeader::FORMAT_VERSION { 1 };
+
+void OctreeUtils::BinarySnapshotHeader::write(QByteArray& data) const {
+    QDataStream stream(&data, QIODevice::WriteOnly | QIODevice::Append);
+    stream.writeRawData(MAGIC.constData(), MAGIC.size());
+    stream << formatVersion << contentVersion << id << (qint64)dataVersion << numEntities;
+}
+
+int OctreeUtils::BinarySnapshotHeader::read(const char* data, qint64 size) {
+    if (size < MAGIC.size() || memcmp(data, MAGIC.constData(), MAGIC.size()) != 0) {
+        return -1;
+    }
+
+    QByteArray bytes = QByteArray::fromRawData(data, (int)std::min<qint64>(size, std::numeric_limits<int>::max()));
+    QDataStream stream(bytes);
+    stream.skipRawData(MAGIC.size());
+
+    qint64 version;
+    stream >> formatVersion >> contentVersion >> id >> version >> numEntities;
+    dataVersion = version;
+    if (stream.status() != QDataStream::Ok || formatVersion != FORMAT_VERSION) {
+        return -1;
+    }
+    return (int)stream.device()->pos();
+}
+
+bool OctreeUtils::BinarySnapshotHeader::readFromFile(const QString& path) {
+    const qint64 MAX_HEADER_SIZE = 64;
+
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    QByteArray data = file.read(MAX_HEADER_SIZE);
+    return read(data.constData(), data.size()) > 0;
+}
@@ -51,9 +51,47 @@ public:
     void readSubclassData(const QVariantMap& root) override;
     void writeSubclassData(QByteArray& root) const override;
 
+    // apply journal records written by EntityTree::writeJournalRecord, in order, returns how many were applied
+    int applyJournalRecords(const QList<QByteArray>& records);
+
     QVariantList variantEntityData;
 };
 
+// Incremental persistence: each persist cycle appends a record of what changed to a journal next to
+// the persist file, and compaction folds the journal back into the persist file. Journal operations on
+// the same file are serialized across threads.
+QString journalFilePath(const QString& persistFilePath);
+bool appendJournalRecord(const QString& persistFilePath, const QByteArray& record);
+qint64 getJournalSize(const QString& persistFilePath);
+
+// the records of a journal not yet folded into its persist file, oldest first
+QList<QByteArray> readJournal(const QString& persistFilePath);
+
+// fold any journal into the persist file, a no-op if there is none. Only for JSON persist files, binary snapshots
+// are compacted by writing a new snapshot from the tree.
+bool compactJournal(const QString& persistFilePath);
+
+// replace the persist file, dropping any journal it had
+bool writePersistFile(const QString& persistFilePath, const QByteArray& data);
+
+// Binary snapshots (persist file type "bin") start with this header, followed by the encoded entities.
+// Snapshots written with another content version can't be read, and have to be replaced from the JSON copy.
+struct BinarySnapshotHeader {
+    static const QByteArray MAGIC;
+    static const quint32 FORMAT_VERSION;
+
+    quint32 formatVersion { FORMAT_VERSION };
+    PacketVersion contentVersion { 0 };
+    QUuid id;
+    Version dataVersion { INITIAL_VERSION };
+    quint32 numEntities { 0 };
+
+    void write(QByteArray& data) const;
+    // returns the size of the header, or -1 if the data isn't a binary snapshot
+    int read(const char* data, qint64 size);
+    bool readFromFile(const QString& path);
+};
+
 }
 
 #endif // hifi_OctreeDataUtils_h
\ No newline at end of file
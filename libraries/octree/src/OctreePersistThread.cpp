@@ -27,6 +27,7 @@
 #include <QJsonObject>
 #include <QJsonDocument>
 #include <QRegExp>
+#include <QtConcurrent/QtConcurrentRun>
 
 #include <NumericalConstants.h>
 #include <PerfStat.h>
@@ -40,6 +41,9 @@
 constexpr std::chrono::seconds OctreePersistThread::DEFAULT_PERSIST_INTERVAL { 30 };
 constexpr std::chrono::milliseconds TIME_BETWEEN_PROCESSING { 10 };
 
+// journal records are folded back into the persist file every this many persists
+constexpr int JOURNAL_RECORDS_PER_COMPACTION { 20 };
+
 constexpr int MAX_OCTREE_REPLACEMENT_BACKUP_FILES_COUNT { 20 };
 constexpr int64_t MAX_OCTREE_REPLACEMENT_BACKUP_FILES_SIZE_BYTES { 50 * 1000 * 1000 };
 
@@ -66,16 +70,52 @@ void OctreePersistThread::start() {
     auto& packetReceiver = DependencyManager::get<NodeList>()->getPacketReceiver();
     packetReceiver.registerListener(PacketType::OctreeDataFileReply,
         PacketReceiver::makeUnsourcedListenerReference<OctreePersistThread>(this, &OctreePersistThread::handleOctreeDataFileReply));
+    packetReceiver.registerListener(PacketType::OctreeDataPersistJournalRejected,
+        PacketReceiver::makeUnsourcedListenerReference<OctreePersistThread>(this,
+            &OctreePersistThread::handleOctreeDataPersistJournalRejected));
 
     auto nodeList = DependencyManager::get<NodeList>();
     const DomainHandler& domainHandler = nodeList->getDomainHandler();
 
     auto packet = NLPacket::create(PacketType::OctreeDataFileRequest, -1, true, false);
 
+    if (!isBinary()) {
+        // fold in the changes journaled since the last compaction, so the file holds the latest data
+        OctreeUtils::compactJournal(_filename);
+    }
+
     OctreeUtils::RawOctreeData data;
     qCDebug(octree) << "Reading octree data from" << _filename;
     QFile file(_filename);
-    if (file.open(QIODevice::ReadOnly)) {
+    if (isBinary()) {
+        // only the header is needed for now, the snapshot itself is mapped once the DS agrees it is current
+        OctreeUtils::BinarySnapshotHeader header;
+        if (header.readFromFile(_filename) && header.contentVersion == _tree->expectedVersion()) {
+            OctreeUtils::RawEntityData snapshotData;
+            snapshotData.id = header.id;
+            snapshotData.dataVersion = header.dataVersion;
+
+            // what was journaled since the snapshot is part of the current data too
+            _cachedJournal = OctreeUtils::readJournal(_filename);
+            snapshotData.applyJournalRecords(_cachedJournal);
+
+            qCDebug(octree) << "Current octree data: ID(" << snapshotData.id << ") DataVersion(" << snapshotData.dataVersion << ")";
+            packet->writePrimitive(true);
+            auto id = snapshotData.id.toRfc4122();
+            packet->write(id);
+            packet->writePrimitive(snapshotData.dataVersion);
+        } else if (readJSONToMigrate(data)) {
+            qCDebug(octree) << "No usable binary snapshot found, creating it from" << _jsonFilenameToMigrate;
+            qCDebug(octree) << "Current octree data: ID(" << data.id << ") DataVersion(" << data.dataVersion << ")";
+            packet->writePrimitive(true);
+            auto id = data.id.toRfc4122();
+            packet->write(id);
+            packet->writePrimitive(data.dataVersion);
+        } else {
+            qCWarning(octree) << "No usable binary snapshot found";
+            packet->writePrimitive(false);
+        }
+    } else if (file.open(QIODevice::ReadOnly)) {
         QByteArray jsonData(file.readAll());
         file.close();
         if (!gunzip(jsonData, _cachedJSONData)) {
@@ -102,6 +142,40 @@ void OctreePersistThread::start() {
     nodeList->sendPacket(std::move(packet), domainHandler.getSockAddr());
 }
 
+bool OctreePersistThread::readJSONToMigrate(OctreeUtils::RawOctreeData& data) {
+    // the JSON persist file the binary snapshot replaces, from before the file type was changed
+    QString jsonFilename = fileNameWithoutExtension(_filename, PERSIST_EXTENSIONS) + ".json.gz";
+    OctreeUtils::compactJournal(jsonFilename);
+
+    QFile file(jsonFilename);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QByteArray jsonData(file.readAll());
+    file.close();
+    if (!gunzip(jsonData, _cachedJSONData)) {
+        _cachedJSONData = jsonData;
+    }
+
+    if (!data.readOctreeDataInfoFromData(_cachedJSONData)) {
+        _cachedJSONData.clear();
+        return false;
+    }
+
+    _jsonFilenameToMigrate = jsonFilename;
+    return true;
+}
+
+void OctreePersistThread::handleOctreeDataPersistJournalRejected(QSharedPointer<ReceivedMessage> message) {
+    // the DS lost a journal record, so its copy misses changes until it gets the whole tree again
+    if (!_needsWholeTreePersist) {
+        qCWarning(octree) << "DS rejected a journal record - persisting the whole tree";
+        _needsWholeTreePersist = true;
+        _tree->setDirtyBit();
+    }
+}
+
 void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessage> message) {
     if (_initialLoadComplete) {
         qCWarning(octree) << "Received OctreeDataFileReply after initial load had completed";
@@ -116,9 +190,23 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     if (includesNewData) {
         _cachedJSONData.clear();
         replacementData = message->readAll();
-        replaceData(replacementData);
-        hasValidOctreeData = data.readOctreeDataInfoFromFile(_filename);
+        if (isBinary()) {
+            // the DS only deals in JSON, load it from memory and write it out as a snapshot once it is in the tree
+            backupCurrentFile();
+            _cachedJournal.clear();
+            _jsonFilenameToMigrate.clear();
+            if (!gunzip(replacementData, _cachedJSONData)) {
+                _cachedJSONData = replacementData;
+            }
+            hasValidOctreeData = data.readOctreeDataInfoFromData(_cachedJSONData);
+        } else {
+            replaceData(replacementData);
+            hasValidOctreeData = data.readOctreeDataInfoFromFile(_filename);
+        }
         qDebug() << "Got OctreeDataFileReply, new data sent";
+    } else if (isBinary() && _jsonFilenameToMigrate.isEmpty()) {
+        // the snapshot carries its own version info
+        qDebug() << "Got OctreeDataFileReply, current binary snapshot is sufficient";
     } else {
         qDebug() << "Got OctreeDataFileReply, current entity data is sufficient";
         
@@ -130,13 +218,16 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
                 qCDebug(octree) << "Current octree data has a null id, updating";
                 data.resetIdAndVersion();
 
+                // a binary snapshot gets the new id when it is written from the loaded data
                 QFile file(_filename);
-                if (file.open(QIODevice::WriteOnly)) {
-                    auto entityData = data.toGzippedByteArray();
-                    file.write(entityData);
-                    file.close();
-                } else {
-                    qCDebug(octree) << "Failed to update octree data";
+                if (!isBinary()) {
+                    if (file.open(QIODevice::WriteOnly)) {
+                        auto entityData = data.toGzippedByteArray();
+                        file.write(entityData);
+                        file.close();
+                    } else {
+                        qCDebug(octree) << "Failed to update octree data";
+                    }
                 }
             }
         }
@@ -154,7 +245,13 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     _tree->withWriteLock([&] {
         PerformanceWarning warn(true, "Loading Octree File", true);
 
-        if (_cachedJSONData.isEmpty()) {
+        if (isBinary() && _cachedJSONData.isEmpty()) {
+            persistentFileRead = _tree->readFromBinaryFile(_filename);
+            if (persistentFileRead && !_cachedJournal.empty()) {
+                int numApplied = _tree->applyJournalRecords(_cachedJournal);
+                qCDebug(octree) << "Replayed" << numApplied << "of" << _cachedJournal.size() << "journal records";
+            }
+        } else if (_cachedJSONData.isEmpty()) {
             persistentFileRead = _tree->readFromFile(_filename.toLocal8Bit().constData());
         } else {
             QDataStream jsonStream(_cachedJSONData);
@@ -168,6 +265,25 @@ void OctreePersistThread::handleOctreeDataFileReply(QSharedPointer<ReceivedMessa
     _loadTimeUSecs = loadDone - loadStarted;
 
     _tree->clearDirtyBit(); // the tree is clean since we just loaded it
+    _tree->resetJournal();
+
+    // the first persist writes the whole tree, so that the persist file holds whatever was folded in while loading
+    _needsWholeTreePersist = true;
+
+    // a binary snapshot can only be written from the tree, so fold in the data from the DS, the journal or the JSON
+    // persist file it replaces now
+    if (isBinary() && (!replacementData.isNull() || !_cachedJournal.empty() || !_jsonFilenameToMigrate.isEmpty())) {
+        if (writeBinarySnapshot() && !_jsonFilenameToMigrate.isEmpty()) {
+            // keep the JSON persist file out of the way, it would be stale if the file type was changed back
+            auto migratedFilename = _jsonFilenameToMigrate + ".migrated";
+            QFile::remove(migratedFilename);
+            if (QFile::rename(_jsonFilenameToMigrate, migratedFilename)) {
+                qCDebug(octree) << "Moved" << _jsonFilenameToMigrate << "to" << migratedFilename;
+            }
+        }
+    }
+    _cachedJournal.clear();
+    _jsonFilenameToMigrate.clear();
 
     unsigned long nodeCount = OctreeElement::getNodeCount();
     unsigned long internalNodeCount = OctreeElement::getInternalNodeCount();
@@ -207,16 +323,18 @@ QString OctreePersistThread::getPersistFileMimeType() const {
         return "application/json";
     } if (_persistAsFileType == "json.gz") {
         return "application/zip";
+    } if (isBinary()) {
+        return "application/octet-stream";
     }
     return "";
 }
 
 void OctreePersistThread::replaceData(QByteArray data) {
+    // the backup should include the journaled changes
+    OctreeUtils::compactJournal(_filename);
     backupCurrentFile();
 
-    QFile currentFile { _filename };
-    if (currentFile.open(QIODevice::WriteOnly)) {
-        currentFile.write(data);
+    if (OctreeUtils::writePersistFile(_filename, data)) {
         qDebug() << "Wrote replacement data";
     } else {
         qWarning() << "Failed to write replacement data";
@@ -254,17 +372,30 @@ void OctreePersistThread::process() {
         persist();
     }
 
+    if (_numJournalRecords >= JOURNAL_RECORDS_PER_COMPACTION) {
+        compactJournal();
+    }
+
     QTimer::singleShot(TIME_BETWEEN_PROCESSING.count(), this, &OctreePersistThread::process);
 }
 
 void OctreePersistThread::aboutToFinish() {
     qCDebug(octree) << "Persist thread about to finish...";
     persist();
+    _compaction.waitForFinished();
     qCDebug(octree) << "Persist thread done with about to finish...";
 }
 
 QByteArray OctreePersistThread::getPersistFileContents() const {
     QByteArray fileContents;
+    if (isBinary()) {
+        // the snapshot file lacks what has been journaled since it was written, so encode the tree instead
+        _tree->writeToBinary(fileContents);
+        return fileContents;
+    }
+
+    OctreeUtils::compactJournal(_filename);
+
     QFile file(_filename);
     if (file.open(QIODevice::ReadOnly)) {
         fileContents = file.readAll();
@@ -304,38 +435,112 @@ void OctreePersistThread::cleanupOldReplacementBackups() {
 
 void OctreePersistThread::persist() {
     if (_tree->isDirty() && _initialLoadComplete) {
+        _tree->clearDirtyBit();
+        _tree->incrementPersistDataVersion();
 
-        _tree->withWriteLock([&] {
-            qCDebug(octree) << "pruning Octree before saving...";
-            _tree->pruneTree();
-            qCDebug(octree) << "DONE pruning Octree before saving...";
-        });
+        // only write what changed since the last persist, unless that can't capture the changes (e.g. the tree was cleared)
+        QByteArray record;
+        if (!_needsWholeTreePersist && _tree->writeJournalRecord(record)) {
+            if (record.isEmpty()) {
+                return;
+            }
 
-        _tree->incrementPersistDataVersion();
+            if (OctreeUtils::appendJournalRecord(_filename, record)) {
+                ++_numJournalRecords;
+                sendJournalRecordToDS(record);
+                return;
+            }
 
-        qCDebug(octree) << "Saving Octree data to:" << _filename;
-        if (_tree->writeToFile(_filename.toLocal8Bit().constData(), nullptr, _persistAsFileType)) {
-            _tree->clearDirtyBit(); // tree is clean after saving
-            qCDebug(octree) << "DONE persisting Octree data to" << _filename;
-        } else {
-            qCWarning(octree) << "Failed to persist Octree data to" << _filename;
+            qCWarning(octree) << "Failed to journal Octree data to" << _filename << "- persisting the whole tree";
         }
 
-        sendLatestEntityDataToDS();
+        _needsWholeTreePersist = !persistWholeTree();
+    }
+}
+
+bool OctreePersistThread::persistWholeTree() {
+    _tree->withWriteLock([&] {
+        qCDebug(octree) << "pruning Octree before saving...";
+        _tree->pruneTree();
+        qCDebug(octree) << "DONE pruning Octree before saving...";
+    });
+
+    // edits made from here on go to the next journal record
+    _tree->resetJournal();
+
+    bool doGzip = _persistAsFileType == "json.gz";
+    QByteArray data;
+
+    qCDebug(octree) << "Saving Octree data to:" << _filename;
+    bool encoded = isBinary() ? _tree->writeToBinary(data) : _tree->toJSON(&data, nullptr, doGzip);
+    if (!encoded || !OctreeUtils::writePersistFile(_filename, data)) {
+        qCWarning(octree) << "Failed to persist Octree data to" << _filename;
+        _tree->setDirtyBit();
+        return false;
+    }
+    qCDebug(octree) << "DONE persisting Octree data to" << _filename;
+
+    _numJournalRecords = 0;
+    sendLatestEntityDataToDS(doGzip ? data : QByteArray());
+    return true;
+}
+
+void OctreePersistThread::compactJournal() {
+    if (_compaction.isRunning()) {
+        return;
     }
+
+    _tree->withWriteLock([&] {
+        _tree->pruneTree();
+    });
+
+    // a binary snapshot can't be patched, but the tree already holds everything the journal does
+    if (isBinary()) {
+        _numJournalRecords = 0;
+        writeBinarySnapshot();
+        return;
+    }
+
+    // the persist file is rewritten in the background, while new records go to a fresh journal
+    _numJournalRecords = 0;
+    QString filename = _filename;
+    _compaction = QtConcurrent::run([filename] {
+        return OctreeUtils::compactJournal(filename);
+    });
 }
 
-void OctreePersistThread::sendLatestEntityDataToDS() {
+bool OctreePersistThread::writeBinarySnapshot() {
+    // only this thread appends to the journal, so nothing can be journaled between encoding and writing
+    QByteArray data;
+    if (!_tree->writeToBinary(data) || !OctreeUtils::writePersistFile(_filename, data)) {
+        qCWarning(octree) << "Failed to write binary snapshot to" << _filename;
+        return false;
+    }
+
+    _numJournalRecords = 0;
+    qCDebug(octree) << "Wrote binary snapshot to" << _filename << (data.size() / 1000) << "kbytes";
+    return true;
+}
+
+void OctreePersistThread::sendLatestEntityDataToDS(QByteArray gzippedData) {
     qDebug() << "Sending latest entity data to DS";
     auto nodeList = DependencyManager::get<NodeList>();
     const DomainHandler& domainHandler = nodeList->getDomainHandler();
 
-    QByteArray data;
-    if (_tree->toJSON(&data, nullptr, true)) {
+    if (!gzippedData.isEmpty() || _tree->toJSON(&gzippedData, nullptr, true)) {
         auto message = NLPacketList::create(PacketType::OctreeDataPersist, QByteArray(), true, true);
-        message->write(data);
+        message->write(gzippedData);
         nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
     } else {
         qCWarning(octree) << "Failed to persist octree to DS";
     }
 }
+
+void OctreePersistThread::sendJournalRecordToDS(const QByteArray& record) {
+    auto nodeList = DependencyManager::get<NodeList>();
+    const DomainHandler& domainHandler = nodeList->getDomainHandler();
+
+    auto message = NLPacketList::create(PacketType::OctreeDataPersistJournal, QByteArray(), true, true);
+    message->write(record);
+    nodeList->sendPacketList(std::move(message), domainHandler.getSockAddr());
+}
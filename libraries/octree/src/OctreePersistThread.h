@@ -15,9 +15,11 @@
 #define hifi_OctreePersistThread_h
 
 #include <QString>
+#include <QtCore/QFuture>
 #include <QtCore/QSharedPointer>
 #include <GenericThread.h>
 #include "Octree.h"
+#include "OctreeDataUtils.h"
 
 class OctreePersistThread : public QObject {
     Q_OBJECT
@@ -57,14 +59,22 @@ signals:
 protected slots:
     void process();
     void handleOctreeDataFileReply(QSharedPointer<ReceivedMessage> message);
+    void handleOctreeDataPersistJournalRejected(QSharedPointer<ReceivedMessage> message);
 
 protected:
     void persist();
+    bool persistWholeTree();
+    void compactJournal();
+    bool writeBinarySnapshot();
+    bool isBinary() const { return _persistAsFileType == "bin"; }
+    // reads the JSON persist file a binary snapshot is to replace, returns false if there is none
+    bool readJSONToMigrate(OctreeUtils::RawOctreeData& data);
     bool backupCurrentFile();
     void cleanupOldReplacementBackups();
 
     void replaceData(QByteArray data);
-    void sendLatestEntityDataToDS();
+    void sendLatestEntityDataToDS(QByteArray gzippedData = QByteArray());
+    void sendJournalRecordToDS(const QByteArray& record);
 
 private:
     OctreePointer _tree;
@@ -80,6 +90,12 @@ private:
 
     QString _persistAsFileType;
     QByteArray _cachedJSONData;
+    QList<QByteArray> _cachedJournal; // replayed on top of a binary snapshot once it is loaded
+    QString _jsonFilenameToMigrate; // the JSON persist file the binary snapshot is created from
+
+    bool _needsWholeTreePersist { false };
+    int _numJournalRecords { 0 };
+    QFuture<bool> _compaction;
 };
 
 #endif // hifi_OctreePersistThread_h
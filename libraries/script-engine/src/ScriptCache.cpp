@@ -22,8 +22,14 @@
 #include <QThread>
 #include <QRegularExpression>
 #include <QMetaEnum>
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDirIterator>
+#include <QFile>
+#include <QSaveFile>
 
 #include <assert.h>
+#include <PathUtils.h>
 #include <ResourceCache.h>
 #include <SharedUtil.h>
 
@@ -34,8 +40,14 @@
 const QString ScriptCache::STATUS_INLINE { "Inline" };
 const QString ScriptCache::STATUS_CACHED { "Cached" };
 
-ScriptCache::ScriptCache(QObject* parent) {
-    // nothing to do here...
+static const int MAX_CODE_CACHE_MEMORY = 64 * 1024 * 1024; // bytes
+// code that hasn't been used for this long is removed from the directory
+static const qint64 MAX_CODE_CACHE_FILE_AGE = 30LL * 24 * 60 * 60; // seconds
+
+ScriptCache::ScriptCache(QObject* parent) :
+    _codeCache(MAX_CODE_CACHE_MEMORY),
+    _codeCacheDirectory(PathUtils::getAppLocalDataPath() + "scriptCodeCache/")
+{
 }
 
 void ScriptCache::clearCache() {
@@ -43,6 +55,122 @@ void ScriptCache::clearCache() {
     _scriptCache.clear();
 }
 
+QDir ScriptCache::getPrunedCodeCacheDirectory() {
+    QDir directory;
+    bool needsPrune;
+    {
+        Lock lock(_codeCacheLock);
+        directory = _codeCacheDirectory;
+        needsPrune = !_codeCacheDirectoryPruned;
+        _codeCacheDirectoryPruned = true;
+    }
+    // the first user prunes, the others go on without waiting for it
+    if (needsPrune) {
+        pruneCodeCacheDirectory(directory);
+    }
+    return directory;
+}
+
+QByteArray ScriptCache::getCodeCache(const QByteArray& key) {
+    {
+        Lock lock(_codeCacheLock);
+        auto cached = _codeCache.object(key);
+        if (cached) {
+            ++_numCodeCacheHits;
+            return *cached;
+        }
+    }
+
+    QDir directory = getPrunedCodeCacheDirectory();
+
+    QFile file(codeCacheFilePath(directory, key));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    QByteArray code = file.readAll();
+    file.close();
+    // remember when the code was last used so that pruning keeps it
+    if (file.open(QIODevice::ReadWrite)) {
+        file.setFileTime(QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+    }
+
+    if (!code.isEmpty()) {
+        ++_numCodeCacheHits;
+        Lock lock(_codeCacheLock);
+        _codeCache.insert(key, new QByteArray(code), code.size());
+    }
+    return code;
+}
+
+void ScriptCache::setCodeCache(const QByteArray& key, const QByteArray& code) {
+    if (code.isEmpty() || code.size() > MAX_CODE_CACHE_MEMORY) {
+        return;
+    }
+
+    {
+        Lock lock(_codeCacheLock);
+        _codeCache.insert(key, new QByteArray(code), code.size());
+    }
+
+    QDir directory = getPrunedCodeCacheDirectory();
+
+    if (!directory.exists() && !directory.mkpath(".")) {
+        return;
+    }
+    // the file is renamed into place, so readers on other threads never see half of it
+    QSaveFile file(codeCacheFilePath(directory, key));
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(code);
+        if (!file.commit()) {
+            qCDebug(scriptengine) << "Could not write script code cache" << file.fileName();
+        }
+    }
+}
+
+void ScriptCache::rejectCodeCache(const QByteArray& key) {
+    ++_numCodeCacheRejections;
+    QDir directory;
+    {
+        Lock lock(_codeCacheLock);
+        _codeCache.remove(key);
+        directory = _codeCacheDirectory;
+    }
+    QFile::remove(codeCacheFilePath(directory, key));
+}
+
+QString ScriptCache::getCodeCacheDirectory() const {
+    Lock lock(_codeCacheLock);
+    return _codeCacheDirectory.path();
+}
+
+void ScriptCache::setCodeCacheDirectory(const QString& path) {
+    Lock lock(_codeCacheLock);
+    _codeCache.clear();
+    _codeCacheDirectory.setPath(path);
+    _codeCacheDirectoryPruned = false;
+}
+
+QString ScriptCache::codeCacheFilePath(const QDir& directory, const QByteArray& key) {
+    // keys can be anything, file names can't
+    auto name = QCryptographicHash::hash(key, QCryptographicHash::Sha256).toHex();
+    return directory.filePath(QString::fromLatin1(name));
+}
+
+void ScriptCache::pruneCodeCacheDirectory(const QDir& directory) {
+    auto oldest = QDateTime::currentDateTime().addSecs(-MAX_CODE_CACHE_FILE_AGE);
+    int numRemoved = 0;
+    QDirIterator it(directory.path(), QDir::Files);
+    while (it.hasNext()) {
+        it.next();
+        if (it.fileInfo().lastModified() < oldest && QFile::remove(it.filePath())) {
+            ++numRemoved;
+        }
+    }
+    if (numRemoved > 0) {
+        qCDebug(scriptengine) << "Removed" << numRemoved << "unused entries from the script code cache";
+    }
+}
+
 void ScriptCache::clearATPScriptsFromCache() {
     Lock lock(_containerLock);
     qCDebug(scriptengine) << "Clearing ATP scripts from ScriptCache";
@@ -17,7 +17,12 @@
 #ifndef hifi_ScriptCache_h
 #define hifi_ScriptCache_h
 
+#include <atomic>
 #include <mutex>
+
+#include <QtCore/QCache>
+#include <QtCore/QDir>
+
 #include <DependencyManager.h>
 
 using contentAvailableCallback = std::function<void(const QString& scriptOrURL, const QString& contents, bool isURL, bool contentAvailable, const QString& status)>;
@@ -58,15 +63,41 @@ public:
 
     void deleteScript(const QUrl& unnormalizedURL);
 
+    // Compiled code of script sources, so that engines can skip compiling a source they have seen before.
+    // The key is chosen by the engine and must cover the source and everything else the code depends on,
+    // such as the engine version. Entries are kept in memory and in a directory that persists between runs.
+    // The directory is read and written outside of the lock, so that engines on other threads aren't held up by the disk.
+    QByteArray getCodeCache(const QByteArray& key);
+    void setCodeCache(const QByteArray& key, const QByteArray& code);
+    // called by engines when the code of a key didn't match their source or flags, drops the entry
+    void rejectCodeCache(const QByteArray& key);
+
+    QString getCodeCacheDirectory() const;
+    void setCodeCacheDirectory(const QString& path);
+
+    int getNumCodeCacheHits() const { return _numCodeCacheHits; }
+    int getNumCodeCacheRejections() const { return _numCodeCacheRejections; }
+
 private:
     void scriptContentAvailable(int maxRetries); // new version
     ScriptCache(QObject* parent = NULL);
+
+    static QString codeCacheFilePath(const QDir& directory, const QByteArray& key);
+    static void pruneCodeCacheDirectory(const QDir& directory);
+    QDir getPrunedCodeCacheDirectory();
     
     Mutex _containerLock;
     QMap<QUrl, ScriptRequest> _activeScriptRequests;
     
     QHash<QUrl, QVariantMap> _scriptCache;
     QMultiMap<QUrl, ScriptUser*> _scriptUsers;
+
+    mutable Mutex _codeCacheLock;
+    QCache<QByteArray, QByteArray> _codeCache; // cost is in bytes
+    QDir _codeCacheDirectory;
+    bool _codeCacheDirectoryPruned { false };
+    std::atomic<int> _numCodeCacheHits { 0 };
+    std::atomic<int> _numCodeCacheRejections { 0 };
 };
 
 #endif // hifi_ScriptCache_h
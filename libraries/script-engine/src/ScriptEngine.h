@@ -423,6 +423,13 @@ public:
      */
     virtual void stopProfilingAndSave() = 0;
 
+    /**
+     * @brief Turns the cache of the property names used from C++ on or off, it is on by default.
+     *
+     * For benchmarks that compare conversions of native values with how they were before the cache.
+     */
+    virtual void setPropertyNameCacheEnabled(bool enabled) = 0;
+
 public:
     // helper to detect and log warnings when other code invokes QScriptEngine/BaseScriptEngine in thread-unsafe ways
     bool IS_THREADSAFE_INVOCATION(const QString& method);
@@ -933,6 +933,7 @@ void ScriptManager::run() {
     _lastUpdate = usecTimestampNow();
 
     std::chrono::microseconds totalUpdates(0);
+    std::chrono::microseconds lastTotalTimerExecution = _totalTimerExecution;
 
     qCDebug(scriptengine) << "Waiting for finish";
 
@@ -1024,6 +1025,7 @@ void ScriptManager::run() {
         }
 
         qint64 now = usecTimestampNow();
+        std::chrono::microseconds frameExecution(0);
 
         // we check for 'now' in the past in case people set their clock back
         if (_emitScriptUpdates() && _lastUpdate < now) {
@@ -1036,11 +1038,17 @@ void ScriptManager::run() {
                 }
                 auto postUpdate = clock::now();
                 auto elapsed = (postUpdate - preUpdate);
+                frameExecution += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
                 totalUpdates += std::chrono::duration_cast<std::chrono::microseconds>(elapsed);
             }
         }
         _lastUpdate = now;
 
+        // timers fired while this frame was processing events
+        frameExecution += _totalTimerExecution - lastTotalTimerExecution;
+        lastTotalTimerExecution = _totalTimerExecution;
+        emit frameExecuted(frameExecution.count());
+
         // only clear exceptions if we are not in the middle of evaluating
         if (!_engine->isEvaluating() && _engine->hasUncaughtException()) {
             qCWarning(scriptengine) << __FUNCTION__ << "---------- UNCAUGHT EXCEPTION --------";
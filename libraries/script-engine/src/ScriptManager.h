@@ -1241,6 +1241,16 @@ signals:
      */
     void update(float deltaTime);
 
+    /**
+     * @brief Triggered after each frame of the script loop, with the time the frame spent running the script.
+     *
+     * Only counts the update handlers and the timers, unlike the deltaTime of update() which is the wall-clock
+     * time between frames.
+     *
+     * @param executionUsecs Time spent in update handlers and timer callbacks during the frame, in microseconds
+     */
+    void frameExecuted(quint64 executionUsecs);
+
 
 
     /**
@@ -296,6 +296,7 @@ bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3) {
 }
 #endif
 
+#ifndef CONVERSIONS_OPTIMIZED_FOR_V8
 ScriptValue u8vec3ToScriptValue(ScriptEngine* engine, const glm::u8vec3& vec3) {
     auto prototype = engine->globalObject().property("__hifi_u8vec3__");
     if (!prototype.property("defined").toBool()) {
@@ -320,6 +321,7 @@ ScriptValue u8vec3ToScriptValue(ScriptEngine* engine, const glm::u8vec3& vec3) {
     value.setPrototype(prototype);
     return value;
 }
+#endif
 
 ScriptValue u8vec3ColorToScriptValue(ScriptEngine* engine, const glm::u8vec3& vec3) {
     auto prototype = engine->globalObject().property("__hifi_u8vec3_color__");
@@ -346,6 +348,7 @@ ScriptValue u8vec3ColorToScriptValue(ScriptEngine* engine, const glm::u8vec3& ve
     return value;
 }
 
+#ifndef CONVERSIONS_OPTIMIZED_FOR_V8
 bool u8vec3FromScriptValue(const ScriptValue& object, glm::u8vec3& vec3) {
     if (object.isNumber()) {
         vec3 = glm::vec3(object.toVariant().toUInt());
@@ -394,6 +397,7 @@ bool u8vec3FromScriptValue(const ScriptValue& object, glm::u8vec3& vec3) {
     }
     return true;
 }
+#endif
 
 ScriptValue vec4toScriptValue(ScriptEngine* engine, const glm::vec4& vec4) {
     ScriptValue obj = engine->newObject();
@@ -492,6 +496,7 @@ bool qVectorVec3FromScriptValue(const ScriptValue& array, QVector<glm::vec3>& ve
     return true;
 }
 
+#ifndef CONVERSIONS_OPTIMIZED_FOR_V8
 ScriptValue quatToScriptValue(ScriptEngine* engine, const glm::quat& quat) {
     ScriptValue obj = engine->newObject();
     if (quat.x != quat.x || quat.y != quat.y || quat.z != quat.z || quat.w != quat.w) {
@@ -534,6 +539,7 @@ bool quatFromScriptValue(const ScriptValue& object, glm::quat& quat) {
     }
     return true;
 }
+#endif
 
 ScriptValue qVectorQuatToScriptValue(ScriptEngine* engine, const QVector<glm::quat>& vector) {
     ScriptValue array = engine->newArray();
@@ -11,6 +11,8 @@
 
 #include "FastScriptValueUtils.h"
 
+#include <cfloat>
+
 #include <qcolor.h>
 
 #include "../ScriptEngine.h"
@@ -19,101 +21,50 @@
 
 #ifdef CONVERSIONS_OPTIMIZED_FOR_V8
 
-ScriptValue vec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3) {
-    ScriptValue value = engine->newObject();
-
-    ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(value);
-
-    auto engineV8 = proxy->getV8Engine();
-
+// Creates an object with x, y and z properties and the vec3 prototype, must be called with the isolate locked
+static ScriptValue newVec3Value(ScriptEngineV8* engineV8, double x, double y, double z) {
     auto isolate = engineV8->getIsolate();
-    v8::Locker locker(isolate);
-    v8::Isolate::Scope isolateScope(isolate);
-    v8::HandleScope handleScope(isolate);
     auto context = engineV8->getContext();
-    v8::Context::Scope contextScope(engineV8->getContext());
-    V8ScriptValue v8ScriptValue = proxy->toV8Value();
-    v8::Local<v8::Object> v8Object = v8::Local<v8::Object>::Cast(v8ScriptValue.get());
-
-    v8::Local<v8::Value> prototype;
-    bool hasPrototype = false;
-
-    if (context->Global()->Get(context, v8::String::NewFromUtf8(isolate, "__hifi_vec3__").ToLocalChecked()).ToLocal(&prototype)) {
-        if (!prototype->IsNullOrUndefined() && prototype->IsObject()) {
-            v8::Local<v8::Object> prototypeObject = v8::Local<v8::Object>::Cast(prototype);
-            v8::Local<v8::Value> isDefined;
-            if (prototypeObject->Get(context, v8::String::NewFromUtf8(isolate, "defined").ToLocalChecked()).ToLocal(&isDefined)) {
-                if ((!isDefined->IsNullOrUndefined()) && isDefined->BooleanValue(isolate)) {
-                    hasPrototype = true;
-                }
-            }
-        }
-    }
-
-    if (!hasPrototype) {
-        QString sourceCode("globalThis.__hifi_vec3__ = Object.defineProperties({}, { "
-        "defined: { value: true },"
-        "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
-        "1: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
-        "2: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
-        "r: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
-        "g: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
-        "b: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
-        "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
-        "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
-        "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
-        "})");
-        v8::TryCatch tryCatch(isolate);
-        v8::ScriptOrigin scriptOrigin(isolate, v8::String::NewFromUtf8(isolate, "Vec3prototype").ToLocalChecked());
-        v8::Local<v8::Script> script;
-        if (!v8::Script::Compile(context, v8::String::NewFromUtf8(isolate, sourceCode.toStdString().c_str()).ToLocalChecked(), &scriptOrigin).ToLocal(&script)) {
-            Q_ASSERT(false);
-        }
-        v8::Local<v8::Value> result;
-        if (!script->Run(context).ToLocal(&result)) {
-            Q_ASSERT(false);
-        }
-        if (!context->Global()->Get(context, v8::String::NewFromUtf8(isolate, "__hifi_vec3__").ToLocalChecked()).ToLocal(&prototype)) {
-            Q_ASSERT(false);
-        }
-        Q_ASSERT(!tryCatch.HasCaught());
-        qDebug() <<"vec3ToScriptValue: creating prototype";
-    }
+    v8::Local<v8::Object> v8Object = v8::Object::New(isolate);
 
-    if (!v8Object->Set(context, v8::String::NewFromUtf8(isolate, "x").ToLocalChecked(), v8::Number::New(isolate, vec3.x)).FromMaybe(false)) {
-        Q_ASSERT(false);
-    }
-    if (!v8Object->Set(context, v8::String::NewFromUtf8(isolate, "y").ToLocalChecked(), v8::Number::New(isolate, vec3.y)).FromMaybe(false)) {
+    // set the prototype first, so that all vec3 values share the same hidden class transitions
+    if (!v8Object->SetPrototype(context, engineV8->getVec3Prototype()).FromMaybe(false)) {
         Q_ASSERT(false);
     }
-    if (!v8Object->Set(context, v8::String::NewFromUtf8(isolate, "z").ToLocalChecked(), v8::Number::New(isolate, vec3.z)).FromMaybe(false)) {
+    // the prototype only has accessors for the aliases, so the data properties can be created without a lookup
+    if (!v8Object->CreateDataProperty(context, engineV8->getPropertyName(QStringLiteral("x")), v8::Number::New(isolate, x)).FromMaybe(false) ||
+        !v8Object->CreateDataProperty(context, engineV8->getPropertyName(QStringLiteral("y")), v8::Number::New(isolate, y)).FromMaybe(false) ||
+        !v8Object->CreateDataProperty(context, engineV8->getPropertyName(QStringLiteral("z")), v8::Number::New(isolate, z)).FromMaybe(false)) {
         Q_ASSERT(false);
     }
+    return ScriptValue(new ScriptValueV8Wrapper(engineV8, V8ScriptValue(engineV8, v8Object)));
+}
 
-    if (!v8Object->SetPrototype(context, prototype).FromMaybe(false)) {
-        Q_ASSERT(false);
+// Reads the first of the given properties that is defined, must be called with the isolate locked
+static v8::Local<v8::Value> getFirstDefined(ScriptEngineV8* engineV8, v8::Local<v8::Object> v8Object,
+                                            std::initializer_list<QString> names) {
+    auto context = engineV8->getContext();
+    v8::Local<v8::Value> value;
+    for (const auto& name : names) {
+        if (!v8Object->Get(context, engineV8->getPropertyName(name)).ToLocal(&value)) {
+            Q_ASSERT(false);
+            return v8::Undefined(engineV8->getIsolate());
+        }
+        if (!value->IsNullOrUndefined()) {
+            return value;
+        }
     }
     return value;
 }
 
-bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3) {
-    ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(object);
-
-    auto engineV8 = proxy->getV8Engine();
-
+// Reads a vec3 from a number, a color name, an array of three numbers or an object with x/r/red, y/g/green and
+// z/b/blue properties, must be called with the isolate locked
+static bool readVec3(ScriptEngineV8* engineV8, v8::Local<v8::Value> v8Value, glm::dvec3& vec3) {
     auto isolate = engineV8->getIsolate();
-    v8::Locker locker(isolate);
-    v8::Isolate::Scope isolateScope(isolate);
-    v8::HandleScope handleScope(isolate);
     auto context = engineV8->getContext();
-    v8::Context::Scope contextScope(engineV8->getContext());
-    V8ScriptValue v8ScriptValue = proxy->toV8Value();
-
-    v8::Local<v8::Value> v8Value = v8ScriptValue.get();
-
 
     if (v8Value->IsNumber()) {
-        vec3 = glm::vec3(v8Value->NumberValue(context).ToChecked());
+        vec3 = glm::dvec3(v8Value->NumberValue(context).ToChecked());
     } else if (v8Value->IsString()) {
         QColor qColor(QString(*v8::String::Utf8Value(isolate, v8::Local<v8::String>::Cast(v8Value))));
         if (qColor.isValid()) {
@@ -139,73 +90,166 @@ bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3) {
             if (xValue->IsNullOrUndefined() || yValue->IsNullOrUndefined() || zValue->IsNullOrUndefined()) {
                 return false;
             }
-            double x,y,z;
-            if (!xValue->NumberValue(context).To(&x)
-                || !yValue->NumberValue(context).To(&y)
-                || !zValue->NumberValue(context).To(&z)) {
+            if (!xValue->NumberValue(context).To(&vec3.x)
+                || !yValue->NumberValue(context).To(&vec3.y)
+                || !zValue->NumberValue(context).To(&vec3.z)) {
                 return false;
             }
-
-            vec3.x = xValue->NumberValue(context).FromMaybe(0.0);
-            vec3.y = yValue->NumberValue(context).FromMaybe(0.0);
-            vec3.z = zValue->NumberValue(context).FromMaybe(0.0);
         } else {
             return false;
         }
     } else if (v8Value->IsObject()) {
         v8::Local<v8::Object> v8Object = v8::Local<v8::Object>::Cast(v8Value);
-        v8::Local<v8::Value> xValue;
-        if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "x").ToLocalChecked()).ToLocal(&xValue)) {
-            Q_ASSERT(false);
-        }
-        if (xValue->IsNullOrUndefined()) {
-            if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "r").ToLocalChecked()).ToLocal(&xValue)) {
-                Q_ASSERT(false);
-            }
-        }
-        if (xValue->IsNullOrUndefined()) {
-            if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "red").ToLocalChecked()).ToLocal(&xValue)) {
-                Q_ASSERT(false);
-            }
-        }
+        auto xValue = getFirstDefined(engineV8, v8Object, { QStringLiteral("x"), QStringLiteral("r"), QStringLiteral("red") });
+        auto yValue = getFirstDefined(engineV8, v8Object, { QStringLiteral("y"), QStringLiteral("g"), QStringLiteral("green") });
+        auto zValue = getFirstDefined(engineV8, v8Object, { QStringLiteral("z"), QStringLiteral("b"), QStringLiteral("blue") });
 
-        v8::Local<v8::Value> yValue;
-        if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "y").ToLocalChecked()).ToLocal(&yValue)) {
-            Q_ASSERT(false);
-        }
-        if (yValue->IsNullOrUndefined()) {
-            if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "g").ToLocalChecked()).ToLocal(&yValue)) {
-                Q_ASSERT(false);
-            }
-        }
-        if (yValue->IsNullOrUndefined()) {
-            if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "green").ToLocalChecked()).ToLocal(&yValue)) {
-                Q_ASSERT(false);
-            }
+        vec3.x = xValue->NumberValue(context).FromMaybe(0.0);
+        vec3.y = yValue->NumberValue(context).FromMaybe(0.0);
+        vec3.z = zValue->NumberValue(context).FromMaybe(0.0);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+ScriptValue vec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3) {
+    auto engineV8 = static_cast<ScriptEngineV8*>(engine);
+    auto isolate = engineV8->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    v8::Context::Scope contextScope(engineV8->getContext());
+    return newVec3Value(engineV8, vec3.x, vec3.y, vec3.z);
+}
+
+bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3) {
+    ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(object);
+    if (!proxy) {
+        return false;
+    }
+
+    auto engineV8 = proxy->getV8Engine();
+
+    auto isolate = engineV8->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    v8::Context::Scope contextScope(engineV8->getContext());
+
+    glm::dvec3 result;
+    if (!readVec3(engineV8, proxy->toV8Value().constGet(), result)) {
+        return false;
+    }
+    vec3 = result;
+    return true;
+}
+
+ScriptValue u8vec3ToScriptValue(ScriptEngine* engine, const glm::u8vec3& vec3) {
+    auto engineV8 = static_cast<ScriptEngineV8*>(engine);
+    auto isolate = engineV8->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    v8::Context::Scope contextScope(engineV8->getContext());
+    // u8vec3 values have the same accessors as vec3 values
+    return newVec3Value(engineV8, vec3.x, vec3.y, vec3.z);
+}
+
+bool u8vec3FromScriptValue(const ScriptValue& object, glm::u8vec3& vec3) {
+    ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(object);
+    if (!proxy) {
+        return true;
+    }
+
+    auto engineV8 = proxy->getV8Engine();
+
+    auto isolate = engineV8->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    v8::Context::Scope contextScope(engineV8->getContext());
+
+    // like the generic conversion, arrays and strings that can't be read leave the color as it was
+    v8::Local<v8::Value> v8Value = proxy->toV8Value().constGet();
+    glm::dvec3 result;
+    if (v8Value->IsNullOrUndefined()) {
+        vec3 = glm::u8vec3(0);
+    } else if (readVec3(engineV8, v8Value, result)) {
+        // rounded and wrapped around like QVariant::toUInt in the generic conversion, e.g. 256 is 0 and -1 is 255
+        for (int i = 0; i < 3; i++) {
+            vec3[i] = (uint8_t)(result[i] != result[i] ? 0 : (quint64)qRound64(result[i]));
         }
+    }
+    return true;
+}
 
-        v8::Local<v8::Value> zValue;
-        if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "z").ToLocalChecked()).ToLocal(&zValue)) {
+ScriptValue quatToScriptValue(ScriptEngine* engine, const glm::quat& quat) {
+    auto engineV8 = static_cast<ScriptEngineV8*>(engine);
+    auto isolate = engineV8->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    auto context = engineV8->getContext();
+    v8::Context::Scope contextScope(context);
+
+    v8::Local<v8::Object> v8Object = v8::Object::New(isolate);
+    // if quat contains a NaN don't try to convert it
+    if (!(quat.x != quat.x || quat.y != quat.y || quat.z != quat.z || quat.w != quat.w)) {
+        if (!v8Object->CreateDataProperty(context, engineV8->getPropertyName(QStringLiteral("x")), v8::Number::New(isolate, quat.x)).FromMaybe(false) ||
+            !v8Object->CreateDataProperty(context, engineV8->getPropertyName(QStringLiteral("y")), v8::Number::New(isolate, quat.y)).FromMaybe(false) ||
+            !v8Object->CreateDataProperty(context, engineV8->getPropertyName(QStringLiteral("z")), v8::Number::New(isolate, quat.z)).FromMaybe(false) ||
+            !v8Object->CreateDataProperty(context, engineV8->getPropertyName(QStringLiteral("w")), v8::Number::New(isolate, quat.w)).FromMaybe(false)) {
             Q_ASSERT(false);
         }
-        if (zValue->IsNullOrUndefined()) {
-            if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "b").ToLocalChecked()).ToLocal(&zValue)) {
-                Q_ASSERT(false);
-            }
-        }
-        if (zValue->IsNullOrUndefined()) {
-            if (!v8Object->Get(context, v8::String::NewFromUtf8(isolate, "blue").ToLocalChecked()).ToLocal(&zValue)) {
-                Q_ASSERT(false);
-            }
-        }
+    }
+    return ScriptValue(new ScriptValueV8Wrapper(engineV8, V8ScriptValue(engineV8, v8Object)));
+}
 
-        vec3.x = xValue->NumberValue(context).FromMaybe(0.0);
-        vec3.y = yValue->NumberValue(context).FromMaybe(0.0);
-        vec3.z = zValue->NumberValue(context).FromMaybe(0.0);
-    } else {
+bool quatFromScriptValue(const ScriptValue& object, glm::quat& quat) {
+    ScriptValueV8Wrapper *proxy = ScriptValueV8Wrapper::unwrap(object);
+    if (!proxy) {
         return false;
     }
+
+    auto engineV8 = proxy->getV8Engine();
+
+    auto isolate = engineV8->getIsolate();
+    v8::Locker locker(isolate);
+    v8::Isolate::Scope isolateScope(isolate);
+    v8::HandleScope handleScope(isolate);
+    auto context = engineV8->getContext();
+    v8::Context::Scope contextScope(context);
+
+    v8::Local<v8::Value> v8Value = proxy->toV8Value().constGet();
+    if (!v8Value->IsObject()) {
+        return false;
+    }
+    v8::Local<v8::Object> v8Object = v8::Local<v8::Object>::Cast(v8Value);
+
+    v8::Local<v8::Value> xValue, yValue, zValue, wValue;
+    if (!v8Object->Get(context, engineV8->getPropertyName(QStringLiteral("x"))).ToLocal(&xValue) ||
+        !v8Object->Get(context, engineV8->getPropertyName(QStringLiteral("y"))).ToLocal(&yValue) ||
+        !v8Object->Get(context, engineV8->getPropertyName(QStringLiteral("z"))).ToLocal(&zValue) ||
+        !v8Object->Get(context, engineV8->getPropertyName(QStringLiteral("w"))).ToLocal(&wValue)) {
+        return false;
+    }
+    if (xValue->IsUndefined() || yValue->IsUndefined() || zValue->IsUndefined() || wValue->IsUndefined()) {
+        return false;
+    }
+    quat.x = (float)xValue->NumberValue(context).FromMaybe(0.0);
+    quat.y = (float)yValue->NumberValue(context).FromMaybe(0.0);
+    quat.z = (float)zValue->NumberValue(context).FromMaybe(0.0);
+    quat.w = (float)wValue->NumberValue(context).FromMaybe(0.0);
+
+    // enforce normalized quaternion
+    float length = glm::length(quat);
+    if (length > FLT_EPSILON) {
+        quat /= length;
+    } else {
+        quat = glm::quat();
+    }
     return true;
 }
 
-#endif
\ No newline at end of file
+#endif
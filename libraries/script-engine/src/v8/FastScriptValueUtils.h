@@ -27,6 +27,14 @@
 ScriptValue vec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3);
 
 bool vec3FromScriptValue(const ScriptValue& object, glm::vec3& vec3);
+
+ScriptValue u8vec3ToScriptValue(ScriptEngine* engine, const glm::u8vec3& vec3);
+
+bool u8vec3FromScriptValue(const ScriptValue& object, glm::u8vec3& vec3);
+
+ScriptValue quatToScriptValue(ScriptEngine* engine, const glm::quat& quat);
+
+bool quatFromScriptValue(const ScriptValue& object, glm::quat& quat);
 #endif
 
 #endif  // overte_FastScriptValueUtils_h
@@ -19,6 +19,7 @@
 #include <thread>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QEventLoop>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTimer>
@@ -44,6 +45,7 @@
 
 #include <v8-profiler.h>
 
+#include "../ScriptCache.h"
 #include "../ScriptEngineLogging.h"
 #include "../ScriptProgram.h"
 #include "../ScriptEngineCast.h"
@@ -689,7 +691,7 @@ ScriptValue ScriptEngineV8::evaluate(const QString& sourceCode, const QString& f
     v8::Local<v8::Script> script;
     {
         v8::TryCatch tryCatch(getIsolate());
-        if (!v8::Script::Compile(getContext(), v8::String::NewFromUtf8(getIsolate(), sourceCode.toStdString().c_str()).ToLocalChecked(), &scriptOrigin).ToLocal(&script)) {
+        if (!compileScript(sourceCode, scriptOrigin).ToLocal(&script)) {
             QString errorMessage(QString("Error while compiling script: \"") + fileName + QString("\" ") + formatErrorMessageFromTryCatch(tryCatch));
             if (_manager) {
                 _manager->scriptErrorMessage(errorMessage);
@@ -784,6 +786,47 @@ void ScriptEngineV8::setUncaughtException(std::shared_ptr<ScriptException> uncau
     emit exception(copy);
 }
 
+v8::MaybeLocal<v8::Script> ScriptEngineV8::compileScript(const QString& sourceCode, v8::ScriptOrigin& scriptOrigin) {
+    // compiling short snippets is quicker than looking them up
+    static const int MIN_CODE_CACHE_SOURCE_LENGTH = 1024;
+
+    auto context = getContext();
+    auto sourceString = v8::String::NewFromUtf8(_v8Isolate, sourceCode.toStdString().c_str()).ToLocalChecked();
+    if (sourceCode.length() < MIN_CODE_CACHE_SOURCE_LENGTH || !DependencyManager::isSet<ScriptCache>()) {
+        return v8::Script::Compile(context, sourceString, &scriptOrigin);
+    }
+
+    // the code is only valid for the V8 version and flags that produced it, V8 checks the flags itself
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(QByteArray(v8::V8::GetVersion()));
+    hash.addData(sourceCode.toUtf8());
+    auto key = QByteArray("v8:") + hash.result();
+
+    auto scriptCache = DependencyManager::get<ScriptCache>();
+    QByteArray code = scriptCache->getCodeCache(key);
+    v8::Local<v8::Script> script;
+    if (!code.isEmpty()) {
+        // the source takes ownership of the cached data, which doesn't own the code
+        auto cachedData = new v8::ScriptCompiler::CachedData(reinterpret_cast<const uint8_t*>(code.constData()), code.size());
+        v8::ScriptCompiler::Source source(sourceString, scriptOrigin, cachedData);
+        if (!v8::ScriptCompiler::Compile(context, &source, v8::ScriptCompiler::kConsumeCodeCache).ToLocal(&script)) {
+            return v8::MaybeLocal<v8::Script>();
+        }
+        if (!source.GetCachedData()->rejected) {
+            return script;
+        }
+        // V8 compiled the source instead, the code is replaced below
+        scriptCache->rejectCodeCache(key);
+    } else if (!v8::Script::Compile(context, sourceString, &scriptOrigin).ToLocal(&script)) {
+        return v8::MaybeLocal<v8::Script>();
+    }
+
+    std::unique_ptr<v8::ScriptCompiler::CachedData> newCode(v8::ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    if (newCode && newCode->length > 0) {
+        scriptCache->setCodeCache(key, QByteArray(reinterpret_cast<const char*>(newCode->data), newCode->length));
+    }
+    return script;
+}
 
 QString ScriptEngineV8::formatErrorMessageFromTryCatch(v8::TryCatch &tryCatch) {
     v8::Locker locker(_v8Isolate);
@@ -873,6 +916,59 @@ v8::Local<v8::ObjectTemplate> ScriptEngineV8::getVariantProxyTemplate() {
     return handleScope.Escape(_variantProxyTemplate.Get(_v8Isolate));
 }
 
+v8::Local<v8::String> ScriptEngineV8::getPropertyName(const QString& name) {
+    // names normally come from C++ code, so there are only so many, but don't let generated ones grow the cache forever
+    static const int MAX_CACHED_PROPERTY_NAMES = 4096;
+
+    if (!_isPropertyNameCacheEnabled) {
+        return v8::String::NewFromUtf8(_v8Isolate, name.toStdString().c_str(), v8::NewStringType::kNormal).ToLocalChecked();
+    }
+
+    auto it = _propertyNameIndices.constFind(name);
+    if (it != _propertyNameIndices.constEnd()) {
+        return _propertyNames[it.value()].Get(_v8Isolate);
+    }
+
+    auto string = v8::String::NewFromUtf8(_v8Isolate, name.toStdString().c_str(), v8::NewStringType::kInternalized).ToLocalChecked();
+    if ((int)_propertyNames.size() < MAX_CACHED_PROPERTY_NAMES) {
+        _propertyNameIndices.insert(name, (int)_propertyNames.size());
+        _propertyNames.emplace_back(_v8Isolate, string);
+    }
+    return string;
+}
+
+v8::Local<v8::Object> ScriptEngineV8::getVec3Prototype() {
+    v8::EscapableHandleScope handleScope(_v8Isolate);
+    if (_vec3Prototype.IsEmpty()) {
+        auto context = getContext();
+        QString sourceCode("globalThis.__hifi_vec3__ = Object.defineProperties({}, { "
+            "defined: { value: true },"
+            "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "1: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "2: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
+            "r: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "g: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "b: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
+            "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
+            "})");
+        v8::TryCatch tryCatch(_v8Isolate);
+        v8::ScriptOrigin scriptOrigin(_v8Isolate, v8::String::NewFromUtf8(_v8Isolate, "Vec3prototype").ToLocalChecked());
+        v8::Local<v8::Script> script;
+        v8::Local<v8::Value> prototype;
+        if (!v8::Script::Compile(context, v8::String::NewFromUtf8(_v8Isolate, sourceCode.toStdString().c_str()).ToLocalChecked(), &scriptOrigin).ToLocal(&script) ||
+            !script->Run(context).ToLocal(&prototype) || !prototype->IsObject()) {
+            Q_ASSERT(false);
+            return handleScope.Escape(v8::Object::New(_v8Isolate));
+        }
+        Q_ASSERT(!tryCatch.HasCaught());
+        _vec3Prototype.Reset(_v8Isolate, v8::Local<v8::Object>::Cast(prototype));
+    }
+
+    return handleScope.Escape(_vec3Prototype.Get(_v8Isolate));
+}
+
 
 ScriptContextV8Pointer ScriptEngineV8::pushContext(v8::Local<v8::Context> context) {
     v8::HandleScope handleScope(_v8Isolate);
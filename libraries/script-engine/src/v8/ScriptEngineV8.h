@@ -20,6 +20,7 @@
 #define hifi_ScriptEngineV8_h
 
 #include <memory>
+#include <vector>
 
 #include <QtCore/QByteArray>
 #include <QtCore/QHash>
@@ -141,6 +142,7 @@ public:  // ScriptEngine implementation
     virtual void dumpHeapObjectStatistics() override;
     virtual void startProfiling() override;
     virtual void stopProfilingAndSave() override;
+    virtual void setPropertyNameCacheEnabled(bool enabled) override { _isPropertyNameCacheEnabled = enabled; }
     void scheduleValueWrapperForDeletion(ScriptValueV8Wrapper* wrapper) {_scriptValueWrappersToDelete.enqueue(wrapper);}
     void deleteUnusedValueWrappers();
     virtual void perManagerLoopIterationCleanup() override;
@@ -186,6 +188,9 @@ public: // not for public use, but I don't like how Qt strings this along with p
     v8::Local<v8::Context> getContext();
     const v8::Local<v8::Context> getConstContext() const;
     QString formatErrorMessageFromTryCatch(v8::TryCatch &tryCatch);
+    // Compiles a script, skipping the compilation when ScriptCache has code for the same source from an earlier compile,
+    // must be called with the isolate locked and a context entered
+    v8::MaybeLocal<v8::Script> compileScript(const QString& sourceCode, v8::ScriptOrigin& scriptOrigin);
     // Useful for debugging
     virtual QStringList getCurrentScriptURLs() const override;
 
@@ -207,6 +212,12 @@ public: // not for public use, but I don't like how Qt strings this along with p
     v8::Local<v8::ObjectTemplate> getVariantDataTemplate();
     v8::Local<v8::ObjectTemplate> getVariantProxyTemplate();
 
+    // Internalized strings for the property names used from C++, so that a name isn't converted and hashed
+    // again on every access. Needs a handle scope.
+    v8::Local<v8::String> getPropertyName(const QString& name);
+    // Prototype of vec3 and u8vec3 values, gives them array style and color style accessors
+    v8::Local<v8::Object> getVec3Prototype();
+
     ScriptContextV8Pointer pushContext(v8::Local<v8::Context> context);
     void popContext();
     void storeGlobalObjectContents();
@@ -264,6 +275,11 @@ protected:
     v8::Persistent<v8::ObjectTemplate> _variantDataTemplate;
     v8::Persistent<v8::ObjectTemplate> _variantProxyTemplate;
 
+    QHash<QString, int> _propertyNameIndices;
+    std::vector<v8::Global<v8::String>> _propertyNames;
+    bool _isPropertyNameCacheEnabled { true };
+    v8::Persistent<v8::Object> _vec3Prototype;
+
 public:
     volatile int _memoryCorruptionIndicator = 12345678;
 private:
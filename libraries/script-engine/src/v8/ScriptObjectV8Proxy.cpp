@@ -718,7 +718,6 @@ ScriptVariantV8Proxy::~ScriptVariantV8Proxy() {
 }
 
 V8ScriptValue ScriptVariantV8Proxy::newVariant(ScriptEngineV8* engine, const QVariant& variant, V8ScriptValue proto) {
-    qDebug() << "ScriptVariantV8Proxy::newVariant";
     auto isolate = engine->getIsolate();
     v8::Locker locker(isolate);
     v8::Isolate::Scope isolateScope(isolate);
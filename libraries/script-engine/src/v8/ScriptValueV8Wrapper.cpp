@@ -270,7 +270,7 @@ bool ScriptValueV8Wrapper::hasProperty(const QString& name) const {
     if (_value.constGet()->IsObject()) {
     //V8TODO: what about flags?
         v8::Local<v8::Value> resultLocal;
-        v8::Local<v8::String> key = v8::String::NewFromUtf8(isolate, name.toStdString().c_str(),v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::String> key = _engine->getPropertyName(name);
         const v8::Local<v8::Object> object = v8::Local<v8::Object>::Cast(_value.constGet());
         //V8TODO: Which context?
         if (object->Get(_engine->getContext(), key).ToLocal(&resultLocal)) {
@@ -296,7 +296,7 @@ ScriptValue ScriptValueV8Wrapper::property(const QString& name, const ScriptValu
     if (_value.constGet()->IsObject()) {
     //V8TODO: what about flags?
         v8::Local<v8::Value> resultLocal;
-        v8::Local<v8::String> key = v8::String::NewFromUtf8(_engine->getIsolate(), name.toStdString().c_str(),v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::String> key = _engine->getPropertyName(name);
         const v8::Local<v8::Object> object = v8::Local<v8::Object>::Cast(_value.constGet());
         //V8TODO: Which context?
         lock.lockForRead();
@@ -400,7 +400,7 @@ void ScriptValueV8Wrapper::setProperty(const QString& name, const ScriptValue& v
         return;
     }
     if(_value.constGet()->IsObject()) {
-        v8::Local<v8::String> key = v8::String::NewFromUtf8(isolate, name.toStdString().c_str(),v8::NewStringType::kNormal).ToLocalChecked();
+        v8::Local<v8::String> key = _engine->getPropertyName(name);
         Q_ASSERT(_value.get()->IsObject());
         auto object = v8::Local<v8::Object>::Cast(_value.get());
         lock.lockForRead();
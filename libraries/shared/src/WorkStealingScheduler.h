@@ -0,0 +1,198 @@
+//
+//  WorkStealingScheduler.h
+//  libraries/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#pragma once
+
+#ifndef hifi_WorkStealingScheduler_h
+#define hifi_WorkStealingScheduler_h
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include "PortableHighResolutionClock.h"
+
+// Schedules one run's worth of tasks over a fixed set of workers.
+//   Tasks are dealt heaviest first to the least loaded worker, using a cost hint per task
+//   (typically what the same task cost on the previous run). Each worker then drains its own deque
+//   from the front, and once it is empty steals from the back of the other workers' deques.
+//
+//   push, distribute and clear must be called from a single thread while no worker is running.
+//   run may be called concurrently, once per worker index.
+template <typename T>
+class WorkStealingScheduler {
+public:
+    using Cost = uint64_t; // nanoseconds
+
+    struct WorkerStats {
+        Cost busyTime { 0 };
+        Cost idleTime { 0 }; // left to the caller, which knows the wall time of each run
+        int numTasks { 0 };
+        int numStolen { 0 };
+    };
+
+    void setNumWorkers(int numWorkers) {
+        assert(numWorkers >= 0);
+        _workers.resize(numWorkers);
+        for (auto& worker : _workers) {
+            if (!worker) {
+                worker.reset(new Worker);
+            }
+        }
+    }
+    int getNumWorkers() const { return (int)_workers.size(); }
+
+    void clear() {
+        _tasks.clear();
+        _costs.clear();
+        for (auto& worker : _workers) {
+            worker->tasks.clear();
+            worker->size.store(0, std::memory_order_relaxed);
+            worker->stats = WorkerStats();
+        }
+    }
+
+    // a hint of 0 means the cost is unknown, it will be estimated from the other hints
+    void push(const T& task, Cost costHint) {
+        _tasks.push_back(task);
+        _costs.push_back(costHint);
+    }
+
+    void distribute() {
+        if (_workers.empty()) {
+            return;
+        }
+
+        // estimate unknown costs as the mean of the known ones
+        Cost knownCost = 0;
+        int numKnown = 0;
+        for (Cost cost : _costs) {
+            if (cost > 0) {
+                knownCost += cost;
+                ++numKnown;
+            }
+        }
+        Cost unknownCost = numKnown > 0 ? std::max<Cost>(knownCost / numKnown, 1) : 1;
+        for (Cost& cost : _costs) {
+            if (cost == 0) {
+                cost = unknownCost;
+            }
+        }
+
+        // deal the heaviest tasks first, each to the least loaded worker
+        std::vector<int> order(_tasks.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return _costs[a] > _costs[b];
+        });
+
+        std::vector<Cost> loads(_workers.size(), 0);
+        for (int taskIndex : order) {
+            auto leastLoaded = std::min_element(loads.begin(), loads.end()) - loads.begin();
+            _workers[leastLoaded]->tasks.push_back(taskIndex);
+            loads[leastLoaded] += _costs[taskIndex];
+        }
+
+        for (auto& worker : _workers) {
+            worker->size.store((int)worker->tasks.size(), std::memory_order_release);
+        }
+    }
+
+    // run tasks on behalf of the given worker until none are left, timing each of them
+    template <typename F>
+    void run(int workerIndex, F&& function) {
+        auto& stats = _workers[workerIndex]->stats;
+
+        int taskIndex;
+        while (tryPop(workerIndex, taskIndex)) {
+            auto start = p_high_resolution_clock::now();
+            function(_tasks[taskIndex]);
+            auto end = p_high_resolution_clock::now();
+
+            Cost cost = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+            _costs[taskIndex] = std::max<Cost>(cost, 1);
+            stats.busyTime += cost;
+            ++stats.numTasks;
+        }
+    }
+
+    // results of the last run, valid once every worker has returned from run
+    int getNumTasks() const { return (int)_tasks.size(); }
+    const T& getTask(int taskIndex) const { return _tasks[taskIndex]; }
+    Cost getTaskCost(int taskIndex) const { return _costs[taskIndex]; }
+    const WorkerStats& getWorkerStats(int workerIndex) const { return _workers[workerIndex]->stats; }
+
+    bool isEmpty() const {
+        return std::all_of(_workers.begin(), _workers.end(), [](const std::unique_ptr<Worker>& worker) {
+            return worker->size.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+private:
+    using Mutex = std::mutex;
+    using Lock = std::unique_lock<Mutex>;
+
+    struct Worker {
+        Mutex mutex;
+        std::deque<int> tasks; // guarded by mutex
+        std::atomic<int> size { 0 };
+        WorkerStats stats; // only written by the worker itself
+    };
+
+    bool tryPop(int workerIndex, int& taskIndex) {
+        // the front of our own deque holds our heaviest remaining task...
+        if (pop(*_workers[workerIndex], true, taskIndex)) {
+            return true;
+        }
+
+        // ...and once it is empty, steal the lightest remaining tasks of the others
+        int numWorkers = (int)_workers.size();
+        for (int i = 1; i < numWorkers; ++i) {
+            if (pop(*_workers[(workerIndex + i) % numWorkers], false, taskIndex)) {
+                ++_workers[workerIndex]->stats.numStolen;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool pop(Worker& worker, bool fromFront, int& taskIndex) {
+        if (worker.size.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+
+        Lock lock(worker.mutex);
+        if (worker.tasks.empty()) {
+            return false;
+        }
+
+        if (fromFront) {
+            taskIndex = worker.tasks.front();
+            worker.tasks.pop_front();
+        } else {
+            taskIndex = worker.tasks.back();
+            worker.tasks.pop_back();
+        }
+        worker.size.store((int)worker.tasks.size(), std::memory_order_release);
+        return true;
+    }
+
+    std::vector<T> _tasks;
+    std::vector<Cost> _costs; // hints until distributed, measured costs once run
+    std::vector<std::unique_ptr<Worker>> _workers;
+};
+
+#endif // hifi_WorkStealingScheduler_h
@@ -0,0 +1,62 @@
+//
+//  AudioHRTFTests.cpp
+//  tests/audio/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "AudioHRTFTests.h"
+
+#include <cmath>
+#include <cstdlib>
+
+#include "AudioHRTF.h"
+
+QTEST_MAIN(AudioHRTFTests)
+
+void AudioHRTFTests::renderBatchMatchesRender() {
+    const int NUM_SOURCES = 5;
+    const int NUM_BLOCKS = 20;
+    const int HRTF_DATASET_INDEX = 1;
+    const float TOLERANCE = 1.0e-5f;
+
+    AudioHRTF singleHRTFs[NUM_SOURCES];
+    AudioHRTF batchHRTFs[NUM_SOURCES];
+    int16_t input[NUM_SOURCES][HRTF_BLOCK];
+    float floatInput[NUM_SOURCES][HRTF_BLOCK];
+    float singleOutput[2 * HRTF_BLOCK];
+    float batchOutput[2 * HRTF_BLOCK];
+
+    srand(1);
+    for (int block = 0; block < NUM_BLOCKS; block++) {
+        for (int j = 0; j < NUM_SOURCES; j++) {
+            for (int i = 0; i < HRTF_BLOCK; i++) {
+                input[j][i] = (int16_t)((rand() % 20000) - 10000);
+                floatInput[j][i] = (float)input[j][i] / 32768.0f;
+            }
+        }
+
+        // both paths accumulate into existing output
+        std::fill(std::begin(singleOutput), std::end(singleOutput), 0.1f);
+        std::fill(std::begin(batchOutput), std::end(batchOutput), 0.1f);
+
+        AudioHRTF::RenderJob jobs[NUM_SOURCES];
+        for (int j = 0; j < NUM_SOURCES; j++) {
+            // move sources over time, through both the near-field and far-field filters
+            float azimuth = 0.3f * j + 0.01f * block;
+            float distance = 0.5f + j + 0.1f * block;
+            float gain = 0.5f;
+
+            singleHRTFs[j].render(input[j], singleOutput, HRTF_DATASET_INDEX, azimuth, distance, gain, HRTF_BLOCK);
+            jobs[j] = { &batchHRTFs[j], floatInput[j], azimuth, distance, gain };
+        }
+        AudioHRTF::renderBatch(jobs, NUM_SOURCES, batchOutput, HRTF_DATASET_INDEX, HRTF_BLOCK);
+
+        for (int i = 0; i < 2 * HRTF_BLOCK; i++) {
+            QVERIFY(fabsf(singleOutput[i] - batchOutput[i]) < TOLERANCE);
+        }
+    }
+}
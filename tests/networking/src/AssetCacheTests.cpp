@@ -0,0 +1,114 @@
+//
+//  AssetCacheTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "AssetCacheTests.h"
+
+#include "AssetCache.h"
+
+QTEST_MAIN(AssetCacheTests)
+
+// with this budget assets of up to 100 bytes are cached
+static const qint64 BUDGET = 800;
+static const int ENTRY_SIZE = 100;
+
+static QString hashOf(int i) {
+    return QString("hash%1").arg(i);
+}
+
+static QByteArray dataOf(int i, int size = ENTRY_SIZE) {
+    return QByteArray(size, (char)('a' + i));
+}
+
+// inserts the asset the way the transfer threads do, after missing on it
+static void missAndInsert(AssetCache& cache, int i, int size = ENTRY_SIZE) {
+    quint64 generation = 0;
+    QVERIFY(cache.get(hashOf(i), generation).isNull());
+    cache.insert(hashOf(i), dataOf(i, size), generation);
+}
+
+void AssetCacheTests::hitMissTest() {
+    AssetCache cache;
+    cache.setBudget(BUDGET);
+    QCOMPARE(cache.getMaxEntrySize(), (qint64)ENTRY_SIZE);
+
+    missAndInsert(cache, 0);
+    QCOMPARE(cache.getNumMisses(), (quint64)1);
+    QCOMPARE(cache.getNumEntries(), 1);
+    QCOMPARE(cache.getSize(), (qint64)ENTRY_SIZE);
+
+    quint64 generation = 0;
+    QCOMPARE(cache.get(hashOf(0), generation), dataOf(0));
+    QCOMPARE(cache.getNumHits(), (quint64)1);
+    QVERIFY(cache.get(hashOf(1), generation).isNull());
+    QCOMPARE(cache.getNumMisses(), (quint64)2);
+
+    cache.remove(hashOf(0));
+    QVERIFY(cache.get(hashOf(0), generation).isNull());
+    QCOMPARE(cache.getNumEntries(), 0);
+    QCOMPARE(cache.getSize(), (qint64)0);
+
+    // without a budget nothing is cached
+    cache.setBudget(0);
+    missAndInsert(cache, 0);
+    QCOMPARE(cache.getNumEntries(), 0);
+}
+
+void AssetCacheTests::evictionTest() {
+    AssetCache cache;
+    cache.setBudget(BUDGET);
+
+    const int NUM_FITTING = BUDGET / ENTRY_SIZE;
+    for (int i = 0; i < NUM_FITTING; ++i) {
+        missAndInsert(cache, i);
+    }
+    QCOMPARE(cache.getNumEntries(), NUM_FITTING);
+    QCOMPARE(cache.getNumEvictions(), (quint64)0);
+
+    // using the first asset makes the second one the least recently used
+    quint64 generation = 0;
+    QCOMPARE(cache.get(hashOf(0), generation), dataOf(0));
+    missAndInsert(cache, NUM_FITTING);
+    QCOMPARE(cache.getNumEntries(), NUM_FITTING);
+    QCOMPARE(cache.getNumEvictions(), (quint64)1);
+    QCOMPARE(cache.getSize(), BUDGET);
+    QVERIFY(!cache.get(hashOf(0), generation).isNull());
+    QVERIFY(cache.get(hashOf(1), generation).isNull());
+    QVERIFY(!cache.get(hashOf(NUM_FITTING), generation).isNull());
+
+    // too big to be cached
+    missAndInsert(cache, NUM_FITTING + 1, ENTRY_SIZE + 1);
+    QVERIFY(cache.get(hashOf(NUM_FITTING + 1), generation).isNull());
+    QCOMPARE(cache.getNumEntries(), NUM_FITTING);
+
+    // a smaller budget evicts down to it
+    cache.setBudget(BUDGET / 2);
+    QVERIFY(cache.getSize() <= BUDGET / 2);
+    QCOMPARE(cache.getNumEntries(), NUM_FITTING / 2);
+    QVERIFY(!cache.get(hashOf(NUM_FITTING), generation).isNull());
+}
+
+void AssetCacheTests::removedWhileReadTest() {
+    AssetCache cache;
+    cache.setBudget(BUDGET);
+
+    // the asset's file is deleted, and its hash removed, while a transfer thread reads it after a miss
+    quint64 generation = 0;
+    QVERIFY(cache.get(hashOf(0), generation).isNull());
+    cache.remove(hashOf(0));
+    cache.insert(hashOf(0), dataOf(0), generation);
+    QVERIFY(cache.get(hashOf(0), generation).isNull());
+    QCOMPARE(cache.getNumEntries(), 0);
+
+    // the miss above came after the removal, so its read is inserted
+    cache.insert(hashOf(0), dataOf(0), generation);
+    QCOMPARE(cache.get(hashOf(0), generation), dataOf(0));
+    QCOMPARE(cache.getNumEntries(), 1);
+}
@@ -0,0 +1,30 @@
+//
+//  AssetCacheTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_AssetCacheTests_h
+#define overte_AssetCacheTests_h
+
+#include <QtTest/QtTest>
+
+class AssetCacheTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that inserted assets are hits, and that others and removed ones are misses
+    void hitMissTest();
+
+    // Test that the least recently used assets are evicted to stay within the budget, and that big ones aren't cached
+    void evictionTest();
+
+    // Test that an asset read after a miss isn't inserted if an entry was removed since the miss
+    void removedWhileReadTest();
+};
+
+#endif // overte_AssetCacheTests_h
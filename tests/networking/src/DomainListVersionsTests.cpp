@@ -0,0 +1,131 @@
+//
+//  DomainListVersionsTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "DomainListVersionsTests.h"
+
+#include <limits>
+
+#include <DomainListVersions.h>
+
+QTEST_MAIN(DomainListVersionsTests)
+
+void DomainListVersionsTests::versionWraparoundTest() {
+    QCOMPARE(DomainListVersions::next(0), (quint32)1);
+    QCOMPARE(DomainListVersions::next(41), (quint32)42);
+    QCOMPARE(DomainListVersions::next(std::numeric_limits<quint32>::max()), (quint32)1);
+
+    // a list of changes to the last list before the wraparound applies on top of it
+    DomainListTracker tracker;
+    tracker.addPacket(std::numeric_limits<quint32>::max(), 0, 1, 1);
+    QCOMPARE(tracker.getVersion(), std::numeric_limits<quint32>::max());
+    tracker.addPacket(1, std::numeric_limits<quint32>::max(), 1, 1);
+    QCOMPARE(tracker.getVersion(), (quint32)1);
+}
+
+void DomainListVersionsTests::changesSinceTest() {
+    QUuid nodeA = QUuid::createUuid();
+    QUuid nodeB = QUuid::createUuid();
+
+    DomainListChanges changes;
+    QCOMPARE(changes.recordChange(nodeA), (DomainListChanges::Version)1);
+    QCOMPARE(changes.recordChange(nodeB), (DomainListChanges::Version)2);
+    QCOMPARE(changes.recordChange(nodeA), (DomainListChanges::Version)3);
+    QCOMPARE(changes.getVersion(), (DomainListChanges::Version)3);
+
+    QSet<QUuid> changedNodes;
+    QVERIFY(changes.getChangesSince(0, changedNodes));
+    QCOMPARE(changedNodes, QSet<QUuid>({ nodeA, nodeB }));
+
+    changedNodes.clear();
+    QVERIFY(changes.getChangesSince(2, changedNodes));
+    QCOMPARE(changedNodes, QSet<QUuid>({ nodeA }));
+
+    changedNodes.clear();
+    QVERIFY(changes.getChangesSince(3, changedNodes));
+    QVERIFY(changedNodes.isEmpty());
+}
+
+void DomainListVersionsTests::droppedChangesTest() {
+    QUuid nodeA = QUuid::createUuid();
+    QUuid nodeB = QUuid::createUuid();
+    QUuid nodeC = QUuid::createUuid();
+
+    DomainListChanges changes(2);
+    changes.recordChange(nodeA);
+    changes.recordChange(nodeB);
+    changes.recordChange(nodeC);
+
+    // the change to node A was dropped, so a node that only has the lists before it needs a full list
+    QSet<QUuid> changedNodes;
+    QVERIFY(!changes.getChangesSince(0, changedNodes));
+
+    QVERIFY(changes.getChangesSince(1, changedNodes));
+    QCOMPARE(changedNodes, QSet<QUuid>({ nodeB, nodeC }));
+}
+
+void DomainListVersionsTests::partialListTest() {
+    DomainListTracker tracker;
+
+    // a full list of 5 items in 2 packets
+    tracker.addPacket(1, 0, 5, 3);
+    QCOMPARE(tracker.getVersion(), (quint32)0);
+    tracker.addPacket(1, 0, 5, 2);
+    QCOMPARE(tracker.getVersion(), (quint32)1);
+
+    // the first packet of a list of changes is lost, a packet of the next list doesn't make up for it
+    tracker.addPacket(2, 1, 4, 2);
+    QCOMPARE(tracker.getVersion(), (quint32)1);
+    tracker.addPacket(3, 1, 4, 2);
+    QCOMPARE(tracker.getVersion(), (quint32)1);
+    tracker.addPacket(3, 1, 4, 2);
+    QCOMPARE(tracker.getVersion(), (quint32)3);
+
+    // a reset asks for a full list, and forgets the list being received
+    tracker.addPacket(4, 3, 2, 1);
+    tracker.clear();
+    QCOMPARE(tracker.getVersion(), (quint32)0);
+    tracker.addPacket(4, 0, 2, 1);
+    QCOMPARE(tracker.getVersion(), (quint32)0);
+}
+
+void DomainListVersionsTests::versionMismatchTest() {
+    DomainListTracker tracker;
+    tracker.addPacket(1, 0, 1, 1);
+    QCOMPARE(tracker.getVersion(), (quint32)1);
+
+    // changes to list 2, which we never had all of
+    tracker.addPacket(3, 2, 1, 1);
+    QCOMPARE(tracker.getVersion(), (quint32)1);
+
+    // until a full list comes
+    tracker.addPacket(4, 0, 2, 2);
+    QCOMPARE(tracker.getVersion(), (quint32)4);
+
+    // losing a node the domain-server didn't remove also asks for a full list
+    tracker.reset();
+    QCOMPARE(tracker.getVersion(), (quint32)0);
+    tracker.addPacket(5, 4, 1, 1);
+    QCOMPARE(tracker.getVersion(), (quint32)0);
+}
+
+void DomainListVersionsTests::unchangedListTest() {
+    DomainListTracker tracker;
+    tracker.addPacket(7, 0, 3, 3);
+    QCOMPARE(tracker.getVersion(), (quint32)7);
+
+    // the domain-server sends the same version again, with no items
+    tracker.addPacket(7, 7, 0, 0);
+    QCOMPARE(tracker.getVersion(), (quint32)7);
+
+    // and the next changes still apply on top of it
+    tracker.addPacket(8, 7, 1, 1);
+    QCOMPARE(tracker.getVersion(), (quint32)8);
+}
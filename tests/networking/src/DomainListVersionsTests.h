@@ -0,0 +1,39 @@
+//
+//  DomainListVersionsTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_DomainListVersionsTests_h
+#define overte_DomainListVersionsTests_h
+
+#include <QtTest/QtTest>
+
+class DomainListVersionsTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that list versions skip 0 when they wrap around
+    void versionWraparoundTest();
+
+    // Test that the change log returns each node changed after a version once
+    void changesSinceTest();
+
+    // Test that the change log refuses versions older than the changes it still holds
+    void droppedChangesTest();
+
+    // Test that a list spread over several packets is only acknowledged once all of its items were read
+    void partialListTest();
+
+    // Test that a list of changes is not acknowledged on top of a list we don't have
+    void versionMismatchTest();
+
+    // Test that a list without changes keeps the acknowledged version
+    void unchangedListTest();
+};
+
+#endif // overte_DomainListVersionsTests_h
@@ -0,0 +1,137 @@
+//
+//  PacketInboxTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "PacketInboxTests.h"
+
+#include <chrono>
+#include <thread>
+
+#include <PacketInbox.h>
+
+QTEST_MAIN(PacketInboxTests)
+
+static QSharedPointer<ReceivedMessage> createMarkedMessage(int marker) {
+    QByteArray data(reinterpret_cast<const char*>(&marker), sizeof(int));
+    return QSharedPointer<ReceivedMessage>::create(data, PacketType::Unknown, 0, SockAddr());
+}
+
+static int markerOf(const ReceivedMessage& message) {
+    int marker;
+    memcpy(&marker, message.getRawMessage(), sizeof(int));
+    return marker;
+}
+
+void PacketInboxTests::receiveMessage(QSharedPointer<ReceivedMessage> message) {
+    _received.push_back(markerOf(*message));
+}
+
+void PacketInboxTests::init() {
+    _received.clear();
+}
+
+void PacketInboxTests::orderTest() {
+    PacketInbox inbox(8);
+    auto listener = PacketReceiver::makeUnsourcedListenerReference<PacketInboxTests>(this, &PacketInboxTests::receiveMessage);
+
+    QCOMPARE(inbox.drain(), 0);
+
+    // a few turns of the ring
+    int marker = 0;
+    for (int turn = 0; turn < 4; ++turn) {
+        for (int i = 0; i < 6; ++i) {
+            inbox.push(listener, createMarkedMessage(marker++), SharedNodePointer());
+        }
+        QCOMPARE(inbox.drain(), 6);
+    }
+
+    QCOMPARE((int)_received.size(), marker);
+    for (int i = 0; i < marker; ++i) {
+        QCOMPARE(_received[i], i);
+    }
+    QCOMPARE(inbox.sampleStats()["overflows"].toInt(), 0);
+}
+
+void PacketInboxTests::overflowTest() {
+    const int CAPACITY = 4;
+    const int NUM_OVERFLOWING = 6;
+
+    PacketInbox inbox(CAPACITY);
+    auto listener = PacketReceiver::makeUnsourcedListenerReference<PacketInboxTests>(this, &PacketInboxTests::receiveMessage);
+
+    int marker = 0;
+    for (int i = 0; i < CAPACITY + NUM_OVERFLOWING; ++i) {
+        inbox.push(listener, createMarkedMessage(marker++), SharedNodePointer());
+    }
+    QCOMPARE(inbox.drain(), CAPACITY + NUM_OVERFLOWING);
+    QCOMPARE(inbox.sampleStats()["overflows"].toInt(), NUM_OVERFLOWING);
+
+    // the ring is used again once the overflow has been delivered
+    inbox.push(listener, createMarkedMessage(marker++), SharedNodePointer());
+    QCOMPARE(inbox.drain(), 1);
+    QCOMPARE(inbox.sampleStats()["overflows"].toInt(), 0);
+
+    // messages pushed while there is an overflow wait behind it, even when the ring has room for them
+    for (int i = 0; i < CAPACITY + 1; ++i) {
+        inbox.push(listener, createMarkedMessage(marker++), SharedNodePointer());
+    }
+    inbox.push(listener, createMarkedMessage(marker++), SharedNodePointer());
+    QCOMPARE(inbox.drain(), CAPACITY + 2);
+    QCOMPARE(inbox.sampleStats()["overflows"].toInt(), 2);
+
+    QCOMPARE((int)_received.size(), marker);
+    for (int i = 0; i < marker; ++i) {
+        QCOMPARE(_received[i], i);
+    }
+}
+
+void PacketInboxTests::multipleProducersTest() {
+    const int NUM_PRODUCERS = 4;
+    const int NUM_MESSAGES_PER_PRODUCER = 5000;
+
+    // small enough for the producers to overflow it now and then
+    PacketInbox inbox(64);
+    auto listener = PacketReceiver::makeUnsourcedListenerReference<PacketInboxTests>(this, &PacketInboxTests::receiveMessage);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        producers.emplace_back([&inbox, &listener, producer, NUM_MESSAGES_PER_PRODUCER] {
+            for (int i = 0; i < NUM_MESSAGES_PER_PRODUCER; ++i) {
+                inbox.push(listener, createMarkedMessage(producer * NUM_MESSAGES_PER_PRODUCER + i), SharedNodePointer());
+            }
+        });
+    }
+
+    const int NUM_MESSAGES = NUM_PRODUCERS * NUM_MESSAGES_PER_PRODUCER;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    int numDelivered = 0;
+    while (numDelivered < NUM_MESSAGES && std::chrono::steady_clock::now() < deadline) {
+        int numDrained = inbox.drain();
+        if (numDrained == 0) {
+            std::this_thread::yield();
+        }
+        numDelivered += numDrained;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    numDelivered += inbox.drain();
+    QCOMPARE(numDelivered, NUM_MESSAGES);
+    QCOMPARE((int)_received.size(), NUM_MESSAGES);
+
+    // the messages of each producer come in the order it pushed them
+    std::vector<int> nextOfProducer(NUM_PRODUCERS, 0);
+    for (int marker : _received) {
+        int producer = marker / NUM_MESSAGES_PER_PRODUCER;
+        QCOMPARE(marker % NUM_MESSAGES_PER_PRODUCER, nextOfProducer[producer]);
+        ++nextOfProducer[producer];
+    }
+}
@@ -0,0 +1,43 @@
+//
+//  PacketInboxTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_PacketInboxTests_h
+#define overte_PacketInboxTests_h
+
+#include <vector>
+
+#include <QtTest/QtTest>
+
+#include <ReceivedMessage.h>
+
+class PacketInboxTests : public QObject {
+    Q_OBJECT
+public:
+    // the listener of the messages pushed by the tests
+    void receiveMessage(QSharedPointer<ReceivedMessage> message);
+
+private slots:
+    void init();
+
+    // Test that messages are delivered in the order they were pushed
+    void orderTest();
+
+    // Test that the messages that don't fit in a full inbox are delivered after the others, and before later ones
+    void overflowTest();
+
+    // Test that the messages of each of several threads pushing at once are all delivered, in order
+    void multipleProducersTest();
+
+private:
+    std::vector<int> _received;
+};
+
+#endif // overte_PacketInboxTests_h
@@ -0,0 +1,114 @@
+//
+//  PacketQueueBenchmarkTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "PacketQueueBenchmarkTests.h"
+
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <udt/PacketQueue.h>
+
+QTEST_MAIN(PacketQueueBenchmarkTests)
+
+using PacketPointer = std::unique_ptr<udt::Packet>;
+
+// packets taken by the consumer in each run of a benchmark, split between the producers
+static const int NUM_PACKETS = 64 * 1024;
+
+// The packet queue as it was before it was lock-free: a mutex guards the list of packets
+class LockedPacketQueue {
+public:
+    void queuePacket(PacketPointer packet) {
+        std::lock_guard<std::recursive_mutex> locker(_packetsLock);
+        _packets.push_back(std::move(packet));
+    }
+
+    PacketPointer takePacket() {
+        std::lock_guard<std::recursive_mutex> locker(_packetsLock);
+        if (_packets.empty()) {
+            return PacketPointer();
+        }
+        auto packet = std::move(_packets.front());
+        _packets.pop_front();
+        return packet;
+    }
+
+private:
+    std::recursive_mutex _packetsLock;
+    std::list<PacketPointer> _packets;
+};
+
+// Hands the packets out to the producers, which queue them all at once, while this thread takes them back.
+// The same packets are used over and over so that allocating them isn't measured.
+template <typename Queue>
+static void queueAndTakePackets(Queue& queue, std::vector<PacketPointer>& packets, int numProducers) {
+    auto numPackets = packets.size();
+    std::vector<std::vector<PacketPointer>> packetsOfProducers(numProducers);
+    for (size_t i = 0; i < numPackets; ++i) {
+        packetsOfProducers[i % numProducers].push_back(std::move(packets[i]));
+    }
+    packets.clear();
+
+    std::vector<std::thread> producers;
+    for (auto& packetsOfProducer : packetsOfProducers) {
+        producers.emplace_back([&queue, &packetsOfProducer] {
+            for (auto& packet : packetsOfProducer) {
+                queue.queuePacket(std::move(packet));
+            }
+        });
+    }
+
+    while (packets.size() < numPackets) {
+        if (auto packet = queue.takePacket()) {
+            packets.push_back(std::move(packet));
+        }
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+}
+
+void PacketQueueBenchmarkTests::benchmarkQueueAndTakePackets_data() {
+    QTest::addColumn<bool>("isLockFree");
+    QTest::addColumn<int>("numProducers");
+
+    for (int numProducers : { 1, 2, 4, 8, 16 }) {
+        QTest::newRow(qPrintable(QString("lock-free, %1 producers").arg(numProducers))) << true << numProducers;
+        QTest::newRow(qPrintable(QString("locked, %1 producers").arg(numProducers))) << false << numProducers;
+    }
+}
+
+void PacketQueueBenchmarkTests::benchmarkQueueAndTakePackets() {
+    QFETCH(bool, isLockFree);
+    QFETCH(int, numProducers);
+
+    std::vector<PacketPointer> packets;
+    for (int i = 0; i < NUM_PACKETS; ++i) {
+        packets.push_back(udt::Packet::create(0, true));
+    }
+
+    udt::PacketQueue packetQueue;
+    LockedPacketQueue lockedPacketQueue;
+
+    QBENCHMARK {
+        if (isLockFree) {
+            queueAndTakePackets(packetQueue, packets, numProducers);
+        } else {
+            queueAndTakePackets(lockedPacketQueue, packets, numProducers);
+        }
+    }
+
+    QCOMPARE((int)packets.size(), NUM_PACKETS);
+    QVERIFY(packetQueue.isEmpty());
+}
@@ -0,0 +1,26 @@
+//
+//  PacketQueueBenchmarkTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_PacketQueueBenchmarkTests_h
+#define overte_PacketQueueBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+// Measures the throughput of packets queued by several threads at once and taken by the sending thread,
+// with the lock-free PacketQueue and with a queue guarded by a mutex as the baseline.
+class PacketQueueBenchmarkTests : public QObject {
+    Q_OBJECT
+private slots:
+    void benchmarkQueueAndTakePackets_data();
+    void benchmarkQueueAndTakePackets();
+};
+
+#endif // overte_PacketQueueBenchmarkTests_h
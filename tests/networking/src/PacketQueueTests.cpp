@@ -0,0 +1,108 @@
+//
+//  PacketQueueTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "PacketQueueTests.h"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <udt/PacketList.h>
+#include <udt/PacketQueue.h>
+
+QTEST_MAIN(PacketQueueTests)
+
+static std::unique_ptr<udt::Packet> createMarkedPacket(int marker) {
+    auto packet = udt::Packet::create(sizeof(int), true);
+    packet->writePrimitive(marker);
+    return packet;
+}
+
+static std::unique_ptr<udt::PacketList> createMarkedPacketList(const std::vector<int>& markers) {
+    auto packetList = udt::PacketList::create(PacketType::Unknown, QByteArray(), true, false);
+    for (auto marker : markers) {
+        packetList->writePrimitive(marker);
+        packetList->closeCurrentPacket();
+    }
+    return packetList;
+}
+
+static int markerOf(const udt::Packet& packet) {
+    int marker;
+    memcpy(&marker, packet.getPayload(), sizeof(int));
+    return marker;
+}
+
+void PacketQueueTests::roundRobinTest() {
+    udt::PacketQueue queue;
+    QVERIFY(queue.isEmpty());
+
+    for (int i = 0; i < 3; ++i) {
+        queue.queuePacket(createMarkedPacket(i));
+    }
+    queue.queuePacketList(createMarkedPacketList({ 10, 11, 12 }));
+    queue.queuePacketList(createMarkedPacketList({ 20, 21, 22 }));
+    QVERIFY(!queue.isEmpty());
+
+    // the main channel, then each packet list
+    std::vector<int> expectedMarkers { 0, 10, 20, 1, 11, 21, 2, 12, 22 };
+    for (auto expectedMarker : expectedMarkers) {
+        auto packet = queue.takePacket();
+        QVERIFY(packet);
+        QCOMPARE(markerOf(*packet), expectedMarker);
+    }
+
+    QVERIFY(queue.isEmpty());
+    QVERIFY(!queue.takePacket());
+}
+
+void PacketQueueTests::multipleProducersTest() {
+    const int NUM_PRODUCERS = 8;
+    const int PACKETS_PER_PRODUCER = 2000;
+
+    udt::PacketQueue queue;
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < NUM_PRODUCERS; ++producer) {
+        producers.emplace_back([&queue, producer] {
+            for (int i = 0; i < PACKETS_PER_PRODUCER; ++i) {
+                queue.queuePacket(createMarkedPacket(producer * PACKETS_PER_PRODUCER + i));
+            }
+        });
+    }
+
+    // the producers must be joined before the test can fail, and a lost packet must not hang the test
+    const auto TIMEOUT = std::chrono::seconds(10);
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    std::vector<int> nextPacketOfProducer(NUM_PRODUCERS, 0);
+    bool isInOrder = true;
+    int numTakenPackets = 0;
+    while (numTakenPackets < NUM_PRODUCERS * PACKETS_PER_PRODUCER && std::chrono::steady_clock::now() < deadline) {
+        auto packet = queue.takePacket();
+        if (!packet) {
+            std::this_thread::yield();
+            continue;
+        }
+        auto marker = markerOf(*packet);
+        auto producer = marker / PACKETS_PER_PRODUCER;
+        isInOrder = isInOrder && marker % PACKETS_PER_PRODUCER == nextPacketOfProducer[producer];
+        ++nextPacketOfProducer[producer];
+        ++numTakenPackets;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    QCOMPARE(numTakenPackets, NUM_PRODUCERS * PACKETS_PER_PRODUCER);
+    QVERIFY(isInOrder);
+    QVERIFY(queue.isEmpty());
+}
@@ -0,0 +1,27 @@
+//
+//  PacketQueueTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_PacketQueueTests_h
+#define overte_PacketQueueTests_h
+
+#include <QtTest/QtTest>
+
+class PacketQueueTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that packets and packet lists are taken from their channels in turn
+    void roundRobinTest();
+
+    // Test that the packets of each of several threads queuing at once are taken in order
+    void multipleProducersTest();
+};
+
+#endif // overte_PacketQueueTests_h
@@ -0,0 +1,117 @@
+//
+//  TimerWheelTests.cpp
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "TimerWheelTests.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <udt/TimerWheel.h>
+
+QTEST_MAIN(TimerWheelTests)
+
+using Wheel = udt::TimerWheel<int>;
+using TimePoint = Wheel::TimePoint;
+
+static const std::chrono::microseconds TURN(Wheel::NUM_SLOTS * Wheel::TICK_USECS);
+
+// any time will do, the wheel only looks at the time between its timers
+static const TimePoint START = TimePoint(std::chrono::seconds(1000));
+
+static TimePoint at(int64_t usecs) {
+    return START + std::chrono::microseconds(usecs);
+}
+
+static std::vector<int> collect(Wheel& wheel, TimePoint now) {
+    std::vector<int> dueKeys;
+    wheel.collectDue(now, dueKeys);
+    std::sort(dueKeys.begin(), dueKeys.end());
+    return dueKeys;
+}
+
+void TimerWheelTests::collectDueTest() {
+    Wheel wheel(START);
+    QVERIFY(wheel.nextDue() == TimePoint::max());
+
+    wheel.schedule(1, at(500));
+    wheel.schedule(2, at(1000));
+    wheel.schedule(3, at(1050)); // same tick as 2
+    wheel.schedule(4, at(-300)); // already overdue
+    QVERIFY(wheel.nextDue() == at(-300));
+
+    QCOMPARE(collect(wheel, at(0)), std::vector<int>({ 4 }));
+    QVERIFY(wheel.nextDue() == at(500));
+
+    QCOMPARE(collect(wheel, at(700)), std::vector<int>({ 1 }));
+    QVERIFY(!wheel.isScheduled(1));
+    QVERIFY(wheel.nextDue() == at(1000));
+
+    // a timer later in the current tick stays
+    QCOMPARE(collect(wheel, at(1020)), std::vector<int>({ 2 }));
+    QVERIFY(wheel.nextDue() == at(1050));
+    QCOMPARE(collect(wheel, at(1050)), std::vector<int>({ 3 }));
+
+    QVERIFY(collect(wheel, at(5000)).empty());
+    QVERIFY(wheel.nextDue() == TimePoint::max());
+}
+
+void TimerWheelTests::wraparoundTest() {
+    Wheel wheel(START);
+
+    // in the same slot as a timer due a turn and a half earlier
+    auto farDue = START + TURN + TURN / 2;
+    wheel.schedule(1, farDue);
+    wheel.schedule(2, at(TURN.count() / 2));
+
+    // the far timer is past the turn nextDue looks at
+    QVERIFY(wheel.nextDue() == at(TURN.count() / 2));
+    QCOMPARE(collect(wheel, at(TURN.count() / 2)), std::vector<int>({ 2 }));
+    QVERIFY(wheel.nextDue() <= farDue);
+    QVERIFY(wheel.isScheduled(1));
+
+    // passing its slot a turn early doesn't collect it
+    QVERIFY(collect(wheel, START + TURN).empty());
+    QVERIFY(wheel.nextDue() == farDue);
+
+    QCOMPARE(collect(wheel, farDue), std::vector<int>({ 1 }));
+
+    // collecting after more than a turn without looking still finds everything that is due
+    wheel.schedule(3, farDue + std::chrono::microseconds(100));
+    wheel.schedule(4, farDue + TURN / 4);
+    wheel.schedule(5, farDue + TURN * 3);
+    QCOMPARE(collect(wheel, farDue + TURN * 2), std::vector<int>({ 3, 4 }));
+    QCOMPARE(collect(wheel, farDue + TURN * 3), std::vector<int>({ 5 }));
+}
+
+void TimerWheelTests::staleGenerationTest() {
+    Wheel wheel(START);
+
+    // rescheduled later, the first timer is stale
+    wheel.schedule(1, at(1000));
+    wheel.schedule(1, at(3000));
+    QVERIFY(wheel.nextDue() == at(3000));
+    QVERIFY(collect(wheel, at(2000)).empty());
+    QCOMPARE(collect(wheel, at(3000)), std::vector<int>({ 1 }));
+
+    // rescheduled sooner, the second timer is stale
+    wheel.schedule(2, at(6000));
+    wheel.schedule(2, at(4000));
+    QCOMPARE(collect(wheel, at(7000)), std::vector<int>({ 2 }));
+
+    // cancelled, and scheduled again after its first timer was due
+    wheel.schedule(3, at(8000));
+    wheel.cancel(3);
+    QVERIFY(!wheel.isScheduled(3));
+    QVERIFY(wheel.nextDue() == TimePoint::max());
+    wheel.schedule(3, at(9000) + TURN);
+    QVERIFY(collect(wheel, at(8500)).empty());
+    QCOMPARE(collect(wheel, at(9000) + TURN), std::vector<int>({ 3 }));
+}
@@ -0,0 +1,30 @@
+//
+//  TimerWheelTests.h
+//  tests/networking/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_TimerWheelTests_h
+#define overte_TimerWheelTests_h
+
+#include <QtTest/QtTest>
+
+class TimerWheelTests : public QObject {
+    Q_OBJECT
+private slots:
+    // Test that timers are collected once they are due, and that nextDue gives the earliest one
+    void collectDueTest();
+
+    // Test that timers more than a turn of the wheel away are only collected on the turn they are due
+    void wraparoundTest();
+
+    // Test that a timer replaced by scheduling its key again, or cancelled, is never collected
+    void staleGenerationTest();
+};
+
+#endif // overte_TimerWheelTests_h
@@ -0,0 +1,158 @@
+//
+//  OctreeJournalTests.cpp
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "OctreeJournalTests.h"
+
+#include <QJsonDocument>
+#include <QTemporaryDir>
+
+#include <OctreeDataUtils.h>
+
+QTEST_MAIN(OctreeJournalTests)
+
+namespace {
+
+QVariantMap makeEntity(const QUuid& id, const QString& name, quint64 lastEdited) {
+    QVariantMap entity;
+    entity["id"] = id.toString();
+    entity["name"] = name;
+    entity["lastEdited"] = lastEdited;
+    return entity;
+}
+
+QByteArray makeRecord(const QUuid& dataID, OctreeUtils::Version dataVersion,
+                      const QVariantList& entities, const QList<QUuid>& deleted) {
+    QJsonArray deletedArray;
+    for (const auto& id : deleted) {
+        deletedArray.append(id.toString());
+    }
+
+    QJsonObject record;
+    record["DataVersion"] = (qint64)dataVersion;
+    record["Entities"] = QJsonArray::fromVariantList(entities);
+    record["Deleted"] = deletedArray;
+    record["Id"] = dataID.toString();
+    record["Version"] = 1;
+    return QJsonDocument(record).toJson(QJsonDocument::Compact);
+}
+
+QString nameOf(const OctreeUtils::RawEntityData& data, const QUuid& id) {
+    for (const auto& entity : data.variantEntityData) {
+        auto map = entity.toMap();
+        if (QUuid(map["id"].toString()) == id) {
+            return map["name"].toString();
+        }
+    }
+    return QString();
+}
+
+}
+
+void OctreeJournalTests::applyJournalRecordsTest() {
+    QUuid a = QUuid::createUuid();
+    QUuid b = QUuid::createUuid();
+    QUuid c = QUuid::createUuid();
+
+    OctreeUtils::RawEntityData data;
+    data.id = QUuid::createUuid();
+    data.dataVersion = 1;
+    data.variantEntityData = { makeEntity(a, "a", 10), makeEntity(b, "b", 10) };
+
+    QList<QByteArray> records;
+    records << makeRecord(data.id, 2, { makeEntity(a, "a2", 20), makeEntity(c, "c", 20) }, {});
+    // an older edit of a, e.g. from a record reordered by a crash, must not win
+    records << makeRecord(data.id, 3, { makeEntity(a, "a1", 15) }, { b });
+    // a record for different content is ignored
+    records << makeRecord(QUuid::createUuid(), 4, { makeEntity(b, "b4", 40) }, { a });
+
+    QCOMPARE(data.applyJournalRecords(records), 2);
+    QCOMPARE(data.dataVersion, (OctreeUtils::Version)3);
+    QCOMPARE(data.variantEntityData.size(), 2);
+    QCOMPARE(nameOf(data, a), QString("a2"));
+    QCOMPARE(nameOf(data, b), QString());
+    QCOMPARE(nameOf(data, c), QString("c"));
+}
+
+void OctreeJournalTests::compactJournalTest() {
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString path = dir.filePath("models.json.gz");
+
+    QUuid a = QUuid::createUuid();
+    OctreeUtils::RawEntityData data;
+    data.resetIdAndVersion();
+    data.version = 1;
+    data.variantEntityData = { makeEntity(a, "a", 10) };
+    QVERIFY(OctreeUtils::writePersistFile(path, data.toGzippedByteArray()));
+
+    // nothing to fold
+    QVERIFY(OctreeUtils::compactJournal(path));
+    QCOMPARE(OctreeUtils::getJournalSize(path), (qint64)0);
+
+    QUuid b = QUuid::createUuid();
+    QVERIFY(OctreeUtils::appendJournalRecord(path, makeRecord(data.id, 1, { makeEntity(b, "b", 20) }, {})));
+    QVERIFY(OctreeUtils::appendJournalRecord(path, makeRecord(data.id, 2, {}, { a })));
+    QVERIFY(OctreeUtils::getJournalSize(path) > 0);
+
+    QVERIFY(OctreeUtils::compactJournal(path));
+    QCOMPARE(OctreeUtils::getJournalSize(path), (qint64)0);
+
+    OctreeUtils::RawEntityData compacted;
+    QVERIFY(compacted.readOctreeDataInfoFromFile(path));
+    QCOMPARE(compacted.id, data.id);
+    QCOMPARE(compacted.dataVersion, (OctreeUtils::Version)2);
+    QCOMPARE(compacted.variantEntityData.size(), 1);
+    QCOMPARE(nameOf(compacted, b), QString("b"));
+
+    // a full write drops anything journaled against the previous contents
+    QVERIFY(OctreeUtils::appendJournalRecord(path, makeRecord(data.id, 3, {}, { b })));
+    QVERIFY(OctreeUtils::writePersistFile(path, data.toGzippedByteArray()));
+    QCOMPARE(OctreeUtils::getJournalSize(path), (qint64)0);
+}
+
+void OctreeJournalTests::binarySnapshotTest() {
+    OctreeUtils::BinarySnapshotHeader header;
+    header.contentVersion = 42;
+    header.id = QUuid::createUuid();
+    header.dataVersion = 1234567890123;
+    header.numEntities = 3;
+
+    QByteArray data;
+    header.write(data);
+    int headerSize = data.size();
+    data.append("entities");
+
+    OctreeUtils::BinarySnapshotHeader readHeader;
+    QCOMPARE(readHeader.read(data.constData(), data.size()), headerSize);
+    QCOMPARE(readHeader.contentVersion, header.contentVersion);
+    QCOMPARE(readHeader.id, header.id);
+    QCOMPARE(readHeader.dataVersion, header.dataVersion);
+    QCOMPARE(readHeader.numEntities, header.numEntities);
+
+    // JSON isn't mistaken for a snapshot
+    QByteArray json("{ \"DataVersion\": 1 }");
+    QCOMPARE(readHeader.read(json.constData(), json.size()), -1);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    QString path = dir.filePath("models.bin");
+    QVERIFY(OctreeUtils::writePersistFile(path, data));
+    QVERIFY(readHeader.readFromFile(path));
+
+    // journals of binary snapshots are replayed on the tree, never folded into the file
+    QByteArray record("{}");
+    QVERIFY(OctreeUtils::appendJournalRecord(path, record));
+    QVERIFY(!OctreeUtils::compactJournal(path));
+    QCOMPARE(OctreeUtils::readJournal(path), QList<QByteArray>({ record }));
+
+    QFile file(path);
+    QVERIFY(file.open(QIODevice::ReadOnly));
+    QCOMPARE(file.readAll(), data);
+}
@@ -0,0 +1,25 @@
+//
+//  OctreeJournalTests.h
+//  tests/octree/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#ifndef hifi_OctreeJournalTests_h
+#define hifi_OctreeJournalTests_h
+
+#include <QtTest/QtTest>
+
+class OctreeJournalTests : public QObject {
+    Q_OBJECT
+
+private slots:
+    void applyJournalRecordsTest();
+    void compactJournalTest();
+    void binarySnapshotTest();
+};
+
+#endif // hifi_OctreeJournalTests_h
@@ -0,0 +1,167 @@
+//
+//  EntityPropertyColumnsTests.cpp
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "EntityPropertyColumnsTests.h"
+
+#include "DependencyManager.h"
+#include "NodeList.h"
+#include "ScriptCache.h"
+#include "ScriptEngine.h"
+#include "ScriptEngines.h"
+#include "ScriptValue.h"
+#include "StatTracker.h"
+
+#include <EntityItemProperties.h>
+#include <EntityScriptingInterface.h>
+#include <EntityTree.h>
+
+QTEST_MAIN(EntityPropertyColumnsTests)
+
+static QStringList propertyNames(const ScriptValue& object) {
+    QStringList names = object.getPropertyNames();
+    names.sort();
+    return names;
+}
+
+static ScriptValue makeDesiredProperties(ScriptEngine* engine, const QStringList& names) {
+    ScriptValue desiredProperties = engine->newArray();
+    for (int i = 0; i < names.size(); ++i) {
+        desiredProperties.setProperty((quint32)i, engine->newValue(names[i]));
+    }
+    return desiredProperties;
+}
+
+void EntityPropertyColumnsTests::initTestCase() {
+    DependencyManager::registerInheritance<LimitedNodeList, NodeList>();
+    DependencyManager::set<NodeList>(NodeType::Agent, INVALID_PORT);
+    DependencyManager::set<ScriptEngines>(ScriptManager::NETWORKLESS_TEST_SCRIPT, QUrl(""));
+    DependencyManager::set<ScriptCache>();
+    DependencyManager::set<StatTracker>();
+    DependencyManager::set<ScriptInitializers>();
+    auto entityScriptingInterface = DependencyManager::set<EntityScriptingInterface>(false);
+
+    auto tree = std::make_shared<EntityTree>();
+    tree->createRootElement();
+    entityScriptingInterface->setEntityTree(tree);
+
+    // the manager registers the entity property conversions with its engine
+    _manager = newScriptManager(ScriptManager::NETWORKLESS_TEST_SCRIPT, "", "EntityPropertyColumnsTests.js");
+
+    _entityIDs.append(addEntity("first", glm::vec3(1.0f, 2.0f, 3.0f)));
+    _entityIDs.append(addEntity("second", glm::vec3(4.0f, 5.0f, 6.0f)));
+}
+
+void EntityPropertyColumnsTests::cleanupTestCase() {
+    _manager.reset();
+    DependencyManager::get<EntityScriptingInterface>()->setEntityTree(nullptr);
+    DependencyManager::destroy<EntityScriptingInterface>();
+}
+
+QUuid EntityPropertyColumnsTests::addEntity(const QString& name, const glm::vec3& position) {
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setEntityHostType(entity::HostType::LOCAL);
+    properties.setName(name);
+    properties.setPosition(position);
+
+    QUuid id = QUuid::createUuid();
+    auto tree = DependencyManager::get<EntityScriptingInterface>()->getEntityTree();
+    tree->withWriteLock([&] {
+        QVERIFY(tree->addEntity(EntityItemID(id), properties));
+    });
+    return id;
+}
+
+void EntityPropertyColumnsTests::columnsTest() {
+    auto engine = _manager->engine();
+    QVector<QUuid> entityIDs { _entityIDs[0], QUuid::createUuid(), _entityIDs[1] };
+    ScriptValue desiredProperties = makeDesiredProperties(engine.get(), { "position", "name" });
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    ScriptValue columns = entityScriptingInterface->getMultipleEntityPropertyColumnsInternal(engine.get(), entityIDs,
+                                                                                            desiredProperties);
+
+    QCOMPARE(propertyNames(columns), QStringList({ "entityIDs", "name", "position" }));
+    QCOMPARE(scriptvalue_cast<QVector<QUuid>>(columns.property("entityIDs")), _entityIDs);
+
+    ScriptValue positions = columns.property("position");
+    const float EXPECTED_POSITIONS[] = { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f };
+    QCOMPARE(positions.property("length").toInt32(), 6);
+    for (quint32 i = 0; i < 6; ++i) {
+        QCOMPARE((float)positions.property(i).toNumber(), EXPECTED_POSITIONS[i]);
+    }
+
+    ScriptValue names = columns.property("name");
+    QCOMPARE(names.property("length").toInt32(), 2);
+    QCOMPARE(names.property(0).toString(), QString("first"));
+    QCOMPARE(names.property(1).toString(), QString("second"));
+}
+
+void EntityPropertyColumnsTests::pseudoPropertiesOnlyTest() {
+    auto engine = _manager->engine();
+    ScriptValue desiredProperties = makeDesiredProperties(engine.get(), { "id", "type" });
+
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    ScriptValue columns = entityScriptingInterface->getMultipleEntityPropertyColumnsInternal(engine.get(), _entityIDs,
+                                                                                            desiredProperties);
+
+    QCOMPARE(propertyNames(columns), QStringList({ "entityIDs", "id", "type" }));
+    for (quint32 i = 0; i < (quint32)_entityIDs.size(); ++i) {
+        QCOMPARE(scriptvalue_cast<QUuid>(columns.property("id").property(i)), _entityIDs[i]);
+        QCOMPARE(columns.property("type").property(i).toString(), QString("Box"));
+    }
+
+    // the columns are taken from objects that desire a placeholder property, which only hold the pseudo-properties
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setName("first");
+    EntityPropertyFlags placeholder;
+    placeholder.setHasProperty(PROP_PAGED_PROPERTY);
+    properties.setDesiredProperties(placeholder);
+    EntityPseudoPropertyFlags pseudoPropertyFlags;
+    pseudoPropertyFlags.set(EntityPseudoPropertyFlag::FlagsActive);
+    pseudoPropertyFlags.set(EntityPseudoPropertyFlag::Type);
+    ScriptValue object = properties.copyToScriptValue(engine.get(), false, false, false, pseudoPropertyFlags);
+    QCOMPARE(propertyNames(object), QStringList({ "type" }));
+}
+
+void EntityPropertyColumnsTests::batchesTest() {
+    // more than two batches of entities, with one that isn't found in each batch
+    const int NUM_ENTITIES = 1100;
+    const int MISSING_ENTITY_INTERVAL = 500;
+    QVector<QUuid> entityIDs;
+    QVector<QUuid> foundIDs;
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        if (i % MISSING_ENTITY_INTERVAL == 0) {
+            entityIDs.append(QUuid::createUuid());
+        } else {
+            auto id = addEntity(QString::number(i), glm::vec3((float)i, 0.0f, 0.0f));
+            entityIDs.append(id);
+            foundIDs.append(id);
+        }
+    }
+
+    auto engine = _manager->engine();
+    auto entityScriptingInterface = DependencyManager::get<EntityScriptingInterface>();
+    ScriptValue columns = entityScriptingInterface->getMultipleEntityPropertyColumnsInternal(engine.get(), entityIDs,
+                                                                                            engine->newValue(QString("position")));
+
+    QCOMPARE(scriptvalue_cast<QVector<QUuid>>(columns.property("entityIDs")), foundIDs);
+    ScriptValue positions = columns.property("position");
+    QCOMPARE(positions.property("length").toInt32(), foundIDs.size() * 3);
+    quint32 k = 0;
+    for (int i = 0; i < NUM_ENTITIES; ++i) {
+        if (i % MISSING_ENTITY_INTERVAL != 0) {
+            QCOMPARE((float)positions.property(k * 3).toNumber(), (float)i);
+            ++k;
+        }
+    }
+}
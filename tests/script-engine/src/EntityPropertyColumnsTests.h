@@ -0,0 +1,43 @@
+//
+//  EntityPropertyColumnsTests.h
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_EntityPropertyColumnsTests_h
+#define overte_EntityPropertyColumnsTests_h
+
+#include <QtTest/QtTest>
+#include <QtCore/QUuid>
+#include <QtCore/QVector>
+
+#include <glm/glm.hpp>
+
+#include "ScriptManager.h"
+
+class EntityPropertyColumnsTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    // float properties come back in Float32Arrays and the others in arrays, for the entities that exist only
+    void columnsTest();
+    // asking for pseudo-properties only gives just those, and not every property of the entities
+    void pseudoPropertiesOnlyTest();
+    // entities are found across the batches the tree is read locked for
+    void batchesTest();
+
+private:
+    QUuid addEntity(const QString& name, const glm::vec3& position);
+
+    std::shared_ptr<ScriptManager> _manager;
+    QVector<QUuid> _entityIDs;
+};
+
+#endif // overte_EntityPropertyColumnsTests_h
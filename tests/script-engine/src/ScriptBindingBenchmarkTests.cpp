@@ -0,0 +1,166 @@
+//
+//  ScriptBindingBenchmarkTests.cpp
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ScriptBindingBenchmarkTests.h"
+
+#include "ScriptValue.h"
+
+QTEST_MAIN(ScriptBindingBenchmarkTests)
+
+// the loops run in the script, so that each benchmark mostly measures crossings of the boundary
+static const int NUM_CALLS = 1000;
+static const int NUM_FLOATS = 3 * 1000;
+
+ScriptValue ScriptBindingBenchmarkTests::evaluateFunction(const QString& source) {
+    ScriptValue function = _engine->evaluate("(" + source + ")", "ScriptBindingBenchmarkTests");
+    if (!function.isFunction()) {
+        qCritical() << "Benchmark function did not compile:" << source;
+    }
+    return function;
+}
+
+void ScriptBindingBenchmarkTests::initTestCase() {
+    _engine = newScriptEngine();
+    _engine->registerGlobalObject("Benchmark", &_object);
+    _engine->setDefaultPrototype(qRegisterMetaType<BenchmarkValue>(), _engine->newQObject(&_valuePrototype));
+    _engine->globalObject().setProperty("NUM_CALLS", NUM_CALLS);
+}
+
+void ScriptBindingBenchmarkTests::cleanupTestCase() {
+    _engine.reset();
+}
+
+// the cost of the loop and of a call that doesn't leave the script, to compare the other benchmarks with
+void ScriptBindingBenchmarkTests::benchmarkScriptFunctionCall() {
+    ScriptValue function = evaluateFunction(
+        "function() {"
+        "    function add(a, b) { return a + b; }"
+        "    var sum = 0;"
+        "    for (var i = 0; i < NUM_CALLS; i++) { sum = add(sum, 1); }"
+        "    return sum;"
+        "}");
+    ScriptValue result;
+    QBENCHMARK {
+        result = function.call();
+    }
+    QCOMPARE(result.toInt32(), NUM_CALLS);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkInvokableCall() {
+    ScriptValue function = evaluateFunction(
+        "function() {"
+        "    var sum = 0;"
+        "    for (var i = 0; i < NUM_CALLS; i++) { sum = Benchmark.add(sum, 1); }"
+        "    return sum;"
+        "}");
+    ScriptValue result;
+    QBENCHMARK {
+        result = function.call();
+    }
+    QCOMPARE(result.toInt32(), NUM_CALLS);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkInvokableCallReturningMap() {
+    ScriptValue function = evaluateFunction(
+        "function() {"
+        "    var sum = 0;"
+        "    for (var i = 0; i < NUM_CALLS; i++) { sum += Benchmark.getMap().a; }"
+        "    return sum;"
+        "}");
+    ScriptValue result;
+    QBENCHMARK {
+        result = function.call();
+    }
+    QCOMPARE(result.toInt32(), NUM_CALLS);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkPropertyRead() {
+    _object.setValue(1);
+    ScriptValue function = evaluateFunction(
+        "function() {"
+        "    var sum = 0;"
+        "    for (var i = 0; i < NUM_CALLS; i++) { sum += Benchmark.value; }"
+        "    return sum;"
+        "}");
+    ScriptValue result;
+    QBENCHMARK {
+        result = function.call();
+    }
+    QCOMPARE(result.toInt32(), NUM_CALLS);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkPropertyWrite() {
+    ScriptValue function = evaluateFunction(
+        "function() {"
+        "    for (var i = 0; i < NUM_CALLS; i++) { Benchmark.value = i; }"
+        "}");
+    QBENCHMARK {
+        function.call();
+    }
+    QCOMPARE(_object.getValue(), NUM_CALLS - 1);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkVariantRoundTrip() {
+    QVariant variant = QVariant::fromValue(BenchmarkValue { 7 });
+    QVariant result;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_CALLS; i++) {
+            result = _engine->newVariant(variant).toVariant();
+        }
+    }
+    QCOMPARE(result.value<BenchmarkValue>().answer, 7);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkVariantPropertyRead() {
+    ScriptValue value = _engine->newVariant(QVariant::fromValue(BenchmarkValue()));
+    ScriptValue function = evaluateFunction(
+        "function(value) {"
+        "    var sum = 0;"
+        "    for (var i = 0; i < NUM_CALLS; i++) { sum += value.answer; }"
+        "    return sum;"
+        "}");
+    ScriptValue result;
+    QBENCHMARK {
+        result = function.call(ScriptValue(), ScriptValueList { value });
+    }
+    QCOMPARE(result.toInt32(), 42 * NUM_CALLS);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkTypedArrayFromNative() {
+    QByteArray data(NUM_FLOATS * (int)sizeof(float), 0);
+    ScriptValue float32Array = _engine->globalObject().property("Float32Array");
+    ScriptValue result;
+    QBENCHMARK {
+        result = float32Array.construct(ScriptValueList { _engine->newArrayBuffer(data) });
+    }
+    QCOMPARE(result.property("length").toInt32(), NUM_FLOATS);
+}
+
+void ScriptBindingBenchmarkTests::benchmarkTypedArrayRead() {
+    QByteArray data(NUM_FLOATS * (int)sizeof(float), 0);
+    auto floats = reinterpret_cast<float*>(data.data());
+    for (int i = 0; i < NUM_FLOATS; i++) {
+        floats[i] = 1.0f;
+    }
+    ScriptValue array = _engine->globalObject().property("Float32Array")
+        .construct(ScriptValueList { _engine->newArrayBuffer(data) });
+    ScriptValue function = evaluateFunction(
+        "function(array) {"
+        "    var sum = 0;"
+        "    for (var i = 0; i < array.length; i++) { sum += array[i]; }"
+        "    return sum;"
+        "}");
+    ScriptValue result;
+    QBENCHMARK {
+        result = function.call(ScriptValue(), ScriptValueList { array });
+    }
+    QCOMPARE(result.toInt32(), NUM_FLOATS);
+}
@@ -0,0 +1,76 @@
+//
+//  ScriptBindingBenchmarkTests.h
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_ScriptBindingBenchmarkTests_h
+#define overte_ScriptBindingBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+#include "ScriptEngine.h"
+
+// A native object as scripts see the API objects, through a QObject proxy
+class BenchmarkObject : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int value READ getValue WRITE setValue)
+
+public:
+    int getValue() const { return _value; }
+    void setValue(int value) { _value = value; }
+
+    Q_INVOKABLE int add(int a, int b) { return a + b; }
+    Q_INVOKABLE QVariantMap getMap() const { return { { "a", 1 }, { "b", "two" } }; }
+
+private:
+    int _value { 0 };
+};
+
+// A native value type without a conversion, which scripts see through a variant proxy
+struct BenchmarkValue {
+    int answer { 0 };
+};
+Q_DECLARE_METATYPE(BenchmarkValue)
+
+class BenchmarkValuePrototype : public QObject {
+    Q_OBJECT
+    Q_PROPERTY(int answer READ getAnswer)
+
+public:
+    int getAnswer() const { return 42; }
+};
+
+// Measures crossing the boundary between scripts and native code: calls and property access on QObject proxies,
+// variant proxies and typed arrays over native buffers.
+// Run the script-engine-benchmarks target to write the results of all script engine benchmarks as QtTest XML.
+class ScriptBindingBenchmarkTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchmarkScriptFunctionCall();
+    void benchmarkInvokableCall();
+    void benchmarkInvokableCallReturningMap();
+    void benchmarkPropertyRead();
+    void benchmarkPropertyWrite();
+    void benchmarkVariantRoundTrip();
+    void benchmarkVariantPropertyRead();
+    void benchmarkTypedArrayFromNative();
+    void benchmarkTypedArrayRead();
+
+private:
+    ScriptValue evaluateFunction(const QString& source);
+
+    ScriptEnginePointer _engine;
+    BenchmarkObject _object;
+    BenchmarkValuePrototype _valuePrototype;
+};
+
+#endif // overte_ScriptBindingBenchmarkTests_h
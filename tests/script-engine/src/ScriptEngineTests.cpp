@@ -10,6 +10,7 @@
 #include <QDebug>
 #include <QFile>
 #include <QTextStream>
+#include <QTemporaryDir>
 
 
 #include "ScriptEngineTests.h"
@@ -333,3 +334,51 @@ void ScriptEngineTests::testQuat() {
     sm->run();
 }
 
+void ScriptEngineTests::testCodeCache() {
+    // keep the code of the test out of the user's cache
+    QTemporaryDir codeCacheDirectory;
+    QVERIFY(codeCacheDirectory.isValid());
+    auto scriptCache = DependencyManager::get<ScriptCache>();
+    QString previousCodeCacheDirectory = scriptCache->getCodeCacheDirectory();
+    scriptCache->setCodeCacheDirectory(codeCacheDirectory.path());
+
+    QByteArray key = "test:" + QUuid::createUuid().toByteArray();
+    QVERIFY(scriptCache->getCodeCache(key).isEmpty());
+    scriptCache->setCodeCache(key, "compiled");
+    QCOMPARE(scriptCache->getCodeCache(key), QByteArray("compiled"));
+
+    // from the directory too, once it's gone from memory
+    scriptCache->setCodeCacheDirectory(codeCacheDirectory.path());
+    QCOMPARE(scriptCache->getCodeCache(key), QByteArray("compiled"));
+
+    scriptCache->rejectCodeCache(key);
+    QVERIFY(scriptCache->getCodeCache(key).isEmpty());
+
+    // long enough to go through the code cache, the second run compiles from the code of the first
+    QString script = "function answer() {\n";
+    for (int i = 0; i < 100; i++) {
+        script += QString("    var unused%1 = %1 * 2;\n").arg(i);
+    }
+    script += "    return 42;\n}\nprint(answer());\nScript.stop(true);\n";
+
+    int numHits = 0;
+    int numRejections = 0;
+    for (int run = 0; run < 2; run++) {
+        numHits = scriptCache->getNumCodeCacheHits();
+        numRejections = scriptCache->getNumCodeCacheRejections();
+
+        QString printed;
+        auto sm = makeManager(script, "testCodeCache.js");
+        connect(sm.get(), &ScriptManager::printedMessage, [&printed](const QString& message, const QString& engineName){
+            printed.append(message);
+        });
+        sm->run();
+        QCOMPARE(printed, QString("42"));
+    }
+    // V8 took the code of the first run
+    QVERIFY(scriptCache->getNumCodeCacheHits() > numHits);
+    QCOMPARE(scriptCache->getNumCodeCacheRejections(), numRejections);
+
+    scriptCache->setCodeCacheDirectory(previousCodeCacheDirectory);
+}
+
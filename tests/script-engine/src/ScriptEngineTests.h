@@ -65,6 +65,7 @@ private slots:
     void testSignal();
     void testSignalWithException();
     void testQuat();
+    void testCodeCache();
 
 
 private:
@@ -0,0 +1,196 @@
+//
+//  ScriptValueBenchmarkTests.cpp
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ScriptValueBenchmarkTests.h"
+
+#include <cfloat>
+
+#include "DependencyManager.h"
+#include "ScriptValue.h"
+#include "ScriptValueUtils.h"
+
+#include <EntityItemProperties.h>
+
+QTEST_MAIN(ScriptValueBenchmarkTests)
+
+static const int NUM_CONVERSIONS = 1000;
+
+// the generic conversions, as used before the V8 specific ones
+static ScriptValue genericVec3ToScriptValue(ScriptEngine* engine, const glm::vec3& vec3) {
+    auto prototype = engine->globalObject().property("__hifi_vec3__");
+    if (!prototype.hasProperty("defined") || !prototype.property("defined").toBool()) {
+        prototype = engine->evaluate(
+            "globalThis.__hifi_vec3__ = Object.defineProperties({}, { "
+            "defined: { value: true },"
+            "0: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "1: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "2: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
+            "r: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "g: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "b: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } },"
+            "red: { set: function(nv) { return this.x = nv; }, get: function() { return this.x; } },"
+            "green: { set: function(nv) { return this.y = nv; }, get: function() { return this.y; } },"
+            "blue: { set: function(nv) { return this.z = nv; }, get: function() { return this.z; } }"
+            "})");
+    }
+    ScriptValue value = engine->newObject();
+    value.setProperty("x", vec3.x);
+    value.setProperty("y", vec3.y);
+    value.setProperty("z", vec3.z);
+    value.setPrototype(prototype);
+    return value;
+}
+
+static bool genericQuatFromScriptValue(const ScriptValue& object, glm::quat& quat) {
+    if (!object.isValid() || !object.isObject()) {
+        return false;
+    }
+    QVariant x = object.property("x").toVariant();
+    QVariant y = object.property("y").toVariant();
+    QVariant z = object.property("z").toVariant();
+    QVariant w = object.property("w").toVariant();
+    if (!x.isValid() || !y.isValid() || !z.isValid() || !w.isValid()) {
+        return false;
+    }
+    quat.x = object.property("x").toVariant().toFloat();
+    quat.y = object.property("y").toVariant().toFloat();
+    quat.z = object.property("z").toVariant().toFloat();
+    quat.w = object.property("w").toVariant().toFloat();
+
+    float length = glm::length(quat);
+    if (length > FLT_EPSILON) {
+        quat /= length;
+    } else {
+        quat = glm::quat();
+    }
+    return true;
+}
+
+static EntityItemProperties makeProperties() {
+    EntityItemProperties properties;
+    properties.setType(EntityTypes::Box);
+    properties.setName("benchmark");
+    properties.setPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+    properties.setRotation(glm::quat(0.5f, 0.5f, 0.5f, 0.5f));
+    properties.setDimensions(glm::vec3(0.5f));
+    properties.setColor(glm::u8vec3(255, 128, 0));
+    properties.setUserData("{\"grabbableKey\":{\"grabbable\":true}}");
+    properties.setCreated(usecTimestampNow());
+    return properties;
+}
+
+void ScriptValueBenchmarkTests::initTestCase() {
+    _engine = newScriptEngine();
+}
+
+void ScriptValueBenchmarkTests::cleanupTestCase() {
+    _engine.reset();
+}
+
+void ScriptValueBenchmarkTests::benchmarkVec3ToScriptValueGeneric() {
+    glm::vec3 vec3(1.0f, 2.0f, 3.0f);
+    QBENCHMARK {
+        for (int i = 0; i < NUM_CONVERSIONS; i++) {
+            genericVec3ToScriptValue(_engine.get(), vec3);
+        }
+    }
+    QCOMPARE(genericVec3ToScriptValue(_engine.get(), vec3).property("green").toNumber(), 2.0);
+}
+
+void ScriptValueBenchmarkTests::benchmarkVec3ToScriptValue() {
+    glm::vec3 vec3(1.0f, 2.0f, 3.0f);
+    QBENCHMARK {
+        for (int i = 0; i < NUM_CONVERSIONS; i++) {
+            vec3ToScriptValue(_engine.get(), vec3);
+        }
+    }
+    QCOMPARE(vec3ToScriptValue(_engine.get(), vec3).property("green").toNumber(), 2.0);
+}
+
+void ScriptValueBenchmarkTests::benchmarkQuatFromScriptValueGeneric() {
+    ScriptValue value = quatToScriptValue(_engine.get(), glm::quat(0.5f, 0.5f, 0.5f, 0.5f));
+    glm::quat quat;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_CONVERSIONS; i++) {
+            genericQuatFromScriptValue(value, quat);
+        }
+    }
+    QCOMPARE(quat.w, 0.5f);
+}
+
+void ScriptValueBenchmarkTests::benchmarkQuatFromScriptValue() {
+    ScriptValue value = quatToScriptValue(_engine.get(), glm::quat(0.5f, 0.5f, 0.5f, 0.5f));
+    glm::quat quat;
+    QBENCHMARK {
+        for (int i = 0; i < NUM_CONVERSIONS; i++) {
+            quatFromScriptValue(value, quat);
+        }
+    }
+    QCOMPARE(quat.w, 0.5f);
+}
+
+// The entity properties conversions as they were before: every property name is converted again, and the default
+// properties are constructed on every call. The vec3 and quat values inside still take the V8 specific conversions,
+// the benchmarks above compare those.
+void ScriptValueBenchmarkTests::benchmarkEntityPropertiesToScriptValueGeneric() {
+    auto properties = makeProperties();
+    ScriptValue value;
+    _engine->setPropertyNameCacheEnabled(false);
+    QBENCHMARK {
+        EntityItemProperties defaultEntityProperties;
+        Q_UNUSED(defaultEntityProperties);
+        value = properties.copyToScriptValue(_engine.get(), false, false, false);
+    }
+    _engine->setPropertyNameCacheEnabled(true);
+    QCOMPARE(value.property("name").toString(), QString("benchmark"));
+}
+
+void ScriptValueBenchmarkTests::benchmarkEntityPropertiesToScriptValue() {
+    auto properties = makeProperties();
+    ScriptValue value;
+    QBENCHMARK {
+        value = properties.copyToScriptValue(_engine.get(), false, false, false);
+    }
+    QCOMPARE(value.property("name").toString(), QString("benchmark"));
+}
+
+void ScriptValueBenchmarkTests::benchmarkEntityPropertiesToScriptValueDesired() {
+    auto properties = makeProperties();
+    EntityPropertyFlags desired;
+    desired += PROP_POSITION;
+    desired += PROP_ROTATION;
+    properties.setDesiredProperties(desired);
+    ScriptValue value;
+    QBENCHMARK {
+        value = properties.copyToScriptValue(_engine.get(), false, false, false);
+    }
+    QCOMPARE(value.property("position").property("y").toNumber(), 2.0);
+}
+
+void ScriptValueBenchmarkTests::benchmarkEntityPropertiesFromScriptValueGeneric() {
+    ScriptValue value = makeProperties().copyToScriptValue(_engine.get(), false, false, false);
+    EntityItemProperties properties;
+    _engine->setPropertyNameCacheEnabled(false);
+    QBENCHMARK {
+        properties.copyFromScriptValue(value, false);
+    }
+    _engine->setPropertyNameCacheEnabled(true);
+    QCOMPARE(properties.getName(), QString("benchmark"));
+}
+
+void ScriptValueBenchmarkTests::benchmarkEntityPropertiesFromScriptValue() {
+    ScriptValue value = makeProperties().copyToScriptValue(_engine.get(), false, false, false);
+    EntityItemProperties properties;
+    QBENCHMARK {
+        properties.copyFromScriptValue(value, false);
+    }
+    QCOMPARE(properties.getName(), QString("benchmark"));
+}
@@ -0,0 +1,41 @@
+//
+//  ScriptValueBenchmarkTests.h
+//  tests/script-engine/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//  SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef overte_ScriptValueBenchmarkTests_h
+#define overte_ScriptValueBenchmarkTests_h
+
+#include <QtTest/QtTest>
+
+#include "ScriptEngine.h"
+
+// Compares the generic conversions between native values and script values, as they were before the V8
+// specific ones, with the conversions the engine uses now
+class ScriptValueBenchmarkTests : public QObject {
+    Q_OBJECT
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void benchmarkVec3ToScriptValueGeneric();
+    void benchmarkVec3ToScriptValue();
+    void benchmarkQuatFromScriptValueGeneric();
+    void benchmarkQuatFromScriptValue();
+    void benchmarkEntityPropertiesToScriptValueGeneric();
+    void benchmarkEntityPropertiesToScriptValue();
+    void benchmarkEntityPropertiesToScriptValueDesired();
+    void benchmarkEntityPropertiesFromScriptValueGeneric();
+    void benchmarkEntityPropertiesFromScriptValue();
+
+private:
+    ScriptEnginePointer _engine;
+};
+
+#endif // overte_ScriptValueBenchmarkTests_h
@@ -0,0 +1,121 @@
+//
+//  WorkStealingSchedulerTests.cpp
+//  tests/shared/src
+//
+//  Copyright 2026 Overte e.V.
+//
+//  Distributed under the Apache License, Version 2.0.
+//  See the accompanying file LICENSE or http://www.apache.org/licenses/LICENSE-2.0.html
+//
+
+#include "WorkStealingSchedulerTests.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <WorkStealingScheduler.h>
+
+QTEST_MAIN(WorkStealingSchedulerTests)
+
+using Scheduler = WorkStealingScheduler<int>;
+
+void WorkStealingSchedulerTests::distributeTest() {
+    Scheduler scheduler;
+    scheduler.setNumWorkers(2);
+
+    // one heavy task, and as much light work again split in small tasks
+    scheduler.push(0, 8);
+    for (int i = 1; i <= 8; ++i) {
+        scheduler.push(i, 1);
+    }
+    scheduler.distribute();
+
+    // the heavy task gets a worker to itself, so everything else has to be stolen from the other one
+    std::vector<int> tasks;
+    scheduler.run(0, [&](int task) { tasks.push_back(task); });
+
+    QCOMPARE((int)tasks.size(), 9);
+    QCOMPARE(tasks[0], 0);
+    QCOMPARE(scheduler.getWorkerStats(0).numStolen, 8);
+
+    scheduler.run(1, [&](int task) { tasks.push_back(task); });
+    QCOMPARE(scheduler.getWorkerStats(1).numTasks, 0);
+    QVERIFY(scheduler.isEmpty());
+}
+
+void WorkStealingSchedulerTests::stealTest() {
+    const int NUM_WORKERS = 4;
+    const int NUM_TASKS = 100;
+
+    Scheduler scheduler;
+    scheduler.setNumWorkers(NUM_WORKERS);
+    for (int i = 0; i < NUM_TASKS; ++i) {
+        scheduler.push(i, 0);
+    }
+    scheduler.distribute();
+
+    // a single worker drains everybody's deque
+    std::vector<int> counts(NUM_TASKS, 0);
+    scheduler.run(0, [&](int task) { ++counts[task]; });
+
+    for (int count : counts) {
+        QCOMPARE(count, 1);
+    }
+    QCOMPARE(scheduler.getWorkerStats(0).numTasks, NUM_TASKS);
+    QCOMPARE(scheduler.getWorkerStats(0).numStolen, NUM_TASKS - NUM_TASKS / NUM_WORKERS);
+    QVERIFY(scheduler.isEmpty());
+
+    // every task has a measured cost, usable as a hint for the next run
+    for (int i = 0; i < scheduler.getNumTasks(); ++i) {
+        QVERIFY(scheduler.getTaskCost(i) > 0);
+    }
+
+    scheduler.clear();
+    QCOMPARE(scheduler.getNumTasks(), 0);
+    QCOMPARE(scheduler.getWorkerStats(0).numTasks, 0);
+}
+
+void WorkStealingSchedulerTests::concurrentTest() {
+    const int NUM_WORKERS = 4;
+    const int NUM_TASKS = 10000;
+    const int NUM_RUNS = 10;
+
+    Scheduler scheduler;
+    scheduler.setNumWorkers(NUM_WORKERS);
+
+    for (int run = 0; run < NUM_RUNS; ++run) {
+        scheduler.clear();
+        for (int i = 0; i < NUM_TASKS; ++i) {
+            // a few expensive tasks, which should end up spread across the workers
+            scheduler.push(i, (i % 1000 == 0) ? 1000 : 1);
+        }
+        scheduler.distribute();
+
+        std::vector<std::atomic<int>> counts(NUM_TASKS);
+        for (auto& count : counts) {
+            count = 0;
+        }
+
+        std::vector<std::thread> threads;
+        for (int worker = 0; worker < NUM_WORKERS; ++worker) {
+            threads.emplace_back([&, worker] {
+                scheduler.run(worker, [&](int task) { ++counts[task]; });
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        int numTasks = 0;
+        for (int worker = 0; worker < NUM_WORKERS; ++worker) {
+            numTasks += scheduler.getWorkerStats(worker).numTasks;
+        }
+        QCOMPARE(numTasks, NUM_TASKS);
+
+        for (auto& count : counts) {
+            QCOMPARE(count.load(), 1);
+        }
+        QVERIFY(scheduler.isEmpty());
+    }
+}
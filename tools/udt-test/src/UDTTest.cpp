@@ -13,10 +13,16 @@
 #include "UDTTest.h"
 
 #include <QtCore/QDebug>
+#include <QtCore/QFile>
+
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
 
 #include <udt/Constants.h>
 #include <udt/Packet.h>
 #include <udt/PacketList.h>
+#include <udt/SendQueueScheduler.h>
 
 #include <LogHandler.h>
 
@@ -56,6 +62,23 @@ const QCommandLineOption MESSAGE_SEED {
 const QCommandLineOption STATS_INTERVAL {
     "stats-interval", "stats output interval (default is 100ms)", "milliseconds"
 };
+const QCommandLineOption SEND_THREADS {
+    "send-threads", "threads shared by the send queues, 0 gives each connection a thread of its own "
+    "(default depends on the number of cores, the stress test runs with both)", "threads"
+};
+const QCommandLineOption STRESS_CONNECTIONS {
+    "stress-connections", "open this many connections to sockets of this process and report the cost of sending on them "
+    "with a thread per connection and with shared send threads", "connections"
+};
+const QCommandLineOption STRESS_RATE {
+    "stress-rate", "packets per second sent on each connection by the stress test (default is 100)", "packets"
+};
+const QCommandLineOption STRESS_DURATION {
+    "stress-duration", "seconds of sending with each threading model in the stress test (default is 10)", "seconds"
+};
+
+// time left for the packets in flight to arrive before the stress test counts them
+static const int STRESS_DRAIN_MSECS = 1000;
 
 const QStringList CLIENT_STATS_TABLE_HEADERS {
     "Send (Mb/s)", "Est. Max (Mb/s)", "RTT (ms)", "CW (P)", "Period (us)",
@@ -75,8 +98,12 @@ UDTTest::UDTTest(int& argc, char** argv) :
     // randomize the seed for packet size randomization
     srand(time(NULL));
 
-    _socket.bind(QHostAddress::AnyIPv4, _argumentParser.value(PORT_OPTION).toUInt());
-    qDebug() << "Test socket is listening on" << _socket.localPort();
+    if (_argumentParser.isSet(SEND_THREADS)) {
+        udt::SendQueueScheduler::getInstance().setNumThreads(_argumentParser.value(SEND_THREADS).toInt());
+    }
+
+    _socket.bind(SocketType::UDP, QHostAddress::AnyIPv4, _argumentParser.value(PORT_OPTION).toUInt());
+    qDebug() << "Test socket is listening on" << _socket.localPort(SocketType::UDP);
     
     if (_argumentParser.isSet(TARGET_OPTION)) {
         // parse the IP and port combination for this target
@@ -91,7 +118,7 @@ UDTTest::UDTTest(int& argc, char** argv) :
             
             QMetaObject::invokeMethod(this, "quit", Qt::QueuedConnection);
         } else {
-            _target = SockAddr(address, port);
+            _target = SockAddr(SocketType::UDP, address, port);
             qDebug() << "Packets will be sent to" << _target;
         }
     }
@@ -167,6 +194,28 @@ UDTTest::UDTTest(int& argc, char** argv) :
     
     // seed the generator with a value that the receiver will also use when verifying the ordered message
     _generator.seed(messageSeed);
+
+    if (_argumentParser.isSet(STRESS_CONNECTIONS)) {
+        _stressConnections = _argumentParser.value(STRESS_CONNECTIONS).toInt();
+
+        if (_argumentParser.isSet(STRESS_RATE)) {
+            _stressPacketsPerSecond = _argumentParser.value(STRESS_RATE).toInt();
+        }
+        if (_argumentParser.isSet(STRESS_DURATION)) {
+            _stressDuration = _argumentParser.value(STRESS_DURATION).toInt();
+        }
+
+        if (_argumentParser.isSet(SEND_THREADS)) {
+            _stressSendThreads = { udt::SendQueueScheduler::getInstance().getNumThreads() };
+        } else {
+            // compare the dedicated threads with the default number of shared threads
+            _stressSendThreads = { 0, udt::SendQueueScheduler::getInstance().getNumThreads() };
+        }
+
+        connect(&_stressSendTimer, &QTimer::timeout, this, &UDTTest::sendStressPackets);
+        startStressPhase();
+        return;
+    }
     
     if (!_target.isNull()) {
         sendInitialPackets();
@@ -225,7 +274,7 @@ void UDTTest::parseArguments() {
     _argumentParser.addOptions({
         PORT_OPTION, TARGET_OPTION, PACKET_SIZE, MIN_PACKET_SIZE, MAX_PACKET_SIZE,
         MAX_SEND_BYTES, MAX_SEND_PACKETS, UNRELIABLE_PACKETS, ORDERED_PACKETS,
-        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL
+        MESSAGE_SIZE, MESSAGE_SEED, STATS_INTERVAL, SEND_THREADS, STRESS_CONNECTIONS, STRESS_RATE, STRESS_DURATION
     });
     
     if (!_argumentParser.parse(arguments())) {
@@ -423,3 +472,122 @@ void UDTTest::sampleStats() {
         }
     }
 }
+
+UDTTest::ProcessUsage UDTTest::sampleProcessUsage() {
+    ProcessUsage usage;
+
+#ifdef Q_OS_UNIX
+    rusage resourceUsage;
+    if (getrusage(RUSAGE_SELF, &resourceUsage) == 0) {
+        static const qint64 USECS_PER_SECOND = 1000000;
+        usage.cpuUsecs = (resourceUsage.ru_utime.tv_sec + resourceUsage.ru_stime.tv_sec) * USECS_PER_SECOND
+            + resourceUsage.ru_utime.tv_usec + resourceUsage.ru_stime.tv_usec;
+        usage.contextSwitches = resourceUsage.ru_nvcsw + resourceUsage.ru_nivcsw;
+    }
+#endif
+
+#ifdef Q_OS_LINUX
+    QFile status("/proc/self/status");
+    if (status.open(QIODevice::ReadOnly)) {
+        static const QByteArray THREADS_FIELD = "Threads:";
+        for (auto& line : status.readAll().split('\n')) {
+            if (line.startsWith(THREADS_FIELD)) {
+                usage.threads = line.mid(THREADS_FIELD.size()).trimmed().toInt();
+                break;
+            }
+        }
+    }
+#endif
+
+    return usage;
+}
+
+void UDTTest::startStressPhase() {
+    _stressPhaseSendThreads = _stressSendThreads.takeFirst();
+    udt::SendQueueScheduler::getInstance().setNumThreads(_stressPhaseSendThreads);
+
+    _stressSender.reset(new udt::Socket());
+    _stressSender->bind(SocketType::UDP, QHostAddress::LocalHost);
+
+    for (int i = 0; i < _stressConnections; ++i) {
+        // leave the socket buffers of the receivers alone, there can be a lot of them
+        auto receiver = std::unique_ptr<udt::Socket>(new udt::Socket(nullptr, false));
+        receiver->bind(SocketType::UDP, QHostAddress::LocalHost);
+        receiver->setPacketHandler([this](std::unique_ptr<udt::Packet>) {
+            ++_stressReceivedPackets;
+        });
+
+        _stressTargets.push_back(SockAddr(SocketType::UDP, QHostAddress::LocalHost, receiver->localPort(SocketType::UDP)));
+        _stressReceivers.push_back(std::move(receiver));
+    }
+
+    qDebug() << "Sending" << _stressPacketsPerSecond << "packets per second on each of" << _stressConnections
+        << "connections for" << _stressDuration << "seconds with"
+        << qPrintable(_stressPhaseSendThreads == 0 ? QString("a thread per connection")
+                                                   : QString("%1 shared send threads").arg(_stressPhaseSendThreads));
+
+    _stressPacketsPerConnection = 0;
+    _stressReceivedPackets = 0;
+    _stressStartUsage = sampleProcessUsage();
+    _stressPhaseTimer.start();
+
+    static const int STRESS_SEND_INTERVAL_MSECS = 10;
+    _stressSendTimer.start(STRESS_SEND_INTERVAL_MSECS);
+}
+
+void UDTTest::sendStressPackets() {
+    static const qint64 MSECS_PER_SECOND = 1000;
+
+    auto elapsed = _stressPhaseTimer.elapsed();
+    if (elapsed >= _stressDuration * MSECS_PER_SECOND) {
+        finishStressPhase();
+        return;
+    }
+
+    // queue the packets due on each connection since the phase started, so that late timers don't lower the rate
+    int packetsDue = (int)(elapsed * _stressPacketsPerSecond / MSECS_PER_SECOND) + 1;
+    int packetPayloadSize = _maxPacketSize - udt::Packet::localHeaderSize(false);
+
+    for (; _stressPacketsPerConnection < packetsDue; ++_stressPacketsPerConnection) {
+        for (auto& target : _stressTargets) {
+            auto packet = udt::Packet::create(packetPayloadSize, true);
+            packet->setPayloadSize(packetPayloadSize);
+            _stressSender->writePacket(std::move(packet), target);
+        }
+    }
+}
+
+void UDTTest::finishStressPhase() {
+    _stressSendTimer.stop();
+
+    auto elapsedMsecs = _stressPhaseTimer.elapsed();
+    auto endUsage = sampleProcessUsage();
+
+    // let the packets in flight arrive before counting them
+    QTimer::singleShot(STRESS_DRAIN_MSECS, this, [this, elapsedMsecs, endUsage] {
+        quint64 sentPackets = (quint64)_stressPacketsPerConnection * _stressConnections;
+        auto cpuUsecs = endUsage.cpuUsecs - _stressStartUsage.cpuUsecs;
+        static const double MSECS_PER_SECOND = 1000.0;
+
+        qDebug() << "  Sent packets:" << sentPackets << "-" << qPrintable(QString::number(sentPackets * MSECS_PER_SECOND
+                                                                                          / elapsedMsecs, 'f', 0))
+            << "per second";
+        qDebug() << "  Received packets:" << _stressReceivedPackets;
+        qDebug() << "  Threads in process:" << endUsage.threads;
+        qDebug() << "  CPU time:" << cpuUsecs / 1000 << "ms -"
+            << qPrintable(QString::number(sentPackets > 0 ? (double)cpuUsecs / sentPackets : 0.0, 'f', 2))
+            << "us per packet";
+        qDebug() << "  Context switches:" << endUsage.contextSwitches - _stressStartUsage.contextSwitches;
+
+        // closing the connections stops their send queues
+        _stressSender.reset();
+        _stressReceivers.clear();
+        _stressTargets.clear();
+
+        if (_stressSendThreads.isEmpty()) {
+            quit();
+        } else {
+            startStressPhase();
+        }
+    });
+}
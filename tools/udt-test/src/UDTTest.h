@@ -16,10 +16,14 @@
 #define hifi_UDTTest_h
 
 
+#include <memory>
 #include <random>
+#include <vector>
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QCommandLineParser>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
 
 #include <udt/Constants.h>
 #include <udt/Socket.h>
@@ -46,6 +50,19 @@ private:
     
     void sendInitialPackets(); // fills the queue with packets to start
     void sendPacket(); // constructs and sends a packet according to the test parameters
+
+    // the stress test opens many connections to sockets of this process and measures the cost of sending on them,
+    // with each of the threading models of the send queues
+    struct ProcessUsage {
+        qint64 cpuUsecs { 0 };
+        qint64 contextSwitches { 0 };
+        int threads { 0 };
+    };
+    static ProcessUsage sampleProcessUsage();
+
+    void startStressPhase(); // opens the connections and starts sending with the next threading model
+    void sendStressPackets(); // queues the packets due on each connection at the stress rate
+    void finishStressPhase(); // stops sending, then reports and closes the connections
     
     QCommandLineParser _argumentParser;
     udt::Socket _socket;
@@ -72,6 +89,21 @@ private:
     int _totalQueuedBytes { 0 }; // keeps track of the number of bytes we have already queued
     
     int _statsInterval { 100 }; // recording interval for stats in milliseconds
+
+    int _stressConnections { 0 }; // number of connections opened by the stress test, 0 when not stress testing
+    int _stressPacketsPerSecond { 100 }; // packets per second sent on each connection
+    int _stressDuration { 10 }; // seconds of sending with each threading model
+    QList<int> _stressSendThreads; // numbers of send threads of the phases still to run, 0 is a thread per connection
+
+    int _stressPhaseSendThreads { 0 };
+    std::unique_ptr<udt::Socket> _stressSender;
+    std::vector<std::unique_ptr<udt::Socket>> _stressReceivers;
+    std::vector<SockAddr> _stressTargets;
+    QTimer _stressSendTimer;
+    QElapsedTimer _stressPhaseTimer;
+    ProcessUsage _stressStartUsage;
+    int _stressPacketsPerConnection { 0 }; // packets queued on each connection in this phase
+    quint64 _stressReceivedPackets { 0 };
 };
 
 #endif // hifi_UDTTest_h